@@ -644,6 +644,45 @@ static void MTest_setRotationMatrix2(
   MTest_setRotationMatrix1(t, m, false);
 }  // end of MTest_setRotationMatrix
 
+static void MTest_addMaterialPoint3(
+    mtest::MTest& t,
+    const mtest::real w,
+    const std::vector<std::vector<mtest::real>>& m,
+    const std::map<std::string, mtest::real>& mps,
+    const std::string& phase) {
+  auto mp = mtest::MTest::MaterialPoint{};
+  mp.weight = w;
+  mp.phase = phase;
+  if (!m.empty()) {
+    tfel::raise_if(m.size() != 3u, "MTest::addMaterialPoint: invalid matrix");
+    for (decltype(mp.r.size()) i = 0; i != 3; ++i) {
+      tfel::raise_if(m[i].size() != 3u,
+                     "MTest::addMaterialPoint: invalid matrix");
+      for (decltype(mp.r.size()) j = 0; j != 3; ++j) {
+        mp.r(i, j) = m[i][j];
+      }
+    }
+    mp.isRotationMatrixDefined = true;
+  }
+  mp.material_properties = mps;
+  t.addMaterialPoint(mp);
+}  // end of MTest_addMaterialPoint3
+
+static void MTest_addMaterialPoint1(
+    mtest::MTest& t,
+    const mtest::real w,
+    const std::vector<std::vector<mtest::real>>& m,
+    const std::map<std::string, mtest::real>& mps) {
+  MTest_addMaterialPoint3(t, w, m, mps, "");
+}  // end of MTest_addMaterialPoint1
+
+static void MTest_addMaterialPoint2(
+    mtest::MTest& t,
+    const mtest::real w,
+    const std::vector<std::vector<mtest::real>>& m) {
+  MTest_addMaterialPoint1(t, w, m, {});
+}  // end of MTest_addMaterialPoint2
+
 #define TFEL_PYTHON_MTESTCURRENTSTATEGETTER(X)                     \
   static tfel::math::vector<mtest::real> MTestCurrentState_get##X( \
       const mtest::MTestCurrentState& t) {                         \
@@ -1300,6 +1339,45 @@ void declareMTest() {
       .def("setNumericalTangentOperatorPerturbationValue",
            &MTest::setNumericalTangentOperatorPerturbationValue,
            "set the perburtation of the gradient used to compute a numerical "
-           "approximation of the tangent operator");
+           "approximation of the tangent operator")
+      .def("addMaterialPoint", MTest_addMaterialPoint3,
+           (arg("weight"), "rotation_matrix", "material_properties", "phase"),
+           "add a material point to the aggregate (Taylor homogenisation "
+           "scheme):\n"
+           "- the first argument is the weight of the material point\n"
+           "- the second argument is the rotation matrix of the material "
+           "point. If empty, the rotation matrix of the test is used.\n"
+           "- the third argument gives the values of the material properties "
+           "specific to the material point\n"
+           "- the fourth argument is the name of the phase to which the "
+           "material point belongs")
+      .def("addMaterialPoint", MTest_addMaterialPoint1,
+           (arg("weight"), "rotation_matrix", "material_properties"),
+           "add a material point to the aggregate (Taylor homogenisation "
+           "scheme):\n"
+           "- the first argument is the weight of the material point\n"
+           "- the second argument is the rotation matrix of the material "
+           "point. If empty, the rotation matrix of the test is used.\n"
+           "- the third argument gives the values of the material properties "
+           "specific to the material point")
+      .def("addMaterialPoint", MTest_addMaterialPoint2,
+           (arg("weight"), "rotation_matrix"),
+           "add a material point to the aggregate (Taylor homogenisation "
+           "scheme):\n"
+           "- the first argument is the weight of the material point\n"
+           "- the second argument is the rotation matrix of the material "
+           "point. If empty, the rotation matrix of the test is used.")
+      .def("getNumberOfMaterialPoints", &MTest::getNumberOfMaterialPoints,
+           "return the number of material points of the aggregate")
+      .def("setMaterialPointsOutputFile", &MTest::setMaterialPointsOutputFile,
+           "set the name of the file where the state of each material point "
+           "of the aggregate is written")
+      .def("setMaterialPointsPhasesOutputFile",
+           &MTest::setMaterialPointsPhasesOutputFile,
+           "set the name of the file where the averaged state of each phase "
+           "of the aggregate is written")
+      .def("setNumberOfThreads", &MTest::setNumberOfThreads,
+           "set the number of threads used to integrate the behaviour on the "
+           "material points of the aggregate");
 
 }  // end of declareExternalLibraryManager
@@ -88,12 +88,36 @@ static void setOutputFrequency(mtest::SchemeBase& s, const std::string& v) {
   }
 }
 
+static void setOutputFileFormat(mtest::SchemeBase& s, const std::string& f) {
+  if (f == "text") {
+    s.setOutputFileFormat(mtest::SchemeBase::TEXTFORMAT);
+  } else if (f == "binary") {
+    s.setOutputFileFormat(mtest::SchemeBase::BINARYFORMAT);
+  } else {
+    tfel::raise(
+        "SchemeBase::setOutputFileFormat: "
+        "invalid format '" +
+        f + "'");
+  }
+}
+
 static void SchemeBase_printOutput(mtest::SchemeBase& s,
                                    const mtest::real t,
                                    const mtest::StudyCurrentState& scs) {
   s.printOutput(t, scs, true);
 }
 
+static void SchemeBase_setCheckpointFileName(mtest::SchemeBase& s,
+                                             const std::string& f) {
+  s.setCheckpointFileName(f);
+}
+
+static void SchemeBase_setCheckpointFileName2(mtest::SchemeBase& s,
+                                              const std::string& f,
+                                              const std::size_t n) {
+  s.setCheckpointFileName(f, n);
+}
+
 void declareSchemeBase();
 
 void declareSchemeBase() {
@@ -244,10 +268,23 @@ void declareSchemeBase() {
            "* The parameter (string) is the selected name of the "
            "output file. Generaly, it's similar to the input file, "
            "replacing the optionnal .mtest' extension by '.res'.")
+      .def("setCheckpointFileName", SchemeBase_setCheckpointFileName,
+           "This method specifies the name of a checkpoint file "
+           "which is written at the end of each time step.")
+      .def("setCheckpointFileName", SchemeBase_setCheckpointFileName2,
+           "This method specifies the name of a checkpoint file "
+           "and the number of time steps between two checkpoints.")
+      .def("setRestartFileName", &SchemeBase::setRestartFileName,
+           "This method specifies the name of the checkpoint file "
+           "from which the computation is restarted.")
       .def("setOutputFilePrecision", &SchemeBase::setOutputFilePrecision,
            "This method specify the number of digits used to print "
            "the results in the output file.\n"
            "* The parameter (uint) is the number of digits wanted.")
+      .def("setOutputFileFormat", setOutputFileFormat,
+           "This method specify the format of the output file.\n"
+           "* The parameter (string) is either 'text' (default) or "
+           "'binary'.")
       .def("printOutput", &SchemeBase::printOutput)
       .def("printOutput", &SchemeBase_printOutput)
       .def("setResidualFileName", &SchemeBase::setResidualFileName,
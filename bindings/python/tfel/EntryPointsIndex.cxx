@@ -0,0 +1,70 @@
+/*!
+ * \file   EntryPointsIndex.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <boost/python.hpp>
+#include "TFEL/System/EntryPointsIndex.hxx"
+
+static std::vector<std::string> get_hypotheses(
+    const tfel::system::EntryPointDescription& d) {
+  return d.hypotheses;
+}
+
+static boost::python::list convert(
+    const std::vector<tfel::system::EntryPointDescription>& descriptions) {
+  boost::python::list r;
+  for (const auto& d : descriptions) {
+    r.append(d);
+  }
+  return r;
+}
+
+static boost::python::list getEntryPointsDescriptions(const std::string& l) {
+  return convert(tfel::system::getEntryPointsDescriptions(l));
+}
+
+static boost::python::list getIndexedEntryPointsDescriptions(
+    const std::string& d, const std::size_t n) {
+  return convert(tfel::system::getIndexedEntryPointsDescriptions(d, n));
+}
+
+static boost::python::list getIndexedEntryPointsDescriptions2(
+    const std::string& d) {
+  return convert(tfel::system::getIndexedEntryPointsDescriptions(d));
+}
+
+void declareEntryPointsIndex();
+
+void declareEntryPointsIndex() {
+  using namespace boost::python;
+  using tfel::system::EntryPointDescription;
+  class_<EntryPointDescription>("EntryPointDescription")
+      .def_readonly("library", &EntryPointDescription::library)
+      .def_readonly("name", &EntryPointDescription::name)
+      .def_readonly("type", &EntryPointDescription::type)
+      .def_readonly("material", &EntryPointDescription::material)
+      .def_readonly("interface", &EntryPointDescription::interface)
+      .def_readonly("source", &EntryPointDescription::source)
+      .add_property("hypotheses", get_hypotheses);
+  def("getEntryPointsDescriptions", getEntryPointsDescriptions,
+      "return the descriptions of the entry points of a library");
+  def("getIndexedEntryPointsDescriptions", getIndexedEntryPointsDescriptions,
+      "return the descriptions of the entry points of the libraries of a "
+      "directory, using (and updating if needed) the index of this "
+      "directory. The second argument is the number of threads used to "
+      "scan the libraries which are not up to date in the index");
+  def("getIndexedEntryPointsDescriptions",
+      getIndexedEntryPointsDescriptions2,
+      "return the descriptions of the entry points of the libraries of a "
+      "directory, using (and updating if needed) the index of this "
+      "directory");
+}
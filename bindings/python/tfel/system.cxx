@@ -20,6 +20,7 @@ void declareLibraryInformation();
 void declareExternalMaterialKnowledgeDescription();
 void declareExternalMaterialPropertyDescription();
 void declareExternalBehaviourDescription();
+void declareEntryPointsIndex();
 
 BOOST_PYTHON_MODULE(system) {
 #ifndef _WIN32
@@ -30,4 +31,5 @@ BOOST_PYTHON_MODULE(system) {
   declareExternalMaterialKnowledgeDescription();
   declareExternalMaterialPropertyDescription();
   declareExternalBehaviourDescription();
+  declareEntryPointsIndex();
 }
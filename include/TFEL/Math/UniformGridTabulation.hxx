@@ -0,0 +1,132 @@
+/*!
+ * \file   include/TFEL/Math/UniformGridTabulation.hxx
+ * \brief  This file declares the UniformGridTabulation class.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_UNIFORMGRIDTABULATION_HXX
+#define LIB_TFEL_MATH_UNIFORMGRIDTABULATION_HXX
+
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+
+namespace tfel::math {
+
+  /*!
+   * \brief a class which tabulates a function of one variable on a
+   * uniform grid.
+   *
+   * The number of points of the grid is determined at construction to
+   * reach a given accuracy: the number of intervals is doubled until the
+   * difference between the interpolated values and the exact values at
+   * the middle of each interval is lower than the accuracy times the
+   * maximum absolute value of the function on the grid.
+   *
+   * Contrary to the `computeLinearInterpolation` and
+   * `computeCubicSplineInterpolation` functions, the interval containing
+   * the given abscissa is computed in constant time.
+   *
+   * \tparam NumericType: numeric type
+   */
+  template <typename NumericType>
+  struct UniformGridTabulation {
+    static_assert(std::is_floating_point_v<NumericType>,
+                  "invalid numeric type");
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    //! \brief supported interpolations
+    enum Interpolation {
+      //! \brief linear interpolation
+      LINEAR_INTERPOLATION,
+      /*!
+       * \brief cubic Hermite interpolation, the derivatives at the nodes
+       * being estimated by second order finite differences.
+       */
+      CUBIC_INTERPOLATION
+    };
+    /*!
+     * \brief constructor
+     * \param[in] f: tabulated function
+     * \param[in] xmin: lower bound of the tabulation range
+     * \param[in] xmax: upper bound of the tabulation range
+     * \param[in] eps: relative accuracy. This value is bounded below by
+     * a small multiple of the machine precision.
+     * \param[in] i: interpolation
+     * \param[in] nmax: maximal number of intervals
+     */
+    template <typename FunctionType>
+    UniformGridTabulation(const FunctionType&,
+                          const NumericType,
+                          const NumericType,
+                          const NumericType,
+                          const Interpolation = CUBIC_INTERPOLATION,
+                          const size_type = size_type{65536});
+    //! \brief move constructor
+    UniformGridTabulation(UniformGridTabulation&&) = default;
+    //! \brief copy constructor
+    UniformGridTabulation(const UniformGridTabulation&) = default;
+    //! \brief move assignement
+    UniformGridTabulation& operator=(UniformGridTabulation&&) = default;
+    //! \brief standard assignement
+    UniformGridTabulation& operator=(const UniformGridTabulation&) = default;
+    //! \return if the given abscissa is in the tabulation range
+    bool contains(const NumericType) const noexcept;
+    /*!
+     * \return the interpolated value at the given abscissa
+     * \param[in] x: abscissa
+     * \note the abscissa is assumed to be in the tabulation range
+     */
+    NumericType operator()(const NumericType) const noexcept;
+    /*!
+     * \return if the given value is close enough to the interpolated
+     * value to be considered consistent with the accuracy requested
+     * at construction. A tolerance of ten times this accuracy is used,
+     * since the accuracy is only checked at the middle of the intervals
+     * during the construction of the tabulation.
+     * \param[in] x: abscissa
+     * \param[in] v: exact value
+     */
+    bool check(const NumericType, const NumericType) const noexcept;
+    //! \return the number of intervals
+    size_type getNumberOfIntervals() const noexcept;
+
+   private:
+    /*!
+     * \brief build the tabulation for the given number of intervals
+     * \param[in] f: tabulated function
+     * \param[in] n: number of intervals
+     */
+    template <typename FunctionType>
+    void build(const FunctionType&, const size_type);
+    //! \brief lower bound of the tabulation range
+    NumericType xmin;
+    //! \brief upper bound of the tabulation range
+    NumericType xmax;
+    //! \brief inverse of the grid step
+    NumericType ih = NumericType{1};
+    //! \brief absolute accuracy
+    NumericType accuracy = NumericType{0};
+    //! \brief values at the nodes
+    std::vector<NumericType> values;
+    /*!
+     * \brief derivatives at the nodes multiplied by the grid step. This
+     * vector is empty if the linear interpolation is used.
+     */
+    std::vector<NumericType> derivatives;
+    //! \brief interpolation
+    Interpolation interpolation;
+  };  // end of struct UniformGridTabulation
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/UniformGridTabulation.ixx"
+
+#endif /* LIB_TFEL_MATH_UNIFORMGRIDTABULATION_HXX */
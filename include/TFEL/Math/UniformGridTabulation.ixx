@@ -0,0 +1,140 @@
+/*!
+ * \file   include/TFEL/Math/UniformGridTabulation.ixx
+ * \brief  This file implements the UniformGridTabulation class.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_UNIFORMGRIDTABULATION_IXX
+#define LIB_TFEL_MATH_UNIFORMGRIDTABULATION_IXX
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+
+namespace tfel::math {
+
+  template <typename NumericType>
+  template <typename FunctionType>
+  UniformGridTabulation<NumericType>::UniformGridTabulation(
+      const FunctionType& f,
+      const NumericType a,
+      const NumericType b,
+      const NumericType eps,
+      const Interpolation i,
+      const size_type nmax)
+      : xmin(a), xmax(b), interpolation(i) {
+    tfel::raise_if(!(a < b),
+                   "UniformGridTabulation: invalid tabulation range");
+    tfel::raise_if(
+        nmax < 2, "UniformGridTabulation: invalid maximal number of intervals");
+    const auto msg = std::string{
+        "the function is not finite over the tabulation range"};
+    const auto reps =
+        std::max(eps, 100 * std::numeric_limits<NumericType>::epsilon());
+    auto n = std::min(size_type{16}, nmax);
+    while (true) {
+      this->build(f, n);
+      auto vmax = NumericType{0};
+      for (const auto& v : this->values) {
+        tfel::raise_if(!std::isfinite(v), "UniformGridTabulation: " + msg);
+        vmax = std::max(vmax, std::abs(v));
+      }
+      this->accuracy =
+          reps * std::max(vmax, std::numeric_limits<NumericType>::min());
+      const auto h = (b - a) / static_cast<NumericType>(n);
+      auto error = NumericType{0};
+      for (size_type j = 0; j != n; ++j) {
+        const auto x =
+            a + (static_cast<NumericType>(j) + NumericType(0.5)) * h;
+        const auto fx = f(x);
+        tfel::raise_if(!std::isfinite(fx), "UniformGridTabulation: " + msg);
+        error = std::max(error, std::abs((*this)(x) - fx));
+      }
+      if (error <= this->accuracy) {
+        return;
+      }
+      tfel::raise_if(2 * n > nmax,
+                     "UniformGridTabulation: the requested accuracy can't be "
+                     "reached with the maximal number of intervals");
+      n *= 2;
+    }
+  }  // end of UniformGridTabulation
+
+  template <typename NumericType>
+  template <typename FunctionType>
+  void UniformGridTabulation<NumericType>::build(const FunctionType& f,
+                                                 const size_type n) {
+    const auto h = (this->xmax - this->xmin) / static_cast<NumericType>(n);
+    this->ih = static_cast<NumericType>(n) / (this->xmax - this->xmin);
+    this->values.resize(n + 1);
+    for (size_type j = 0; j != n; ++j) {
+      this->values[j] = f(this->xmin + static_cast<NumericType>(j) * h);
+    }
+    this->values[n] = f(this->xmax);
+    if (this->interpolation == LINEAR_INTERPOLATION) {
+      this->derivatives.clear();
+      return;
+    }
+    const auto& v = this->values;
+    auto& d = this->derivatives;
+    d.resize(n + 1);
+    d[0] = (-3 * v[0] + 4 * v[1] - v[2]) / 2;
+    for (size_type j = 1; j != n; ++j) {
+      d[j] = (v[j + 1] - v[j - 1]) / 2;
+    }
+    d[n] = (3 * v[n] - 4 * v[n - 1] + v[n - 2]) / 2;
+  }  // end of build
+
+  template <typename NumericType>
+  bool UniformGridTabulation<NumericType>::contains(
+      const NumericType x) const noexcept {
+    return (x >= this->xmin) && (x <= this->xmax);
+  }  // end of contains
+
+  template <typename NumericType>
+  NumericType UniformGridTabulation<NumericType>::operator()(
+      const NumericType x) const noexcept {
+    const auto n = this->values.size() - 1;
+    const auto u = (x - this->xmin) * this->ih;
+    auto i = u > 0 ? static_cast<size_type>(u) : size_type{0};
+    if (i >= n) {
+      i = n - 1;
+    }
+    const auto t = u - static_cast<NumericType>(i);
+    const auto v0 = this->values[i];
+    const auto v1 = this->values[i + 1];
+    if (this->derivatives.empty()) {
+      return v0 + t * (v1 - v0);
+    }
+    const auto d0 = this->derivatives[i];
+    const auto d1 = this->derivatives[i + 1];
+    const auto t2 = t * t;
+    const auto t3 = t2 * t;
+    return (2 * t3 - 3 * t2 + 1) * v0 + (t3 - 2 * t2 + t) * d0 +
+           (3 * t2 - 2 * t3) * v1 + (t3 - t2) * d1;
+  }  // end of operator()
+
+  template <typename NumericType>
+  bool UniformGridTabulation<NumericType>::check(
+      const NumericType x, const NumericType v) const noexcept {
+    return std::abs((*this)(x) - v) <= 10 * this->accuracy;
+  }  // end of check
+
+  template <typename NumericType>
+  typename UniformGridTabulation<NumericType>::size_type
+  UniformGridTabulation<NumericType>::getNumberOfIntervals() const noexcept {
+    return this->values.size() - 1;
+  }  // end of getNumberOfIntervals
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_UNIFORMGRIDTABULATION_IXX */
@@ -0,0 +1,81 @@
+/*!
+ * \file   include/TFEL/System/EntryPointsIndex.hxx
+ * \brief  This file declares the functions used to build and query
+ * persistent indexes of the entry points generated by `MFront`.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_SYSTEM_ENTRYPOINTSINDEX_HXX
+#define LIB_TFEL_SYSTEM_ENTRYPOINTSINDEX_HXX
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::system {
+
+  //! \brief description of an entry point generated by `MFront`
+  struct TFELSYSTEM_VISIBILITY_EXPORT EntryPointDescription {
+    //! \brief path to the library
+    std::string library;
+    //! \brief name of the entry point
+    std::string name;
+    /*!
+     * \brief material knowledge type (see
+     * `ExternalLibraryManager::getMaterialKnowledgeType`):
+     * - 0: material property
+     * - 1: behaviour
+     * - 2: model
+     */
+    unsigned short type = 0;
+    //! \brief material, if any
+    std::string material;
+    //! \brief interface
+    std::string interface;
+    //! \brief `MFront` file used to generate the entry point, if known
+    std::string source;
+    //! \brief supported modelling hypotheses, if any
+    std::vector<std::string> hypotheses;
+  };  // end of struct EntryPointDescription
+
+  //! \brief name of the index files created in the indexed directories
+  TFELSYSTEM_VISIBILITY_EXPORT extern const char* const
+      EntryPointsIndexFileName;
+
+  /*!
+   * \return the description of the entry points of a library, using the
+   * `ExternalLibraryManager` class.
+   * \param[in] l: library
+   */
+  TFELSYSTEM_VISIBILITY_EXPORT std::vector<EntryPointDescription>
+  getEntryPointsDescriptions(const std::string&);
+  /*!
+   * \return the description of the entry points of the libraries of a
+   * directory.
+   *
+   * The descriptions are stored in an index file located in the
+   * directory (see `EntryPointsIndexFileName`). Only the libraries which
+   * are not indexed, or whose size or modification time changed since
+   * they were indexed, are scanned. Those libraries are scanned in
+   * parallel. The index file is updated if needed. Failing to write the
+   * index file, for instance in a read-only directory, is not an error.
+   *
+   * \param[in] d: directory
+   * \param[in] n: number of threads used to scan the libraries. If null,
+   * the number of hardware threads is used.
+   */
+  TFELSYSTEM_VISIBILITY_EXPORT std::vector<EntryPointDescription>
+  getIndexedEntryPointsDescriptions(const std::string&,
+                                    const std::size_t = 0);
+
+}  // end of namespace tfel::system
+
+#endif /* LIB_TFEL_SYSTEM_ENTRYPOINTSINDEX_HXX */
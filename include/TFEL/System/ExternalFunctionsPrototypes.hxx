@@ -69,6 +69,7 @@ typedef double DianaFEARealType;
 #include "MFront/GenericMaterialProperty/MaterialProperty.h"
 #include "MFront/GenericBehaviour/Types.h"
 typedef mfront_gmp_MaterialPropertyPtr GenericMaterialPropertyPtr;
+typedef mfront_gmp_MaterialPropertyArrayPtr GenericMaterialPropertyArrayPtr;
 
 // forward declaration
 typedef struct mfront_gb_BehaviourData mfront_gb_BehaviourData;
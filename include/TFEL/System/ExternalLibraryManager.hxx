@@ -17,6 +17,7 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <shared_mutex>
 
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
 #include <windows.h>
@@ -34,6 +35,14 @@ namespace tfel::system {
   /*!
    * \brief Structure in charge of loading external function and
    * retrieving information from shared libraries.
+   *
+   * The methods of this class can be called concurrently from several
+   * threads. The handles of the loaded libraries and the lists of
+   * names and types of the variables of each entry point (as returned
+   * by `getUMATMaterialPropertiesNames`, `getUMATTypes`, etc.) are
+   * cached. Other queries, such as the bounds, the default values of
+   * the parameters or the type of material knowledge, are not cached
+   * and resolve the associated symbols at each call.
    */
   struct TFELSYSTEM_VISIBILITY_EXPORT ExternalLibraryManager {
     //! \return the uniq instance of this class
@@ -53,6 +62,27 @@ namespace tfel::system {
 #else
     void* loadLibrary(const std::string&, const bool = false);
 #endif /* LIB_EXTERNALLIBRARYMANAGER_HXX */
+    /*!
+     * \brief unload a library and remove all the information cached
+     * about it.
+     * \param[in] name: name of the library, as given to `loadLibrary`
+     * \note all the functions retrieved from this library are
+     * invalidated. This method does nothing if the library is not
+     * loaded.
+     */
+    void unloadLibrary(const std::string&);
+    /*!
+     * \brief unload and load again a library, for example after its
+     * recompilation.
+     * \param[in] name: name of the library
+     * \note all the functions retrieved from this library are
+     * invalidated.
+     */
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    HINSTANCE__* reloadLibrary(const std::string&);
+#else
+    void* reloadLibrary(const std::string&);
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
        /*!
         * \return the path of a library
         * \param[in] l: library name
@@ -566,6 +596,14 @@ namespace tfel::system {
      */
     GenericMaterialPropertyPtr getGenericMaterialProperty(const std::string&,
                                                           const std::string&);
+    /*!
+     * \return the array entry point of a material property generated
+     * through the `generic` interface
+     * \param[in] l : name of the library
+     * \param[in] f : law name
+     */
+    GenericMaterialPropertyArrayPtr getGenericMaterialPropertyArrayFunction(
+        const std::string&, const std::string&);
     /*!
      * \param[in] l: name of the library
      * \param[in] f: function name
@@ -1461,12 +1499,35 @@ namespace tfel::system {
                                             const std::string&,
                                             const std::string&,
                                             const std::string&);
+    /*!
+     * \brief decode the metadata exported by `MFront` in a single symbol
+     * for the given entry point and modelling hypothesis, if any, and
+     * store the names and types of the variables in the caches.
+     * \return true if the metadata were available
+     * \param[in] l: library
+     * \param[in] f: entry point
+     * \param[in] h: modelling hypothesis
+     */
+    TFEL_VISIBILITY_LOCAL bool decodeMetadata(const std::string&,
+                                              const std::string&,
+                                              const std::string&);
 
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
     std::map<std::string, HINSTANCE__*> librairies;
 #else
     std::map<std::string, void*> librairies;
 #endif /* LIB_EXTERNALLIBRARYMANAGER_HXX */
+    //! \brief cached names of variables, indexed by a key built from
+    //! the library, the entry point, the modelling hypothesis and the
+    //! name of the array
+    std::map<std::string, std::vector<std::string>> cached_names;
+    //! \brief cached types of variables
+    std::map<std::string, std::vector<int>> cached_types;
+    //! \brief entry points whose metadata have been looked for, associated
+    //! with a boolean stating if the metadata were available
+    std::map<std::string, bool> decoded_metadata;
+    //! \brief mutex protecting the loaded libraries and the caches
+    mutable std::shared_mutex mutex;
 
   };  // end of struct LibraryManager
 
@@ -15,6 +15,9 @@
 #define LIB_TFEL_SYSTEM_PROCESSMANAGER_HXX
 
 #include <map>
+#include <chrono>
+#include <future>
+#include <memory>
 #include <string>
 #include <vector>
 #include <signal.h>
@@ -50,6 +53,54 @@ namespace tfel::system {
     };  // end of struct Command
 
     enum RedirectionType { None, StdIn, StdOut, StdInAndOut };
+    //! \brief description of a command executed asynchronously
+    struct TFELSYSTEM_VISIBILITY_EXPORT AsynchronousCommand {
+      /*!
+       * \brief command to be executed. The first word is the program
+       * name, the others its arguments.
+       */
+      std::string command;
+      /*!
+       * \brief name of a file to which the standard input is redirected.
+       * If empty, the standard input is redirected to `/dev/null`.
+       */
+      std::string input_file;
+      //! \brief additionnal environment variables
+      std::map<std::string, std::string> environment;
+      //! \brief maximum execution time (no limit if null)
+      std::chrono::milliseconds timeout = std::chrono::milliseconds{0};
+    };  // end of struct AsynchronousCommand
+    //! \brief result of a command executed asynchronously
+    struct TFELSYSTEM_VISIBILITY_EXPORT AsynchronousCommandResult {
+      //! \return true if the process exited normally with `EXIT_SUCCESS`
+      bool succeeded() const;
+      //! \brief executed command
+      std::string command;
+      //! \brief standard output of the process
+      std::string output;
+      //! \brief standard error of the process
+      std::string error;
+      //! \brief true if the process exited normally
+      bool exitStatus = false;
+      //! \brief exit value of the process, if it exited normally
+      int exitValue = -1;
+      //! \brief true if the process has been killed after its timeout
+      bool timedOut = false;
+      //! \brief true if the command has been cancelled
+      bool cancelled = false;
+    };  // end of struct AsynchronousCommandResult
+    //! \brief a simple alias
+    using AsynchronousCommandId = std::size_t;
+    //! \brief handle to a command executed asynchronously
+    struct AsynchronousCommandHandle {
+      //! \brief identifier of the command, used to cancel it
+      AsynchronousCommandId id;
+      /*!
+       * \brief result of the command. An exception is stored in the
+       * future if the process can't be launched.
+       */
+      std::future<AsynchronousCommandResult> result;
+    };  // end of struct AsynchronousCommandHandle
 
     ProcessManager();
 
@@ -111,6 +162,35 @@ namespace tfel::system {
     virtual ProcessId createProcess(ProcessManager::Command&);
 
     virtual void wait(const ProcessId);
+    /*!
+     * \brief execute a command asynchronously.
+     *
+     * The command is queued and launched as soon as the number of
+     * running asynchronous commands is lower than the maximum number of
+     * concurrent commands. Its standard output and standard error are
+     * captured through pipes.
+     *
+     * \param[in] c: command
+     * \return a handle to the command
+     */
+    virtual AsynchronousCommandHandle executeAsynchronously(
+        const AsynchronousCommand&);
+    /*!
+     * \brief set the maximum number of asynchronous commands executed
+     * concurrently. By default, this number is the number of hardware
+     * threads.
+     * \param[in] n: maximum number of concurrent commands
+     */
+    virtual void setMaximumNumberOfConcurrentCommands(const std::size_t);
+    /*!
+     * \brief cancel an asynchronous command. If the command is running,
+     * the associated process is killed. This method does nothing if the
+     * command is already finished.
+     * \param[in] id: identifier of the command
+     */
+    virtual void cancel(const AsynchronousCommandId);
+    //! \brief wait for all asynchronous commands to be finished
+    virtual void waitAsynchronousCommands();
 
     /*!
      * destructor.
@@ -122,6 +202,11 @@ namespace tfel::system {
     virtual void cleanUp();
 
    private:
+    //! \brief structure handling the asynchronous commands
+    struct AsynchronousCommandsHandler;
+    //! \return the handler of the asynchronous commands, created on demand
+    TFEL_VISIBILITY_LOCAL AsynchronousCommandsHandler&
+    getAsynchronousCommandsHandler();
     struct TFEL_VISIBILITY_LOCAL Process {
       ProcessId id;
       bool isRunning;
@@ -169,6 +254,8 @@ namespace tfel::system {
         const ProcessId) const;
 
     std::vector<Process> processes;
+    //! \brief handler of the asynchronous commands
+    std::unique_ptr<AsynchronousCommandsHandler> asynchronous_commands;
 
     StreamMap inputs;
     StreamMap outputs;
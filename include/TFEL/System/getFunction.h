@@ -100,6 +100,22 @@ double(TFEL_ADDCALL_PTR tfel_getGenericMaterialProperty(
                                            const mfront_gmp_real* const,
                                            const mfront_gmp_size_type,
                                            const mfront_gmp_OutOfBoundsPolicy);
+/*!
+ * \brief this function returns a function of type
+ * `GenericMaterialPropertyArrayPtr`
+ *
+ * \param LibraryHandlerPtr, link to library opened through dlopen
+ * \param const char * const, name of the function to be checked
+ * \return a function pointer if the call succeed, the NULL pointer if not.
+ */
+void(TFEL_ADDCALL_PTR tfel_getGenericMaterialPropertyArrayFunction(
+    LibraryHandlerPtr,
+    const char* const))(mfront_gmp_OutputStatus* const,
+                        mfront_gmp_real* const,
+                        const mfront_gmp_real* const* const,
+                        const mfront_gmp_size_type,
+                        const mfront_gmp_size_type,
+                        const mfront_gmp_OutOfBoundsPolicy);
 /*!
  * \brief return a function generated by the generic behaviour interface
  * \param l: library handler
@@ -0,0 +1,135 @@
+/*!
+ * \file   include/TFEL/Utilities/BinaryData.hxx
+ * \brief  This file declares the classes and functions used to write and
+ * read results in a compact binary format.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_BINARYDATA_HXX
+#define LIB_TFEL_UTILITIES_BINARYDATA_HXX
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstddef>
+#include <string_view>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief header of a binary data file.
+   *
+   * A binary data file is made of:
+   *
+   * - a header starting with the `TFEL-BINARY-DATA` string, followed by
+   *   the version of the format, a marker used to detect the endianness,
+   *   the precision used to convert the values to text, the number of
+   *   columns, the legend and the unit of each column and the preamble.
+   * - a list of chunks. Each chunk starts with the number of rows it
+   *   contains, followed by the values of each column, stored
+   *   contiguously.
+   *
+   * Integers are stored on 32 bits (except the number of rows in a chunk
+   * which is stored on 64 bits) and values are stored as double
+   * precision floatting point numbers, using the endianness of the
+   * computer on which the file was written.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT BinaryDataHeader {
+    //! \brief legends of the columns
+    std::vector<std::string> legends;
+    //! \brief units of the columns (may be empty)
+    std::vector<std::string> units;
+    //! \brief description of the file, as a list of lines
+    std::vector<std::string> preamble;
+    //! \brief number of digits used to convert values to text, if positive
+    int precision = -1;
+  };  // end of struct BinaryDataHeader
+
+  /*!
+   * \brief class used to write a binary data file.
+   *
+   * Rows are buffered and written by chunks. The last chunk is written
+   * when the `flush` method is called or when the writer is destroyed.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT BinaryDataWriter {
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     * \param[in] h: header
+     * \param[in] n: maximum number of rows in a chunk
+     */
+    BinaryDataWriter(const std::string&,
+                     const BinaryDataHeader&,
+                     const std::size_t = 1024);
+    /*!
+     * \brief append a row
+     * \param[in] r: values
+     */
+    void write(const std::vector<double>&);
+    //! \brief write the buffered rows and flush the file
+    void flush();
+    //! \brief destructor
+    ~BinaryDataWriter();
+
+   private:
+    BinaryDataWriter() = delete;
+    BinaryDataWriter(BinaryDataWriter&&) = delete;
+    BinaryDataWriter(const BinaryDataWriter&) = delete;
+    BinaryDataWriter& operator=(BinaryDataWriter&&) = delete;
+    BinaryDataWriter& operator=(const BinaryDataWriter&) = delete;
+    //! \brief write the buffered rows
+    void writeChunk();
+    //! \brief output file
+    std::ofstream out;
+    //! \brief buffered values, stored by columns
+    std::vector<double> buffer;
+    //! \brief number of columns
+    std::size_t ncolumns;
+    //! \brief maximum number of rows in a chunk
+    std::size_t chunk_size;
+    //! \brief number of buffered rows
+    std::size_t nrows = 0;
+  };  // end of struct BinaryDataWriter
+
+  /*!
+   * \return true if the given data are in the binary data format
+   * \param[in] d: data
+   */
+  TFELUTILITIES_VISIBILITY_EXPORT bool isBinaryData(const std::string_view);
+  /*!
+   * \return true if the given file is a binary data file
+   * \param[in] f: file name
+   */
+  TFELUTILITIES_VISIBILITY_EXPORT bool isBinaryDataFile(const std::string&);
+  /*!
+   * \brief decode data in the binary data format
+   * \return the header
+   * \param[out] columns: values, stored by columns
+   * \param[in] d: data
+   *
+   * \note a truncated chunk at the end of the data, as may result from
+   * an interrupted computation, is ignored.
+   */
+  TFELUTILITIES_VISIBILITY_EXPORT BinaryDataHeader
+  decodeBinaryData(std::vector<std::vector<double>>&, const std::string_view);
+  /*!
+   * \brief convert a binary data file to the text format used by `mtest`
+   * and `ptest`: the preamble is written as comments and the values of
+   * each row are separated by spaces.
+   * \param[in] i: input file
+   * \param[in] o: output file
+   */
+  TFELUTILITIES_VISIBILITY_EXPORT void convertBinaryDataFileToText(
+      const std::string&, const std::string&);
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_BINARYDATA_HXX */
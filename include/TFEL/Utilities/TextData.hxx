@@ -14,8 +14,12 @@
 #ifndef LIB_TFEL_UTILITIES_TEXTDATA_HXX
 #define LIB_TFEL_UTILITIES_TEXTDATA_HXX
 
+#include <map>
+#include <mutex>
 #include <vector>
 #include <string>
+#include <utility>
+#include <string_view>
 
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Utilities/Token.hxx"
@@ -24,6 +28,21 @@ namespace tfel::utilities {
 
   /*!
    * \brief class in charge of reading data in a text file
+   *
+   * The file is mapped in memory (when supported by the system) and
+   * the values are decoded once, while reading the file, in contiguous
+   * arrays stored by columns. Large files are decoded in parallel.
+   *
+   * All the columns are decoded eagerly rather than when first
+   * requested: decoding a column lazily would require to scan the
+   * whole file again for each column, or to keep the file mapped
+   * for the lifetime of the object, whereas all the values are
+   * located by the first and only pass over the file.
+   *
+   * Conversion errors are only reported when the associated column is
+   * requested. The tokens of each line, returned by the `begin` and
+   * `end` methods, are only built on demand for compatibility with
+   * previous versions.
    */
   struct TFELUTILITIES_VISIBILITY_EXPORT TextData {
     //! a simple alias
@@ -107,13 +126,40 @@ namespace tfel::utilities {
     void skipLines(const Token::size_type);
 
    private:
+    /*!
+     * \brief decode the content of a file in the binary data format
+     * \param[in] c: content of the file
+     */
+    void decodeBinaryData(const std::string_view);
+    //! \brief build the lines of the file
+    void buildLines() const;
     TextData() = delete;
     TextData(TextData&&) = delete;
     TextData(const TextData&) = delete;
     TextData& operator=(TextData&&) = delete;
     TextData& operator=(const TextData&) = delete;
-    //! list of all tokens of the file, sorted by line
-    std::vector<Line> lines;
+    //! \brief file name
+    std::string file;
+    //! \brief file format
+    std::string format;
+    //! \brief if true, the file is in the binary data format
+    bool binary = false;
+    //! \brief values, stored by columns
+    std::vector<std::vector<double>> columns;
+    //! \brief line number of each row of values
+    std::vector<size_type> line_numbers;
+    //! \brief number of values of each row
+    std::vector<size_type> row_sizes;
+    //! \brief values that could not be converted to double, indexed by
+    //! the row and the column
+    std::map<std::pair<size_type, size_type>, std::string> invalid_values;
+    //! \brief lines whose number is lower than this value are skipped
+    size_type first_line = 0;
+    //! \brief list of all tokens of the file, sorted by line, built on
+    //! demand
+    mutable std::vector<Line> lines;
+    //! \brief flag used to build the lines only once
+    mutable std::once_flag lines_flag;
     //! list of column titles
     std::vector<std::string> legends;
     //! first commented lines
@@ -49,14 +49,29 @@ namespace tfel::utilities {
           const size_type,
           const size_type,
           const TokenFlag = Standard);
+    /*!
+     * \brief constructor
+     * \param[in] v: token value
+     * \param[in] l: line number
+     * \param[in] o: offset
+     * \param[in] f: token flag
+     */
+    Token(std::string&&,
+          const size_type,
+          const size_type,
+          const TokenFlag = Standard);
     //! copy constructor
     Token(const Token&);
-    //! move constructor
-    Token(Token&&);
+    /*!
+     * \brief move constructor
+     * \note this constructor is `noexcept` so that containers of tokens
+     * move their elements rather than copying them when growing.
+     */
+    Token(Token&&) noexcept;
     //! assignement
     Token& operator=(const Token&);
     //! move assignement
-    Token& operator=(Token&&);
+    Token& operator=(Token&&) noexcept;
     //! destructor
     ~Token() noexcept;
     //! string holded by the token
@@ -11,8 +11,10 @@
  * project under specific licensing conditions.
  */
 
+#include <map>
 #include <regex>
 #include <cstdlib>
+#include <filesystem>
 #include <iostream>
 #include <algorithm>
 #include <stdexcept>
@@ -21,14 +23,16 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/Utilities/ArgumentParserBase.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
+#include "TFEL/System/EntryPointsIndex.hxx"
 
 struct MFM : public tfel::utilities::ArgumentParserBase<MFM> {
   MFM(const int argc, const char* const* const argv)
       : tfel::utilities::ArgumentParserBase<MFM>(argc, argv) {
-    using tfel::system::ExternalLibraryManager;
-    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
     this->registerCommandLineCallBacks();
     this->parseArguments();
+    for (const auto& l : this->libraries) {
+      this->treatLibrary(l);
+    }
     for (const auto& f : this->filters) {
       auto p =
           std::remove_if(this->epts.begin(), this->epts.end(),
@@ -42,11 +46,7 @@ struct MFM : public tfel::utilities::ArgumentParserBase<MFM> {
         std::cout << "- " << e.name;
       }
       if (this->show_sources) {
-        try {
-          std::cout << " (" << elm.getSource(e.library, e.name) << ')';
-        } catch (std::exception&) {
-          std::cout << " (undetermined source file)";
-        }
+        std::cout << " (" << e.source << ')';
       }
       std::cout << '\n';
     }
@@ -64,6 +64,9 @@ struct MFM : public tfel::utilities::ArgumentParserBase<MFM> {
     std::string library;
     std::string name;
     MaterialKnowledgeType type;
+    std::string material;
+    std::string interface;
+    std::string source;
   };  // end of EntryPoint
 
   struct Filter {
@@ -130,35 +133,12 @@ struct MFM : public tfel::utilities::ArgumentParserBase<MFM> {
       }
     };
     auto interface_filter = [this](const EntryPoint& e, const std::string& i) {
-      using tfel::system::ExternalLibraryManager;
-      auto& elm = ExternalLibraryManager::getExternalLibraryManager();
       std::regex r(i, this->rs | std::regex_constants::icase);
-      auto b = false;
-      try {
-        b = std::regex_match(elm.getInterface(e.library, e.name), r);
-      } catch (std::exception& ex) {
-        if (vlevel >= VERBOSE_DEBUG) {
-          std::clog << "Error while retrieving interface for '" + e.name + "'"
-                    << " in library '" + e.library + "' (" << ex.what()
-                    << ")\n";
-        }
-      }
-      return b;
+      return std::regex_match(e.interface, r);
     };
     auto material_filter = [this](const EntryPoint& e, const std::string& m) {
-      using tfel::system::ExternalLibraryManager;
-      auto& elm = ExternalLibraryManager::getExternalLibraryManager();
       std::regex r(m, this->rs | std::regex_constants::icase);
-      auto b = false;
-      try {
-        b = std::regex_match(elm.getMaterial(e.library, e.name), r);
-      } catch (std::exception& ex) {
-        if (vlevel >= VERBOSE_DEBUG) {
-          std::clog << "Error while retrieving material for '" + e.name + "'"
-                    << " in library '" + e.library + "'(" << ex.what() << ")\n";
-        }
-      }
-      return b;
+      return std::regex_match(e.material, r);
     };
     auto name_filter = [this](const EntryPoint& e, const std::string& n) {
       std::regex r(n, this->rs | std::regex_constants::icase);
@@ -195,6 +175,14 @@ struct MFM : public tfel::utilities::ArgumentParserBase<MFM> {
         type_filter);
     this->registerCallBack(
         "--verbose", CallBack("set verbose output", set_verbose_level, true));
+    this->registerCallBack(
+        "--use-index",
+        CallBack(
+            "use the index of the entry points of the directories "
+            "containing the libraries. This index is created or updated "
+            "if needed. A directory can be given instead of a library: "
+            "all the libraries of this directory are then considered",
+            [this]() noexcept { this->use_index = true; }, false));
     this->registerCallBack(
         "--show-libs",
         CallBack(
@@ -214,40 +202,77 @@ struct MFM : public tfel::utilities::ArgumentParserBase<MFM> {
   }
 
   void treatUnknownArgument() override {
-    using namespace tfel::system;
-    auto throw_if = [](const bool c, const std::string& m) {
-      tfel::raise_if(c, "mfm: " + m);
-    };
-    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
     const auto& a = this->getCurrentCommandLineArgument();
     //    const auto& l = static_cast<const std::string&>(a);
     const auto& l = a.as_string();
     if (l.empty()) {
       return;
     }
-    throw_if(l[0] == '-', "unsupported option '" + l + "'");
+    tfel::raise_if(l[0] == '-', "mfm: unsupported option '" + l + "'");
+    this->libraries.push_back(l);
+  }  // end of treatUnknownArgument
+  /*!
+   * \return the descriptions of the entry points of a library or, if the
+   * index is used, of a directory
+   * \param[in] l: library or directory
+   */
+  std::vector<tfel::system::EntryPointDescription>
+  getEntryPointsDescriptions(const std::string& l) {
+    namespace fs = std::filesystem;
+    using namespace tfel::system;
+    if (!this->use_index) {
+      return tfel::system::getEntryPointsDescriptions(l);
+    }
+    const auto is_directory = fs::is_directory(l);
+    const auto d = is_directory ? fs::path(l) : fs::path(l).parent_path();
+    const auto ds = d.empty() ? std::string(".") : d.string();
+    auto p = this->indexes.find(ds);
+    if (p == this->indexes.end()) {
+      p = this->indexes.insert({ds, getIndexedEntryPointsDescriptions(ds)})
+              .first;
+    }
+    if (is_directory) {
+      return p->second;
+    }
+    auto r = std::vector<EntryPointDescription>{};
+    const auto f = fs::path(l).filename();
+    for (const auto& e : p->second) {
+      if (fs::path(e.library).filename() == f) {
+        r.push_back(e);
+        // the library is reported as given by the user
+        r.back().library = l;
+      }
+    }
+    return r;
+  }  // end of getEntryPointsDescriptions
+
+  void treatLibrary(const std::string& l) {
+    auto throw_if = [](const bool c, const std::string& m) {
+      tfel::raise_if(c, "mfm: " + m);
+    };
     if (vlevel >= VERBOSE_LEVEL1) {
       std::clog << "Treating library '" << l << "'\n";
     }
     try {
-      const auto enames = elm.getEntryPoints(l);
-      for (const auto& en : enames) {
+      for (const auto& d : this->getEntryPointsDescriptions(l)) {
         EntryPoint ep;
-        ep.library = l;
-        ep.name = en;
-        const auto et = elm.getMaterialKnowledgeType(l, en);
-        if (et == 0u) {
+        ep.library = d.library;
+        ep.name = d.name;
+        if (d.type == 0u) {
           ep.type = EntryPoint::MATERIALPROPERTY;
-        } else if (et == 1u) {
+        } else if (d.type == 1u) {
           ep.type = EntryPoint::BEHAVIOUR;
         } else {
-          throw_if(et != 2u,
+          throw_if(d.type != 2u,
                    "internal error "
                    "(invalid material knowledge type)");
           ep.type = EntryPoint::MODEL;
         }
+        ep.material = d.material;
+        ep.interface = d.interface;
+        ep.source = d.source;
         if (vlevel >= VERBOSE_DEBUG) {
-          std::clog << "Adding '" + en + "' from '" + l + "'\n";
+          std::clog << "Adding '" + d.name + "' from '" + d.library + "'\n";
         }
         this->epts.push_back(std::move(ep));
       }
@@ -257,7 +282,7 @@ struct MFM : public tfel::utilities::ArgumentParserBase<MFM> {
                   << "'\n";
       }
     }
-  }  // end of treatUnknownArgument
+  }  // end of treatLibrary
 
   std::string getVersionDescription() const override { return "1.0"; }
 
@@ -280,6 +305,11 @@ struct MFM : public tfel::utilities::ArgumentParserBase<MFM> {
   };  // end of enum VerboseLevel
 
   std::vector<Filter> filters;
+  //! \brief libraries (or directories) given on the command line
+  std::vector<std::string> libraries;
+  //! \brief descriptions of the entry points of the indexed directories
+  std::map<std::string, std::vector<tfel::system::EntryPointDescription>>
+      indexes;
 
   std::vector<EntryPoint> epts;
 
@@ -291,6 +321,8 @@ struct MFM : public tfel::utilities::ArgumentParserBase<MFM> {
   bool show_libs = false;
 
   bool show_sources = false;
+
+  bool use_index = false;
 };
 
 int main(const int argc, const char* const* const argv) {
@@ -0,0 +1,61 @@
+# This script checks that the output of `mfm` is the same with and
+# without the `--use-index` option. The library is copied in a dedicated
+# directory in which the index is created.
+
+# arguments checking
+if(NOT TEST_PROGRAM)
+  message(FATAL_ERROR "Require TEST_PROGRAM to be defined")
+endif(NOT TEST_PROGRAM)
+if(NOT LIBRARY)
+  message(FATAL_ERROR "Require LIBRARY to be defined")
+endif(NOT LIBRARY)
+if(NOT WORKING_DIRECTORY)
+  message(FATAL_ERROR "Require WORKING_DIRECTORY to be defined")
+endif(NOT WORKING_DIRECTORY)
+
+file(REMOVE_RECURSE "${WORKING_DIRECTORY}")
+file(MAKE_DIRECTORY "${WORKING_DIRECTORY}")
+get_filename_component(name "${LIBRARY}" NAME)
+set(library "${WORKING_DIRECTORY}/${name}")
+configure_file("${LIBRARY}" "${library}" COPYONLY)
+
+# run mfm and return its output
+function(run_mfm output)
+  execute_process(
+    COMMAND ${TEST_PROGRAM} ${ARGN}
+    OUTPUT_VARIABLE test_output
+    ERROR_VARIABLE test_error
+    RESULT_VARIABLE test_result)
+  if(test_result)
+    message(FATAL_ERROR "Failed: mfm ${ARGN} exited != 0.\n${test_error}")
+  endif(test_result)
+  set(${output} "${test_output}" PARENT_SCOPE)
+endfunction(run_mfm)
+
+run_mfm(reference --show-libs "${library}")
+if(reference STREQUAL "")
+  message(FATAL_ERROR "Failed: no entry point found in '${library}'")
+endif(reference STREQUAL "")
+# the first call creates the index, the second one reads it
+foreach(step "creation of the index" "reading of the index")
+  run_mfm(output --use-index --show-libs "${library}")
+  if(NOT EXISTS "${WORKING_DIRECTORY}/.tfel-entry-points-index")
+    message(FATAL_ERROR "Failed: the index was not created")
+  endif(NOT EXISTS "${WORKING_DIRECTORY}/.tfel-entry-points-index")
+  if(NOT output STREQUAL reference)
+    message(FATAL_ERROR "Failed: the outputs of mfm with and without "
+      "the index differ (${step}).\nWithout the index:\n${reference}\n"
+      "With the index:\n${output}")
+  endif(NOT output STREQUAL reference)
+endforeach()
+# listing the whole directory
+run_mfm(reference "${library}")
+run_mfm(output --use-index "${WORKING_DIRECTORY}")
+if(NOT output STREQUAL reference)
+  message(FATAL_ERROR "Failed: the outputs of mfm with and without "
+    "the index differ (directory).\nWithout the index:\n${reference}\n"
+    "With the index:\n${output}")
+endif(NOT output STREQUAL reference)
+
+# everything went fine...
+message(STATUS "Passed: the outputs of mfm with and without the index match")
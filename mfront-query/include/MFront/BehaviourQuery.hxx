@@ -54,8 +54,13 @@ namespace mfront {
                    const std::string&);
     //! \brief return the number of queries to be treated
     std::size_t getNumberOfQueriesToBeTreated();
-    //! \brief treat the requests
+    //! \brief analyse the file and treat the requests
     virtual void exe();
+    /*!
+     * \brief treat the requests, assuming that the file has already been
+     * analysed by the domain specific language.
+     */
+    virtual void treatQueries();
     //! \brief destructor
     ~BehaviourQuery() override;
 
@@ -1303,6 +1303,10 @@ namespace mfront {
     }
     // analysing the file
     this->dsl->analyseFile(this->file, this->ecmds, this->substitutions);
+    this->treatQueries();
+  }  // end of exe
+
+  void BehaviourQuery::treatQueries() {
     const auto& fd = this->dsl->getFileDescription();
     const auto& d = this->dsl->getBehaviourDescription();
     // checks
@@ -1349,7 +1353,7 @@ namespace mfront {
       }
       q.second(fd, d);
     }
-  }  // end of exe
+  }  // end of treatQueries
 
   void BehaviourQuery::treatDSLTarget() {
     std::cout << "behaviour" << std::endl;
@@ -386,6 +386,10 @@ namespace mfront {
     }
     // analysing the file
     this->dsl->analyseFile(this->file, this->ecmds, this->substitutions);
+    this->treatQueries();
+  }  // end of exe
+
+  void MaterialPropertyQuery::treatQueries() {
     const auto& fd = this->dsl->getFileDescription();
     const auto& d = this->dsl->getMaterialPropertyDescription();
     // treating the queries
@@ -395,7 +399,7 @@ namespace mfront {
       }
       q.second(fd, d);
     }
-  }  // end of exe
+  }  // end of treatQueries
 
   void MaterialPropertyQuery::treatDSLTarget() {
     std::cout << "material property" << std::endl;
@@ -241,6 +241,10 @@ namespace mfront {
     }
     // analysing the file
     this->dsl->analyseFile(this->file, this->ecmds, this->substitutions);
+    this->treatQueries();
+  }  // end of exe
+
+  void ModelQuery::treatQueries() {
     const auto& fd = this->dsl->getFileDescription();
     const auto& d = this->dsl->getModelDescription();
     // treating the queries
@@ -250,7 +254,7 @@ namespace mfront {
       }
       q.second(fd, d);
     }
-  }  // end of exe
+  }  // end of treatQueries
 
   void ModelQuery::treatDSLTarget() {
     std::cout << "model" << std::endl;
@@ -21,8 +21,10 @@
 #endif /* small */
 #endif /* __CYGWIN__ */
 
+#include <map>
 #include <regex>
 #include <string>
+#include <fstream>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
@@ -398,6 +400,152 @@ static void treatHasQuery(
   std::cout << "false" << std::endl;
 }  // end of treatHasQuery
 
+/*!
+ * \brief a file analysed in batch mode
+ */
+struct BatchAnalysedFile {
+  //! \brief domain specific language used to analyse the file
+  std::shared_ptr<mfront::AbstractDSL> dsl;
+  //! \brief boolean stating if the file has been analysed
+  bool analysed = false;
+};  // end of struct BatchAnalysedFile
+
+/*!
+ * \return if the given argument is an option which affects the analysis
+ * of a file, as opposed to a query.
+ * \param[in] a: argument
+ */
+static bool isBatchAnalysisOption(const std::string& a) {
+  using tfel::utilities::starts_with;
+#ifdef _WIN32
+  if (starts_with(a, "--@") || starts_with(a, "/@")) {
+#else  /* _WIN32 */
+  if (starts_with(a, "--@")) {
+#endif /* _WIN32 */
+    // external commands and substitutions
+    return true;
+  }
+  const auto n = a.substr(0, a.find('='));
+  for (const auto o :
+       {"--dsl-option", "--dsl-material-property-option",
+        "--dsl-behaviour-option", "--dsl-model-option", "--dsl-options-file",
+        "--dsl-material-property-options-file",
+        "--dsl-behaviour-options-file", "--dsl-model-options-file",
+        "--include", "-I", "--search-path", "--madnex-search-path",
+        "--install-path", "--install-prefix", "--nomelt", "--interface",
+        "--material", "--material-property", "--behaviour", "--model",
+        "--warning", "-W", "--pedantic"}) {
+    if (n == o) {
+      return true;
+    }
+  }
+  return false;
+}  // end of isBatchAnalysisOption
+
+/*!
+ * \brief treat a request in batch mode
+ * \param[in] f: analysed file
+ * \param[in] args: query arguments
+ * \param[in] file: file name
+ */
+template <typename QueryType, typename DSLType>
+static void treatBatchRequest(BatchAnalysedFile& f,
+                              const std::vector<const char*>& args,
+                              const std::string& file) {
+  auto dsl = std::dynamic_pointer_cast<DSLType>(f.dsl);
+  tfel::raise_if(!dsl, "mfront-query: invalid dsl implementation");
+  // the interfaces declared by the request are given to the dsl by the
+  // query constructor. If the file has already been analysed, those
+  // interfaces are the ones used by the analysis, since the analysed
+  // files are identified by the options of the request.
+  auto q = QueryType(static_cast<int>(args.size()), args.data(), dsl, file);
+  if (f.analysed) {
+    q.treatQueries();
+  } else {
+    q.exe();
+    f.analysed = true;
+  }
+}  // end of treatBatchRequest
+
+/*!
+ * \brief treat the requests read from a stream.
+ *
+ * Each line contains a file name followed by the queries to be treated
+ * on this file. Empty lines and lines starting with `#` are ignored.
+ * Each file is only analysed once for a given set of options affecting
+ * the analysis (interfaces, substitutions, external commands, options
+ * passed to the domain specific languages, etc.). The answers of a
+ * request are followed by a line `%% ok` or by a line `%% error: `
+ * followed by the error message.
+ *
+ * \param[in] in: input stream
+ * \param[in] args: arguments given on the command line
+ * \return true if all the requests succeeded
+ */
+static bool treatBatchRequests(std::istream& in,
+                               const std::vector<const char*>& args) {
+  using namespace mfront;
+  auto files = std::map<std::string, BatchAnalysedFile>{};
+  auto success = true;
+  auto line = std::string{};
+  while (std::getline(in, line)) {
+    auto tokens = std::vector<std::string>{};
+    for (const auto& t : tfel::utilities::tokenize(line, ' ')) {
+      if (!t.empty()) {
+        tokens.push_back(t);
+      }
+    }
+    if ((tokens.empty()) || (tokens[0][0] == '#')) {
+      continue;
+    }
+    const auto& file = tokens[0];
+    try {
+      auto rargs = args;
+      // the analysed files are identified by their names and by the
+      // options of the request affecting their analysis
+      auto key = file;
+      for (auto p = std::next(tokens.begin()); p != tokens.end(); ++p) {
+        rargs.push_back(p->c_str());
+        if (isBatchAnalysisOption(*p)) {
+          key += '\n' + *p;
+        }
+      }
+      auto p = files.find(key);
+      if (p == files.end()) {
+        SearchPathsHandler::addSearchPathsFromImplementationPaths({file});
+        p = files.insert({key, BatchAnalysedFile{MFrontBase::getDSL(file)}})
+                .first;
+      }
+      auto& f = p->second;
+      try {
+        const auto t = f.dsl->getTargetType();
+        if (t == AbstractDSL::MATERIALPROPERTYDSL) {
+          treatBatchRequest<MaterialPropertyQuery, MaterialPropertyDSL>(
+              f, rargs, file);
+        } else if (t == AbstractDSL::BEHAVIOURDSL) {
+          treatBatchRequest<BehaviourQuery, AbstractBehaviourDSL>(f, rargs,
+                                                                  file);
+        } else if (t == AbstractDSL::MODELDSL) {
+          treatBatchRequest<ModelQuery, ModelDSL>(f, rargs, file);
+        } else {
+          tfel::raise("mfront-query: unsupported dsl type");
+        }
+      } catch (...) {
+        if (!f.analysed) {
+          // the state of the dsl is unspecified
+          files.erase(p);
+        }
+        throw;
+      }
+      std::cout << "%% ok" << std::endl;
+    } catch (std::exception& e) {
+      std::cout << "%% error: " << e.what() << std::endl;
+      success = false;
+    }
+  }
+  return success;
+}  // end of treatBatchRequests
+
 #ifdef MFRONT_QUERY_HAVE_MADNEX
 
 static bool treatListMaterialKnowledge(bool& b,
@@ -501,6 +649,8 @@ int main(const int argc, const char* const* const argv) {
     auto current_path_specifier = mfront::PathSpecifier{};
     auto path_specifiers = std::vector<mfront::PathSpecifier>{};
     auto queries_arguments = std::vector<const char*>{};
+    auto batch = false;
+    auto batch_file = std::string{};
 #ifdef MFRONT_QUERY_HAVE_MADNEX
     auto list_materials = false;
     auto list_implementation_paths = false;
@@ -547,7 +697,10 @@ int main(const int argc, const char* const* const argv) {
                   << "--help-behaviour-queries-list            : "
                   << "list all queries avaiable for behaviour files\n"
                   << "--help-model-queries-list                : "
-                  << "list all queries avaiable for model files\n";
+                  << "list all queries avaiable for model files\n"
+                  << "--batch                                  : "
+                  << "read requests from the standard input or from the "
+                  << "file given after the `=` sign\n";
 #ifdef MFRONT_QUERY_HAVE_MADNEX
         std::cout << "--material                               : "
                   << "specify a material (regular expression)\n"
@@ -592,6 +745,13 @@ int main(const int argc, const char* const* const argv) {
       } else if (a == "--usage") {
         std::cout << "Usage : " << argv[0] << " [options] [files]\n";
         std::exit(EXIT_SUCCESS);
+      } else if (a == "--batch") {
+        batch = true;
+      } else if (tfel::utilities::starts_with(a, "--batch=")) {
+        batch = true;
+        batch_file = a.substr(std::strlen("--batch="));
+        tfel::raise_if(batch_file.empty(),
+                       "mfront-query: no file specified after --batch=");
       } else if (tfel::utilities::starts_with(a, "--dsl-option=")) {
         MFrontBase::addDSLOption(a.substr(std::strlen("--dsl-option=")));
       } else if (tfel::utilities::starts_with(
@@ -760,6 +920,19 @@ int main(const int argc, const char* const* const argv) {
     }
 #endif /* MFRONT_QUERY_HAVE_MADNEX */
     //
+    if (batch) {
+      tfel::raise_if(!path_specifiers.empty(),
+                     "mfront-query: no file can be specified on the "
+                     "command line in batch mode");
+      if (batch_file.empty()) {
+        return treatBatchRequests(std::cin, queries_arguments) ? EXIT_SUCCESS
+                                                               : EXIT_FAILURE;
+      }
+      std::ifstream in(batch_file);
+      tfel::raise_if(!in, "mfront-query: can't open file '" + batch_file + "'");
+      return treatBatchRequests(in, queries_arguments) ? EXIT_SUCCESS
+                                                       : EXIT_FAILURE;
+    }
     const auto implementations =
         mfront::getImplementationsPaths(path_specifiers);
     SearchPathsHandler::addSearchPathsFromImplementationPaths(implementations);
@@ -663,6 +663,8 @@ namespace mfront {
     virtual void treatLibrary();
     //! \brief treat the `@Profiling` keyword
     virtual void treatProfiling();
+    //! \brief treat the `@FrozenParameters` keyword
+    virtual void treatFrozenParameters();
     //! \brief treat the `@ModellingHypothesis` keyword
     virtual void treatModellingHypothesis();
     //! \brief treat the `@ModellingHypotheses` keyword
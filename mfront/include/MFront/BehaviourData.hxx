@@ -160,6 +160,19 @@ namespace mfront {
     //! \brief number of evaluation of the computeDerivative method
     //  of a Runge-Kutta algorithm
     static const char* const numberOfEvaluations;
+    /*!
+     * \brief a string attribute giving a boolean expression which, if
+     * true at the beginning of the integration, states that the time step
+     * is most likely elastic. Implicit schemes then check if the elastic
+     * solution satisfies the implicit system before solving it. An empty
+     * string disables this test.
+     *
+     * \note the elastic solution is defined by the fact that the
+     * increment of the elastic strain `eel` is equal to the increment of
+     * the total strain and that the increments of the other integration
+     * variables are null.
+     */
+    static const char* const elasticStepCriterion;
     /*!
      * The description of a stress free expansion defined through an
      * external state variable
@@ -0,0 +1,58 @@
+/*!
+ * \file   mfront/include/MFront/DependenciesRecorder.hxx
+ * \brief  This file declares the DependenciesRecorder class
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_DEPENDENCIESRECORDER_HXX
+#define LIB_MFRONT_DEPENDENCIESRECORDER_HXX
+
+#include <set>
+#include <string>
+#include "MFront/MFrontConfig.hxx"
+
+namespace mfront {
+
+  /*!
+   * \brief a structure recording the files read by the domain specific
+   * languages in the current thread during its lifetime.
+   *
+   * Recorders may be nested: a file read is reported to all the active
+   * recorders of the current thread. For example, the recorder associated
+   * with a behaviour also records the material properties it imports.
+   */
+  struct MFRONT_VISIBILITY_EXPORT DependenciesRecorder {
+    /*!
+     * \brief report that a file has been read to all the active recorders
+     * of the current thread
+     * \param[in] f: file
+     */
+    static void record(const std::string&);
+    //! \brief constructor
+    DependenciesRecorder();
+    //! \return the files recorded
+    const std::set<std::string>& getFiles() const;
+    //! \brief destructor
+    ~DependenciesRecorder();
+
+   private:
+    DependenciesRecorder(DependenciesRecorder&&) = delete;
+    DependenciesRecorder(const DependenciesRecorder&) = delete;
+    DependenciesRecorder& operator=(DependenciesRecorder&&) = delete;
+    DependenciesRecorder& operator=(const DependenciesRecorder&) = delete;
+    //! \brief files recorded
+    std::set<std::string> files;
+    //! \brief previously active recorder
+    DependenciesRecorder* const previous;
+  };  // end of struct DependenciesRecorder
+
+}  // end of namespace mfront
+
+#endif /* LIB_MFRONT_DEPENDENCIESRECORDER_HXX */
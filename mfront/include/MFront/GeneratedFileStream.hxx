@@ -0,0 +1,76 @@
+/*!
+ * \file   mfront/include/MFront/GeneratedFileStream.hxx
+ * \brief  This file declares the GeneratedFileStream class
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERATEDFILESTREAM_HXX
+#define LIB_MFRONT_GENERATEDFILESTREAM_HXX
+
+#include <string>
+#include <sstream>
+#include "MFront/MFrontConfig.hxx"
+
+namespace mfront {
+
+  /*!
+   * \brief an output stream used to write generated files.
+   *
+   * This class can be used as a replacement of `std::ofstream`. The
+   * content of the file is buffered in memory and is only written when
+   * the stream is closed (or destroyed) if it differs from the current
+   * content of the file. Thus, the modification time of generated files
+   * whose content did not change is preserved and build systems do not
+   * recompile them.
+   */
+  struct MFRONT_VISIBILITY_EXPORT GeneratedFileStream : public std::ostream {
+    //! \brief default constructor
+    GeneratedFileStream();
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     */
+    explicit GeneratedFileStream(const std::string&);
+    /*!
+     * \brief open a new file
+     * \param[in] f: file name
+     *
+     * The failbit is set if the file can't be opened for writing or if
+     * the stream is already associated with a file.
+     */
+    void open(const std::string&);
+    //! \return if the stream is associated with a file
+    bool is_open() const;
+    /*!
+     * \brief write the file if its content changed and dissociate the
+     * stream from the file.
+     *
+     * The failbit is set if the file can't be written.
+     */
+    void close();
+    //! \brief destructor
+    ~GeneratedFileStream() override;
+
+   private:
+    GeneratedFileStream(GeneratedFileStream&&) = delete;
+    GeneratedFileStream(const GeneratedFileStream&) = delete;
+    GeneratedFileStream& operator=(GeneratedFileStream&&) = delete;
+    GeneratedFileStream& operator=(const GeneratedFileStream&) = delete;
+    //! \brief buffer
+    std::stringbuf buffer;
+    //! \brief name of the file
+    std::string file;
+    //! \brief boolean stating if the stream is associated with a file
+    bool opened = false;
+  };  // end of struct GeneratedFileStream
+
+}  // end of namespace mfront
+
+#endif /* LIB_MFRONT_GENERATEDFILESTREAM_HXX */
@@ -38,6 +38,22 @@ namespace mfront {
                //   options used are the ones returned by
                //   `tfel-config --oflags --oflags2`.
     };
+    /*!
+     * \brief a simple enumeration describing the stages of a profile
+     * guided optimisation.
+     * \note See the `tfel-config` utility for more details
+     */
+    enum ProfileGuidedOptimisationStage {
+      NOPGO,                //!< no profile guided optimisation
+      PGO_INSTRUMENTATION,  //!< the libraries are instrumented to collect
+                            //   profiles. The options used are the ones
+                            //   returned by `tfel-config
+                            //   --pgo-instrumentation-flags`.
+      PGO_OPTIMISATION      //!< the libraries are optimised using the
+                            //   collected profiles. The options used are
+                            //   the ones returned by `tfel-config
+                            //   --pgo-optimisation-flags`.
+    };
     //! \brief default constructor
     GeneratorOptions();
     /*!
@@ -78,6 +94,8 @@ namespace mfront {
 #endif /* __CYGWIN__ */
     //! \brief optimisation level
     OptimisationLevel olevel = LEVEL1;
+    //! \brief stage of the profile guided optimisation
+    ProfileGuidedOptimisationStage pgo = NOPGO;
     //! \brief add debugging flags
     bool debugFlags = false;
     /*!
@@ -91,6 +109,16 @@ namespace mfront {
     bool nodeps = false;
 #endif /* (defined _WIN32 || defined _WIN64 ||defined __CYGWIN__) */
     bool melt = true;
+    /*!
+     * \brief boolean stating if the `C++` sources of each library shall
+     * be gathered in a few translation units (unity build).
+     */
+    bool unityBuild = false;
+    /*!
+     * \brief boolean stating if the headers commonly used by the
+     * generated sources shall be precompiled.
+     */
+    bool precompiledHeaders = false;
   };  // end of struct GeneratorOptions
 
 }  // end of namespace mfront
@@ -0,0 +1,59 @@
+/*!
+ * \file   mfront/include/MFront/GeneratorUtilities.hxx
+ * \brief  This file declares some utility functions shared by the
+ * generators of build files.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERATORUTILITIES_HXX
+#define LIB_MFRONT_GENERATORUTILITIES_HXX
+
+#include <string>
+#include <cstddef>
+#include "MFront/MFrontConfig.hxx"
+#include "MFront/TargetsDescription.hxx"
+
+namespace mfront {
+
+  //! \return the name of the precompiled header
+  MFRONT_VISIBILITY_EXPORT const char* getPrecompiledHeaderFileName();
+  /*!
+   * \brief write, in the given directory, a header including the
+   * standard and `TFEL` headers commonly used by the generated sources.
+   * This header is meant to be precompiled.
+   * \param[in] d: directory
+   */
+  MFRONT_VISIBILITY_EXPORT void writePrecompiledHeader(const std::string&);
+  /*!
+   * \return the number of jobs used by default to build the libraries,
+   * i.e. the number of hardware threads.
+   */
+  MFRONT_VISIBILITY_EXPORT unsigned int getDefaultNumberOfBuildJobs();
+  /*!
+   * \return a copy of the given targets description where the `C++`
+   * sources of each library are gathered in unity sources, i.e. sources
+   * including at most `n` of the original sources.
+   *
+   * The unity sources of a library named `l` are called
+   * `l-unity-<i>.cxx` and are written in the given directory. `C`
+   * sources are left untouched.
+   *
+   * \param[in] t: targets description
+   * \param[in] d: directory
+   * \param[in] n: maximal number of sources per unity source
+   */
+  MFRONT_VISIBILITY_EXPORT TargetsDescription
+  generateUnityBuildSources(const TargetsDescription&,
+                            const std::string&,
+                            const std::size_t = 8);
+
+}  // end of namespace mfront
+
+#endif /* LIB_MFRONT_GENERATORUTILITIES_HXX */
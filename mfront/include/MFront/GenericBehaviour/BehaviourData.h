@@ -16,6 +16,7 @@
 
 #include "MFront/GenericBehaviour/Types.h"
 #include "MFront/GenericBehaviour/State.h"
+#include "MFront/GenericBehaviour/IntegrationStatistics.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -108,6 +109,15 @@ struct mfront_gb_BehaviourData {
   mfront_gb_InitialState s0;
   //! \brief state at the end of the time step
   mfront_gb_State s1;
+  /*!
+   * \brief pointer to a structure used to store statistics about the
+   * integration of the behaviour.
+   *
+   * \note This pointer can be nullptr. In this case, no statistics is
+   * exported. The caller must ensure thread-safety (i.e. each thread
+   * shall have its own structure).
+   */
+  mfront_gb_IntegrationStatistics* statistics;
 };
 
 #ifdef __cplusplus
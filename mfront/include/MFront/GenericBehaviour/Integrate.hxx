@@ -292,6 +292,45 @@ namespace mfront::gb {
     }
   }  // end of reportFailureByException
 
+  /*!
+   * \brief export the statistics describing the integration of the
+   * behaviour.
+   *
+   * Statistics are retrieved from the behaviour through the following
+   * optional methods: `getNumberOfIterations`, `getResidualNorm`,
+   * `getNumberOfSubSteps`, `getNumberOfRejectedSubSteps` and
+   * `isElasticStep`. Statistics associated with methods not provided
+   * by the behaviour are set to their default values.
+   *
+   * \tparam Behaviour: class implementing the behaviour
+   * \param[out] s: statistics
+   * \param[in] b: behaviour
+   */
+  template <typename Behaviour>
+  void exportIntegrationStatistics(mfront_gb_IntegrationStatistics& s,
+                                   const Behaviour& b) noexcept {
+    s.number_of_iterations = 0;
+    s.residual_norm = 0;
+    s.number_of_substeps = 1;
+    s.number_of_rejected_substeps = 0;
+    s.elastic_step = 0;
+    if constexpr (requires { b.getNumberOfIterations(); }) {
+      s.number_of_iterations = b.getNumberOfIterations();
+    }
+    if constexpr (requires { b.getResidualNorm(); }) {
+      s.residual_norm = static_cast<mfront_gb_real>(b.getResidualNorm());
+    }
+    if constexpr (requires { b.getNumberOfSubSteps(); }) {
+      s.number_of_substeps = b.getNumberOfSubSteps();
+    }
+    if constexpr (requires { b.getNumberOfRejectedSubSteps(); }) {
+      s.number_of_rejected_substeps = b.getNumberOfRejectedSubSteps();
+    }
+    if constexpr (requires { b.isElasticStep(); }) {
+      s.elastic_step = b.isElasticStep() ? 1 : 0;
+    }
+  }  // end of exportIntegrationStatistics
+
   /*!
    * \brief integrate the behaviour over a time step
    * \tparam Behaviour: class implementing the behaviour
@@ -318,6 +357,8 @@ namespace mfront::gb {
     Behaviour b(d);
     b.setOutOfBoundsPolicy(p);
     auto&& rdt = tfel::math::map<behaviour_real_type>(d.rdt);
+    // boolean stating if the integration of the behaviour has started
+    auto integrated = false;
     try {
       if (!b.initialize()) {
         reportError(d, "behaviour initialisation failed");
@@ -361,7 +402,11 @@ namespace mfront::gb {
       if (!tsf.first) {
         return -1;
       }
+      integrated = true;
       const auto r = b.integrate(f, smt);
+      if (d.statistics != nullptr) {
+        exportIntegrationStatistics(*(d.statistics), b);
+      }
       if (r == Behaviour::FAILURE) {
         rdt = b.getMinimalTimeStepScalingFactor();
         return -1;
@@ -387,6 +432,9 @@ namespace mfront::gb {
       }
     } catch (...) {
       reportFailureByException(d);
+      if ((integrated) && (d.statistics != nullptr)) {
+        exportIntegrationStatistics(*(d.statistics), b);
+      }
       rdt = b.getMinimalTimeStepScalingFactor();
       return -1;
     }
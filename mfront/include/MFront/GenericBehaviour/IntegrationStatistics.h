@@ -0,0 +1,65 @@
+/*!
+ * \file   include/MFront/GenericBehaviour/IntegrationStatistics.h
+ * \brief  This file declares the mfront_gb_IntegrationStatistics structure.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with linking exception
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATIONSTATISTICS_H
+#define LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATIONSTATISTICS_H
+
+#include "MFront/GenericBehaviour/Types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * \brief statistics describing the cost of the integration of the
+ * behaviour at one integration point.
+ *
+ * Those statistics are only filled if the behaviour has been integrated,
+ * i.e. they are left unchanged if only the prediction operator is
+ * computed or if the initialisation of the behaviour failed. Statistics
+ * which are not meaningful for the integration algorithm used by the
+ * behaviour are set to their default values.
+ */
+typedef struct {
+  /*!
+   * \brief number of iterations of the non linear solver used by
+   * implicit schemes (0 by default).
+   */
+  mfront_gb_size_type number_of_iterations;
+  /*!
+   * \brief norm of the residual of the implicit system at the end of the
+   * resolution (0 by default).
+   */
+  mfront_gb_real residual_norm;
+  /*!
+   * \brief number of accepted sub-steps used by Runge-Kutta algorithms
+   * (1 by default).
+   */
+  mfront_gb_size_type number_of_substeps;
+  /*!
+   * \brief number of rejected sub-steps used by Runge-Kutta algorithms
+   * (0 by default).
+   */
+  mfront_gb_size_type number_of_rejected_substeps;
+  /*!
+   * \brief a flag stating if the resolution of the implicit system was
+   * skipped since the elastic solution satisfies it (0 by default).
+   */
+  int elastic_step;
+} mfront_gb_IntegrationStatistics;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATIONSTATISTICS_H */
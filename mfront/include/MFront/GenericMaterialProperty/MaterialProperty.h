@@ -36,6 +36,24 @@ typedef mfront_gmp_real(
     const mfront_gmp_size_type,           // number of arguments
     const mfront_gmp_OutOfBoundsPolicy);  // out of bounds policy
 
+/*!
+ * \brief a simple alias to the array entry point of a material property.
+ *
+ * The array entry point evaluates the material property at a set of
+ * points. The arguments are given as a structure of arrays: the i-th
+ * element of the array of arguments points to the values of the i-th
+ * argument at all points. The output status is aggregated over all the
+ * points.
+ */
+typedef void(
+    GENERIC_MATERIALPROPERTY_ADDCALL_PTR mfront_gmp_MaterialPropertyArrayPtr)(
+    mfront_gmp_OutputStatus* const,       // output status
+    mfront_gmp_real* const,               // outputs
+    const mfront_gmp_real* const* const,  // arguments
+    const mfront_gmp_size_type,           // number of arguments
+    const mfront_gmp_size_type,           // number of points
+    const mfront_gmp_OutOfBoundsPolicy);  // out of bounds policy
+
 #ifdef __cplusplus
 }  // end of extern "C"
 #endif /* __cplusplus */
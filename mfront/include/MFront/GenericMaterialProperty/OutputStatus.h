@@ -50,7 +50,7 @@ typedef struct {
    *   `strerrno` is returned. Note that the `errno` value is always reset to
    *   the  value it had before the call.
    * - If the exit status is -4, the computed value is invalid (either \nan`,
-   *   `inf`, or `-inf`).
+   *   `inf`, or `-inf`) and no error was reported by the `C` library.
    * - If the exit status is -5, the number of arguments is invalid.
    */
   int status;
@@ -14,6 +14,7 @@
 #ifndef LIB_MFRONT_GENERICMATERIALPROPERTYINTERFACEBASE_HXX
 #define LIB_MFRONT_GENERICMATERIALPROPERTYINTERFACEBASE_HXX
 
+#include <iosfwd>
 #include <string>
 #include "TFEL/Utilities/CxxTokenizer.hxx"
 #include "MFront/MFrontConfig.hxx"
@@ -79,6 +80,12 @@ namespace mfront {
     virtual std::string getInterfaceNameInCamelCase() const = 0;
     virtual std::string getInterfaceNameInUpperCase() const = 0;
     virtual std::string getOutOfBoundsPolicyEnumerationPrefix() const = 0;
+    /*!
+     * \return if an array entry point, evaluating the material property
+     * at a set of points, must be generated. By default, this method
+     * returns false.
+     */
+    virtual bool shallGenerateArrayEntryPoint() const;
 
     //! \return the name of the header file
     virtual std::string getHeaderFileName(const std::string&) const;
@@ -98,6 +105,15 @@ namespace mfront {
      */
     virtual void writeSrcFile(const MaterialPropertyDescription&,
                               const FileDescription&) const;
+    /*!
+     * \brief write the array entry point
+     * \param[in] os: output stream
+     * \param[in] mpd: material property description
+     * \param[in] fd:  mfront file description
+     */
+    virtual void writeArrayEntryPoint(std::ostream&,
+                                      const MaterialPropertyDescription&,
+                                      const FileDescription&) const;
   };  // end of MfrontGenericMaterialPropertyInterfaceBase
 
 }  // end of namespace mfront
@@ -0,0 +1,140 @@
+/*!
+ * \file   mfront/include/MFront/GenericModel/EvaluateField.hxx
+ * \brief  This file declares functions used to evaluate models generated
+ * by the `generic` interface on whole fields.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICMODEL_EVALUATEFIELD_HXX
+#define LIB_MFRONT_GENERICMODEL_EVALUATEFIELD_HXX
+
+#include <array>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include "TFEL/System/ThreadPool.hxx"
+#include "MFront/GenericBehaviour/Integrate.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+
+namespace mfront::gm {
+
+  /*!
+   * \return the number of threads used to evaluate models on fields.
+   *
+   * This number is given by the `GENERIC_MODEL_NTHREADS` environment
+   * variable, if defined, or by the number of concurrent threads
+   * supported by the hardware otherwise.
+   */
+  inline mfront_gb_size_type getNumberOfThreads() {
+    static const auto n = [] {
+      const auto e = ::getenv("GENERIC_MODEL_NTHREADS");
+      if (e != nullptr) {
+        const auto v = std::strtol(e, nullptr, 10);
+        return v > 0 ? static_cast<mfront_gb_size_type>(v)
+                     : mfront_gb_size_type{1};
+      }
+      const auto h = std::thread::hardware_concurrency();
+      return h > 0 ? static_cast<mfront_gb_size_type>(h)
+                   : mfront_gb_size_type{1};
+    }();
+    return n;
+  }  // end of getNumberOfThreads
+
+  /*!
+   * \return the thread pool used to evaluate models on fields. This
+   * thread pool is created at the first call.
+   */
+  inline tfel::system::ThreadPool& getThreadPool() {
+    static tfel::system::ThreadPool pool(getNumberOfThreads());
+    return pool;
+  }  // end of getThreadPool
+
+  /*!
+   * \brief evaluate a model on a field of `n` points.
+   *
+   * The points are split in contiguous chunks which are evaluated in
+   * parallel using the thread pool returned by `getThreadPool`. Small
+   * fields are evaluated by the calling thread.
+   *
+   * Each chunk is given its own error message buffer and its own time
+   * step scaling factor. If the evaluation of some chunks fails, the
+   * error message of the first failing chunk is reported and the time
+   * step scaling factor is the minimum of the ones of the failing
+   * chunks.
+   *
+   * \tparam Implementation: type of the function evaluating the model on
+   * a range of points. This function takes the behaviour data, the index
+   * of the first point and the index after the last point and returns
+   * 1 on success and -1 on failure.
+   * \param[in,out] d: behaviour data
+   * \param[in] n: number of points
+   * \param[in] f: function evaluating the model on a range of points
+   */
+  template <typename Implementation>
+  int evaluateField(mfront_gb_BehaviourData& d,
+                    const mfront_gb_size_type n,
+                    const Implementation& f) {
+    //! \brief minimal number of points treated by a task
+    constexpr auto minimal_chunk_size = mfront_gb_size_type{1024};
+    const auto nthreads = getNumberOfThreads();
+    if ((nthreads == 1) || (n < 2 * minimal_chunk_size)) {
+      return f(d, 0, n);
+    }
+    auto& pool = getThreadPool();
+    const auto nchunks =
+        std::min(static_cast<mfront_gb_size_type>(pool.getNumberOfThreads()),
+                 n / minimal_chunk_size);
+    const auto chunk_size = (n + nchunks - 1) / nchunks;
+    struct Chunk {
+      //! \brief error message
+      std::array<char, 512> msg;
+      //! \brief time step scaling factor
+      mfront_gb_real rdt;
+      //! \brief behaviour data
+      mfront_gb_BehaviourData data;
+    };
+    auto chunks = std::vector<Chunk>(nchunks);
+    auto results = std::vector<
+        std::future<tfel::system::ThreadedTaskResult<int>>>{};
+    results.reserve(nchunks);
+    for (mfront_gb_size_type c = 0; c != nchunks; ++c) {
+      auto& chunk = chunks[c];
+      chunk.msg[0] = '\0';
+      chunk.rdt = *(d.rdt);
+      chunk.data = d;
+      chunk.data.error_message = chunk.msg.data();
+      chunk.data.rdt = &(chunk.rdt);
+      const auto b = c * chunk_size;
+      const auto e = std::min(b + chunk_size, n);
+      results.push_back(
+          pool.addTask([&f, &chunk, b, e] { return f(chunk.data, b, e); }));
+    }
+    auto r = 1;
+    for (mfront_gb_size_type c = 0; c != nchunks; ++c) {
+      auto result = results[c].get();
+      if ((!result) || (*result < 0)) {
+        if (r > 0) {
+          const auto* const msg =
+              (!result) ? "unknown exception" : chunks[c].msg.data();
+          mfront::gb::reportError(d, msg);
+          *(d.rdt) = chunks[c].rdt;
+          r = -1;
+        } else {
+          *(d.rdt) = std::min(*(d.rdt), chunks[c].rdt);
+        }
+      }
+    }
+    return r;
+  }  // end of evaluateField
+
+}  // end of namespace mfront::gm
+
+#endif /* LIB_MFRONT_GENERICMODEL_EVALUATEFIELD_HXX */
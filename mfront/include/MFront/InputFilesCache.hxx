@@ -0,0 +1,109 @@
+/*!
+ * \file   mfront/include/MFront/InputFilesCache.hxx
+ * \brief  This file declares the InputFilesCache class
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_INPUTFILESCACHE_HXX
+#define LIB_MFRONT_INPUTFILESCACHE_HXX
+
+#include <set>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <optional>
+#include "MFront/MFrontConfig.hxx"
+#include "MFront/TargetsDescription.hxx"
+
+namespace mfront {
+
+  /*!
+   * \brief a cache describing the input files treated in previous
+   * sessions, used to skip the treatment of input files which did not
+   * change.
+   *
+   * An input file is considered unchanged if:
+   *
+   * - the options of the current session, summarized by a key (see the
+   *   constructor), are the same as the ones used when it was treated.
+   * - the input file and all its dependencies (i.e. the files read while
+   *   treating it, see the `DependenciesRecorder` class) have the same
+   *   content as when it was treated.
+   * - all the sources and headers it generated still exist.
+   *
+   * This class is thread-safe.
+   */
+  struct MFRONT_VISIBILITY_EXPORT InputFilesCache {
+    //! \brief description of a treated input file
+    struct Entry {
+      //! \brief key of the session in which the file was treated
+      std::string key;
+      //! \brief dependencies
+      std::vector<std::string> dependencies;
+      //! \brief hashes of the dependencies
+      std::vector<std::string> hashes;
+      //! \brief targets generated by the input file
+      TargetsDescription targets;
+    };
+    /*!
+     * \return the hash of a string
+     * \param[in] s: string
+     */
+    static std::string hash(const std::string&);
+    /*!
+     * \brief constructor
+     * \param[in] f: file in which the cache is stored
+     * \param[in] k: key summarizing the options of the current session
+     *
+     * The cache file is read if it exists. Invalid cache files are
+     * ignored.
+     */
+    InputFilesCache(const std::string&, const std::string&);
+    /*!
+     * \return the targets generated by the given input file if the input
+     * file did not change since it was treated, an empty value otherwise.
+     * \param[in] f: input file
+     */
+    std::optional<TargetsDescription> get(const std::string&) const;
+    /*!
+     * \brief update the cache after the treatment of an input file
+     * \param[in] f: input file
+     * \param[in] d: dependencies of the input file
+     * \param[in] t: targets generated by the input file
+     */
+    void update(const std::string&,
+                const std::set<std::string>&,
+                const TargetsDescription&);
+    //! \brief write the cache file
+    void write() const;
+    //! \brief destructor
+    ~InputFilesCache();
+
+   private:
+    InputFilesCache(InputFilesCache&&) = delete;
+    InputFilesCache(const InputFilesCache&) = delete;
+    InputFilesCache& operator=(InputFilesCache&&) = delete;
+    InputFilesCache& operator=(const InputFilesCache&) = delete;
+    //! \brief cache file
+    const std::string file;
+    //! \brief key of the current session
+    const std::string key;
+    //! \brief description of the treated input files
+    std::map<std::string, Entry> entries;
+    //! \brief input files updated during the current session
+    std::set<std::string> updated;
+    //! \brief mutex protecting the entries
+    mutable std::mutex m;
+  };  // end of struct InputFilesCache
+
+}  // end of namespace mfront
+
+#endif /* LIB_MFRONT_INPUTFILESCACHE_HXX */
@@ -18,6 +18,7 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <memory>
 #include <iosfwd>
 
 #include "TFEL/Utilities/ArgumentParserBase.hxx"
@@ -28,6 +29,9 @@
 
 namespace mfront {
 
+  // forward declaration
+  struct InputFilesCache;
+
   /*!
    * \brief the main class of MFront
    */
@@ -83,6 +87,16 @@ namespace mfront {
     virtual void treatNoMelt();
     //! treat the --silent-build command line option
     virtual void treatSilentBuild();
+    //! treat the --unity-build command line option
+    virtual void treatUnityBuild();
+    //! treat the --precompiled-headers command line option
+    virtual void treatPrecompiledHeaders();
+    //! treat the --jobs command line option
+    virtual void treatJobs();
+    //! treat the --incremental command line option
+    virtual void treatIncremental();
+    //! treat the --pgo command line option
+    virtual void treatPGO();
 
     virtual void treatNoDeps();
 
@@ -107,10 +121,35 @@ namespace mfront {
     virtual void registerArgumentCallBacks();
 
     virtual void analyseTargetsFile();
+    /*!
+     * \return a key summarizing the options of the current session which
+     * affect the treatment of the input files. This key is used by the
+     * incremental treatment of the input files.
+     */
+    virtual std::string getInputFilesCacheKey() const;
+    /*!
+     * \brief treat the input files using at most `jobs` threads. The
+     * targets descriptions are merged in the order of the input files.
+     * \param[out] errors: files which could not be treated and associated
+     * error messages
+     */
+    virtual void treatFilesConcurrently(
+        std::vector<std::pair<std::string, std::string>> &);
 
     virtual void writeTargetsDescription() const;
 
     virtual void buildLibraries(const std::string &);
+    /*!
+     * \brief build the specified targets using a profile guided
+     * optimisation:
+     *
+     * - the libraries are first built with instrumentation.
+     * - the tests given by the `--pgo` option are run using `mtest` to
+     *   collect profiles.
+     * - the libraries are rebuilt using the profiles and link time
+     *   optimisation.
+     */
+    virtual void buildLibrariesUsingProfileGuidedOptimisation();
 
     virtual void cleanLibraries();
 
@@ -151,6 +190,14 @@ namespace mfront {
     bool buildLibs = false;
 
     bool cleanLibs = false;
+    //! \brief maximum number of input files treated concurrently
+    unsigned int jobs = 1;
+    //! \brief boolean stating if unchanged input files shall be skipped
+    bool incremental = false;
+    //! \brief description of the input files treated in previous sessions
+    std::unique_ptr<InputFilesCache> cache;
+    //! \brief tests used to collect profiles (profile guided optimisation)
+    std::vector<std::string> pgoTests;
 
   };  // end of class MFront
 
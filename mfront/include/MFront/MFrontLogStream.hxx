@@ -68,6 +68,23 @@ namespace mfront {
    * The user has to take care of it
    */
   MFRONTLOGSTREAM_VISIBILITY_EXPORT void setLogStream(std::ostream&);
+  /*!
+   * \brief set the logging stream used by the calling thread.
+   *
+   * When a thread specific logging stream is set, the `getLogStream`
+   * function returns it when called from this thread. This is used to
+   * buffer the outputs of threads treating files concurrently.
+   *
+   * \param os : new logging stream
+   * \warning the stream is not handled by this function.
+   * The user has to take care of it
+   */
+  MFRONTLOGSTREAM_VISIBILITY_EXPORT void setThreadLogStream(std::ostream&);
+  /*!
+   * \brief remove the logging stream specific to the calling thread, if
+   * any.
+   */
+  MFRONTLOGSTREAM_VISIBILITY_EXPORT void resetThreadLogStream();
 
   /*!
    * \brief set if MFront shall use unicode characters on output.
@@ -17,6 +17,8 @@
 
 #include <set>
 #include <string>
+#include <optional>
+#include "TFEL/Utilities/Data.hxx"
 #include "MFront/DSLBase.hxx"
 #include "MFront/LawFunction.hxx"
 #include "MFront/VariableBoundsDescription.hxx"
@@ -124,6 +126,14 @@ namespace mfront {
     void treatDataWithoutInput();
     //! \brief auxiliary method to treat data for one input
     void treatDataWithOneInput();
+    //! \brief treat the `@Tabulation` keyword
+    virtual void treatTabulation();
+    /*!
+     * \brief replace the body of the function by the evaluation of a
+     * tabulation built at the first call. The exact function is still
+     * used outside the tabulation range.
+     */
+    void tabulateFunction();
     /*!
      * treat the setGlossaryName and the setEntryName method for
      * inputs or output.
@@ -153,6 +163,8 @@ namespace mfront {
     MaterialPropertyDescription md;
     //! \brief overriding parameters
     std::map<std::string, double> overriding_parameters;
+    //! \brief options of the tabulation, if requested
+    std::optional<tfel::utilities::DataMap> tabulation;
     //! \brief list of registred interfaces
     std::map<std::string, std::shared_ptr<AbstractMaterialPropertyInterface>>
         interfaces;
@@ -488,6 +488,28 @@ namespace mfront {
         const BehaviourDescription &,
         const std::string &,
         const Hypothesis) const;
+    /*!
+     * \brief write a single string symbol gathering the names and types
+     * of the material properties, internal state variables, external
+     * state variables and parameters.
+     *
+     * Those metadata are redundant with the symbols generated by the
+     * `writeMaterialPropertiesSymbols`, `writeStateVariablesSymbols`,
+     * `writeExternalStateVariablesSymbols` and `writeParametersSymbols`
+     * methods, but can be retrieved and decoded at once by the
+     * `ExternalLibraryManager` class.
+     *
+     * \param[out] f   : output stream
+     * \param[in] i    : standard behaviour interface
+     * \param[in] mb   : behaviour description
+     * \param[in] n    : name of the behaviour as defined by the interface
+     * \param[in] h    : modelling hypothesis
+     */
+    virtual void writeMetadataSymbol(std::ostream &,
+                                     const BehaviourInterfaceBase &,
+                                     const BehaviourDescription &,
+                                     const std::string &,
+                                     const Hypothesis) const;
     /*!
      * \param[out] f    : output stream
      * \param[in] i    : standard behaviour interface
@@ -513,6 +535,17 @@ namespace mfront {
     virtual ~SymbolsGenerator();
 
    protected:
+    /*!
+     * \return the external names of the material properties exported by
+     * the interface for the given hypothesis
+     * \param[in] i: standard behaviour interface
+     * \param[in] mb: behaviour description
+     * \param[in] h: modelling hypothesis
+     */
+    virtual std::vector<std::string> getMaterialPropertiesExternalNames(
+        const BehaviourInterfaceBase &,
+        const BehaviourDescription &,
+        const Hypothesis) const;
     /*!
      * \brief write a symbol containing the types of a list of variables
      * \param[out] out: output stream
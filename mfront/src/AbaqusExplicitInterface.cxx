@@ -17,6 +17,7 @@
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontLock.hxx"
 #include "MFront/FileDescription.hxx"
@@ -31,7 +32,7 @@ namespace mfront {
 
   //! copy vumat-sp.cpp and vumat-dp locally
   static void copyVUMATFiles() {
-    std::ofstream out;
+    GeneratedFileStream out;
     MFrontLockGuard lock;
     for (const std::string f : {"vumat-sp.cpp", "vumat-dp.cpp"}) {
       out.open("abaqus-explicit/" + f);
@@ -285,7 +286,7 @@ namespace mfront {
     copyVUMATFiles();
     // header
     auto fname = "abaqusexplicit" + name + ".hxx";
-    std::ofstream out("include/MFront/Abaqus/" + fname);
+    GeneratedFileStream out("include/MFront/Abaqus/" + fname);
     throw_if(!out, "could not open file '" + fname + "'");
 
     out << "/*!\n"
@@ -22,6 +22,7 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontLock.hxx"
 #include "MFront/MFrontUtilities.hxx"
@@ -357,7 +358,7 @@ namespace mfront {
     systemCall::mkdir("include/MFront/Abaqus");
     systemCall::mkdir("abaqus");
 
-    std::ofstream out;
+    GeneratedFileStream out;
     {
       // copy umat.cpp locally
       MFrontLockGuard lock;
@@ -11,8 +11,8 @@
  * project under specific licensing conditions.
  */
 
-#include <fstream>
 #include "TFEL/Raise.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MFront/FileDescription.hxx"
@@ -488,7 +488,7 @@ namespace mfront {
       const auto name = mb.getLibrary() + mb.getClassName();
       const auto mn = this->getLibraryName(mb) + "_" + mb.getClassName();
       const auto fn = (b ? "abaqus/" : "abaqus-explicit/") + name + ".inp";
-      std::ofstream out{fn};
+      GeneratedFileStream out{fn};
       throw_if(!out, "could not open file '" + fn + "'");
       // header
       out << "** \n"
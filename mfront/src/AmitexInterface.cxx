@@ -11,9 +11,9 @@
  * project under specific licensing conditions.
  */
 
-#include <fstream>
 #include "TFEL/Raise.hxx"
 #include "TFEL/System/System.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MFront/AmitexInterface.hxx"
 
@@ -136,7 +136,7 @@ namespace mfront {
       const auto fileName("amitex/" + name + ".xml");
       // opening output file
       tfel::system::systemCall::mkdir("amitex");
-      std::ofstream out;
+      GeneratedFileStream out;
       out.open(fileName);
       tfel::raise_if(!out,
                      "AmitexInterface::generateInputFileExample: "
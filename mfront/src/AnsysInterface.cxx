@@ -22,6 +22,7 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontLock.hxx"
 #include "MFront/MFrontUtilities.hxx"
@@ -43,7 +44,7 @@ namespace mfront {
 
   static void copyAnsysFile(const std::string& f) {
     const auto root = tfel::getInstallPath();
-    std::ofstream out("ansys/" + f);
+    GeneratedFileStream out("ansys/" + f);
 #ifdef TFEL_APPEND_SUFFIX
     const auto fn = root + "/share/doc/mfront-" VERSION "/ansys/" + f;
 #else  /* TFEL_APPEND_SUFFIX */
@@ -593,7 +594,7 @@ namespace mfront {
       const auto name = mb.getLibrary() + mb.getClassName();
       const auto mn = this->getLibraryName(mb) + "_" + mb.getClassName();
       const auto fn = "ansys/" + name + ".dat";
-      std::ofstream out{fn};
+      GeneratedFileStream out{fn};
       throw_if(!out, "could not open file '" + fn + "'");
       // header
       out << "/com, \n"
@@ -802,7 +803,7 @@ namespace mfront {
 
     // header
     auto fname = "ansys" + name + ".hxx";
-    std::ofstream out("include/MFront/Ansys/" + fname);
+    GeneratedFileStream out("include/MFront/Ansys/" + fname);
     throw_if(!out, "could not open file '" + fname + "'");
 
     out << "/*!\n"
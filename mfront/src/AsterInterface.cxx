@@ -11,7 +11,6 @@
  * project under specific licensing conditions.
  */
 
-#include <fstream>
 #include <sstream>
 #include <cstdlib>
 #include <stdexcept>
@@ -21,6 +20,7 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontUtilities.hxx"
 #include "MFront/MFrontLogStream.hxx"
@@ -242,7 +242,7 @@ namespace mfront {
 
     // header
     const auto header = "include/MFront/Aster/aster" + name + ".hxx";
-    std::ofstream out(header);
+    GeneratedFileStream out(header);
     throw_if(!out, "could not open file '" + header + "'");
 
     out << "/*!\n";
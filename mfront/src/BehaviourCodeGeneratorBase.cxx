@@ -20,6 +20,7 @@
 #include "TFEL/Math/Evaluator.hxx"
 #include "TFEL/Material/FiniteStrainBehaviourTangentOperator.hxx"
 #include "TFEL/Utilities/CxxTokenizer.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/MFrontHeader.hxx"
 #include "MFront/PerformanceProfiling.hxx"
 #include "MFront/DSLUtilities.hxx"
@@ -158,11 +159,12 @@ namespace mfront {
     tfel::system::systemCall::mkdir("include/TFEL/");
     tfel::system::systemCall::mkdir("include/TFEL/Material");
     //! generating sources du to external material properties and models
-    std::ofstream behaviourFile("include/" + this->getBehaviourFileName());
-    std::ofstream behaviourDataFile("include/" +
-                                    this->getBehaviourDataFileName());
-    std::ofstream integrationDataFile("include/" +
-                                      this->getIntegrationDataFileName());
+    GeneratedFileStream behaviourFile("include/" +
+                                      this->getBehaviourFileName());
+    GeneratedFileStream behaviourDataFile("include/" +
+                                          this->getBehaviourDataFileName());
+    GeneratedFileStream integrationDataFile(
+        "include/" + this->getIntegrationDataFileName());
     behaviourFile.precision(14);
     behaviourDataFile.precision(14);
     integrationDataFile.precision(14);
@@ -239,7 +241,7 @@ namespace mfront {
     this->writeBehaviourFileEnd(behaviourFile);
     // Generating behaviour's source file
     if (this->isSrcFileRequired()) {
-      std::ofstream srcFile("src/" + this->getSrcFileName());
+      GeneratedFileStream srcFile("src/" + this->getSrcFileName());
       if (!srcFile) {
         this->throwRuntimeError(
             "BehaviourCodeGeneratorBase::generateOutputFiles",
@@ -329,7 +331,7 @@ namespace mfront {
     tfel::system::systemCall::mkdir("include/TFEL/");
     tfel::system::systemCall::mkdir("include/TFEL/Material");
     auto file = "include/" + this->getSlipSystemHeaderFileName();
-    std::ofstream out(file);
+    GeneratedFileStream out(file);
     throw_if(!out, "can't open file '" + file + "'");
     out.exceptions(std::ios::badbit | std::ios::failbit);
     out << "/*!\n"
@@ -156,6 +156,7 @@ namespace mfront {
     add("@Material", &BehaviourDSLCommon::treatMaterial);
     add("@Library", &BehaviourDSLCommon::treatLibrary);
     add("@Profiling", &BehaviourDSLCommon::treatProfiling);
+    add("@FrozenParameters", &BehaviourDSLCommon::treatFrozenParameters);
     add("@Behaviour", &BehaviourDSLCommon::treatBehaviour);
     add("@StrainMeasure", &BehaviourDSLCommon::treatStrainMeasure);
     add("@Author", &BehaviourDSLCommon::treatAuthor);
@@ -3251,6 +3252,40 @@ namespace mfront {
     this->mb.setAttribute(BehaviourData::profiling, b, false);
   }  // end of treatProfiling
 
+  void BehaviourDSLCommon::treatFrozenParameters() {
+    const auto m = std::string{"BehaviourDSLCommon::treatFrozenParameters"};
+    this->checkNotEndOfFile(m);
+    if (this->current->value == "{") {
+      ++(this->current);
+      this->checkNotEndOfFile(m);
+      while (this->current->value != "}") {
+        const auto n = tfel::unicode::getMangledString(this->current->value);
+        ++(this->current);
+        this->readSpecifiedToken(m, ":");
+        this->overrideByAParameter(n, this->readDouble());
+        this->checkNotEndOfFile(m);
+        if (this->current->value != "}") {
+          this->readSpecifiedToken(m, ",");
+          this->checkNotEndOfFile(m);
+          if (this->current->value == "}") {
+            this->throwRuntimeError(m, "unexpected token '}'");
+          }
+        }
+      }
+      ++(this->current);
+    }
+    this->readSpecifiedToken(m, ";");
+    if (this->mb.hasAttribute(
+            MaterialKnowledgeDescription::parametersAsStaticVariables)) {
+      this->mb.updateAttribute(
+          MaterialKnowledgeDescription::parametersAsStaticVariables, true);
+    } else {
+      this->mb.setAttribute(
+          MaterialKnowledgeDescription::parametersAsStaticVariables, true,
+          false);
+    }
+  }  // end of treatFrozenParameters
+
   void BehaviourDSLCommon::treatPredictionOperator() {
     using namespace tfel::material;
     using namespace tfel::utilities;
@@ -97,6 +97,8 @@ namespace mfront {
       "allowsNewUserDefinedVariables";
   const char* const BehaviourData::algorithm = "algorithm";
   const char* const BehaviourData::numberOfEvaluations = "numberOfEvaluations";
+  const char* const BehaviourData::elasticStepCriterion =
+      "elasticStepCriterion";
 
   /*!
    * check if the given name has already been used as value in the
@@ -15,7 +15,6 @@
 #include <cstring>
 #include <ostream>
 #include <sstream>
-#include <fstream>
 #include <iterator>
 #include <algorithm>
 
@@ -42,6 +41,7 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/MFrontHeader.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MFront/InstallPath.hxx"
@@ -50,6 +50,7 @@
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/TargetsDescription.hxx"
 #include "MFront/GeneratorOptions.hxx"
+#include "MFront/GeneratorUtilities.hxx"
 #include "MFront/CMakeGenerator.hxx"
 
 namespace mfront {
@@ -84,7 +85,10 @@ namespace mfront {
       getLogStream() << "generating 'src/CMakeList.txt'\n";
     }
     MFrontLockGuard lock;
-    std::ofstream m("src/CMakeLists.txt");
+    if (o.precompiledHeaders) {
+      writePrecompiledHeader("src");
+    }
+    GeneratedFileStream m("src/CMakeLists.txt");
     m.exceptions(std::ios::badbit | std::ios::failbit);
     throw_if(!m, "can't open file 'src/CMakeList.txt'");
     auto append = [&m](const std::string& n, const std::string& v) {
@@ -113,6 +117,8 @@ namespace mfront {
     }
     //
     throw_if(!t.specific_targets.empty(), "specific targets are not supported");
+    throw_if(o.pgo != GeneratorOptions::NOPGO,
+             "profile guided optimisation is not supported");
     m << "# CMakeList.txt generated by mfront.\n"
       << MFrontHeader::getHeader("# ") << "\n"
       << "\n"
@@ -146,7 +152,15 @@ namespace mfront {
       << "  list(APPEND SPAWN_RESULTS ${${res}})\n"
       << "  set(${res} ${SPAWN_RESULTS} PARENT_SCOPE)\n"
       << "endfunction(append_spawn2)\n"
-      << "\n"
+      << "\n";
+    if (o.unityBuild) {
+      m << "if(CMAKE_VERSION VERSION_GREATER_EQUAL 3.16)\n"
+        << "  set(CMAKE_UNITY_BUILD ON)\n"
+        << "  set(CMAKE_UNITY_BUILD_BATCH_SIZE 8)\n"
+        << "endif(CMAKE_VERSION VERSION_GREATER_EQUAL 3.16)\n"
+        << "\n";
+    }
+    m << "\n"
       << "if(TFEL_INSTALL_PATH)\n"
       << "  set(TFELHOME \"${TFEL_INSTALL_PATH}\")\n"
       << "else(TFEL_INSTALL_PATH)\n"
@@ -306,6 +320,12 @@ namespace mfront {
         }
       }
       m << ")\n";
+      if (o.precompiledHeaders) {
+        m << "if(CMAKE_VERSION VERSION_GREATER_EQUAL 3.16)\n"
+          << "  target_precompile_headers(" << l.name << " PRIVATE "
+          << getPrecompiledHeaderFileName() << ")\n"
+          << "endif(CMAKE_VERSION VERSION_GREATER_EQUAL 3.16)\n";
+      }
       if (!l.link_libraries.empty()) {
         m << "target_link_libraries(" << l.name << '\n'
           << "${" << l.name << "_LINK_LIBRARIES})\n";
@@ -373,11 +393,21 @@ namespace mfront {
       tg1 = "--target";
       tg2 = t.c_str();
     }
+    // build in parallel unless the number of jobs is specified by the
+    // user through the CMAKE_BUILD_PARALLEL_LEVEL environment variable
+    const auto jobs = std::to_string(getDefaultNumberOfBuildJobs());
+    const char* j1 = nullptr;
+    const char* j2 = nullptr;
+    if (::getenv("CMAKE_BUILD_PARALLEL_LEVEL") == nullptr) {
+      j1 = "--parallel";
+      j2 = jobs.c_str();
+    }
     const char* argv[] = {cmake, "-G", g.c_str(), ".", silent, nullptr};
-    const char* argv2[] = {cmake, "--build", ".",    tg1,    tg2,
-                           cfg1,  cfg2,      silent, nullptr};
-    std::remove_if(argv2, argv2 + 9,
-                   [](const char* ptr) { return ptr == nullptr; });
+    const char* argv2[] = {cmake, "--build", ".", tg1,    tg2,    cfg1,
+                           cfg2,  j1,        j2,  silent, nullptr};
+    const auto pe = std::remove_if(
+        argv2, argv2 + 11, [](const char* ptr) { return ptr == nullptr; });
+    std::fill(pe, argv2 + 11, nullptr);
     auto error = [&t](const std::string& e, const char* const* args) {
       auto msg = "callCmake: can't build target '" + t + "'\n";
       if (!e.empty()) {
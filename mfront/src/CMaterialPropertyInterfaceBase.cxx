@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontHeader.hxx"
 #include "MFront/FileDescription.hxx"
@@ -96,7 +97,7 @@ namespace mfront {
       return;
     }
     const auto fn = "include/" + header + ".hxx";
-    std::ofstream os(fn);
+    GeneratedFileStream os(fn);
     tfel::raise_if(!os,
                    "CMaterialPropertyInterfaceBase::writeSrcFiles: "
                    "unable to open '" +
@@ -415,7 +416,7 @@ namespace mfront {
     // opening the source file
     const auto src = this->getSrcFileName(mpd.material, mpd.className);
     const auto fn = "src/" + src + ".cxx";
-    std::ofstream os(fn);
+    GeneratedFileStream os(fn);
     tfel::raise_if(!os,
                    "CMaterialPropertyInterfaceBase::writeSrcFiles: "
                    "unable to open file '" +
@@ -11,7 +11,6 @@
  * project under specific licensing conditions.
  */
 
-#include <fstream>
 #include <sstream>
 #include <cstdlib>
 #include <stdexcept>
@@ -21,6 +20,7 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontLock.hxx"
 #include "MFront/MFrontUtilities.hxx"
@@ -346,7 +346,7 @@ namespace mfront {
     systemCall::mkdir("include/MFront/CalculiX");
     systemCall::mkdir("calculix");
 
-    std::ofstream out;
+    GeneratedFileStream out;
 
     // header
     auto fname = "calculix" + name + ".hxx";
@@ -1220,7 +1220,7 @@ namespace mfront {
       const auto name = mb.getLibrary() + mb.getClassName();
       const auto mn = this->getLibraryName(mb) + "_" + mb.getClassName();
       const auto fn = (b ? "calculix/" : "calculix-explicit/") + name + ".inp";
-      std::ofstream out{fn};
+      GeneratedFileStream out{fn};
       throw_if(!out, "could not open file '" + fn + "'");
       // header
       out << "** \n"
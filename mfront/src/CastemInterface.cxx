@@ -15,7 +15,6 @@
 #include <algorithm>
 
 #include <sstream>
-#include <fstream>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -24,6 +23,7 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontUtilities.hxx"
 #include "MFront/MFrontLogStream.hxx"
@@ -784,7 +784,7 @@ namespace mfront {
     const auto name = this->getBehaviourName(mb);
 
     auto fileName = "umat" + name + ".hxx";
-    std::ofstream out("include/MFront/Castem/" + fileName);
+    GeneratedFileStream out("include/MFront/Castem/" + fileName);
     throw_if(!out, "could not open file '" + fileName + "'");
 
     out << "/*!\n"
@@ -2667,7 +2667,7 @@ namespace mfront {
       const auto fileName("castem/" + name + ".dgibi");
       // opening output file
       tfel::system::systemCall::mkdir("castem");
-      std::ofstream out;
+      GeneratedFileStream out;
       out.open(fileName);
       tfel::raise_if(!out,
                      "CastemInterface::generateInputFileExample: "
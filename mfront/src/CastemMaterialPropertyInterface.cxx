@@ -20,6 +20,7 @@
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontUtilities.hxx"
 #include "MFront/MFrontHeader.hxx"
@@ -253,7 +254,7 @@ namespace mfront {
       const MaterialPropertyDescription& mpd, const FileDescription& fd) const {
     const auto name = this->getCastemFunctionName(mpd);
     const auto fn = "include/" + this->getHeaderFileName(name);
-    std::ofstream out{fn};
+    GeneratedFileStream out{fn};
     tfel::raise_if(!out,
                    "CastemMaterialPropertyInterface::writeOutputFiles: "
                    "unable to open '" +
@@ -307,7 +308,7 @@ namespace mfront {
       const MaterialPropertyDescription& mpd, const FileDescription& fd) const {
     const auto name = this->getCastemFunctionName(mpd);
     const auto fn = "src/" + this->getSourceFileName(name);
-    std::ofstream out{fn};
+    GeneratedFileStream out{fn};
     tfel::raise_if(!out,
                    "CastemMaterialPropertyInterface::writeOutputFiles: "
                    "unable to open '" +
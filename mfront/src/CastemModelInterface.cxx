@@ -11,7 +11,6 @@
  * project under specific licensing conditions.
  */
 
-#include <fstream>
 #include <algorithm>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
@@ -19,6 +18,7 @@
 #include "TFEL/Glossary/GlossaryEntry.hxx"
 #include "TFEL/System/System.hxx"
 #include "TFEL/Material/ModellingHypothesis.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/FileDescription.hxx"
@@ -174,7 +174,7 @@ namespace mfront {
     tfel::system::systemCall::mkdir("include/MFront/CastemModel");
     const auto name = getModelName(md);
     const auto header = name + "-castem.hxx";
-    std::ofstream os("include/MFront/CastemModel/" + header);
+    GeneratedFileStream os("include/MFront/CastemModel/" + header);
     if (!os) {
       raise("could not open file '" + header + "'");
     }
@@ -257,7 +257,7 @@ namespace mfront {
     const auto header = name + "-castem.hxx";
     const auto src = name + "-castem.cxx";
     const auto cn = md.className + "RealParametersInitializer";
-    std::ofstream os("src/" + src);
+    GeneratedFileStream os("src/" + src);
     os.precision(14);
     if (!os) {
       raise("could not open file '" + src + "'");
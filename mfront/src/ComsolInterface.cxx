@@ -11,10 +11,10 @@
  * project under specific licensing conditions.
  */
 
-#include <fstream>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/System/System.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/MFrontUtilities.hxx"
 #include "MFront/FileDescription.hxx"
 #include "MFront/TargetsDescription.hxx"
@@ -110,7 +110,7 @@ namespace mfront {
     systemCall::mkdir("include/MFront/Comsol");
     systemCall::mkdir("comsol");
 
-    std::ofstream out;
+    GeneratedFileStream out;
 
     // header
     auto fname = "comsol" + name + ".hxx";
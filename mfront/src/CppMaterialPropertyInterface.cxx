@@ -12,7 +12,6 @@
  */
 
 #include <sstream>
-#include <fstream>
 #include <algorithm>
 #include <stdexcept>
 
@@ -20,6 +19,7 @@
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontUtilities.hxx"
 #include "MFront/MFrontHeader.hxx"
@@ -233,7 +233,7 @@ namespace mfront {
       const MaterialPropertyDescription& mpd, const FileDescription& fd) const {
     const auto name = mpd.material.empty() ? mpd.className
                                            : mpd.material + "_" + mpd.className;
-    std::ofstream header("include/" + getHeaderFileName(name));
+    GeneratedFileStream header("include/" + getHeaderFileName(name));
     tfel::raise_if(!header,
                    "CppMaterialPropertyInterface::writeHeaderFile: "
                    "unable to open '" +
@@ -343,7 +343,7 @@ namespace mfront {
     const auto name = mpd.material.empty() ? mpd.className
                                            : mpd.material + "_" + mpd.className;
     const auto src_name = "src/" + name + "-cxx.cxx";
-    std::ofstream src(src_name);
+    GeneratedFileStream src(src_name);
     throw_if(!src, "unable to open '" + src_name + "'");
     src.exceptions(std::ios::badbit | std::ios::failbit);
     src << "/*!\n"
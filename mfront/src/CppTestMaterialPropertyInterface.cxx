@@ -15,6 +15,7 @@
 #include <stdexcept>
 #include <algorithm>
 #include "TFEL/Raise.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontHeader.hxx"
 #include "MFront/FileDescription.hxx"
@@ -107,7 +108,7 @@ namespace mfront {
     const auto name =
         (material.empty()) ? className : material + "_" + className;
     const auto srcFileName = "src/" + name + "-CppTest.cxx";
-    std::ofstream srcFile(srcFileName);
+    GeneratedFileStream srcFile(srcFileName);
     tfel::raise_if(!srcFile,
                    "MaterialPropertyDSL::writeOutputFiles: "
                    "unable to open '" +
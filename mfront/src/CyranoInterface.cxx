@@ -11,7 +11,6 @@
  * project under specific licensing conditions.
  */
 
-#include <fstream>
 #include <sstream>
 #include <cstdlib>
 #include <iterator>
@@ -25,6 +24,7 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontUtilities.hxx"
 #include "MFront/MFrontLogStream.hxx"
@@ -277,7 +277,7 @@ namespace mfront {
 
     // opening header file
     auto fileName = "cyrano" + name + ".hxx";
-    std::ofstream out("include/MFront/Cyrano/" + fileName);
+    GeneratedFileStream out("include/MFront/Cyrano/" + fileName);
     throw_if(!out, "could not open file '" + fileName + "'");
 
     out << "/*!\n";
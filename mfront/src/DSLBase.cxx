@@ -38,6 +38,7 @@
 #include "MFront/MFrontUtilities.hxx"
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MFront/DependenciesRecorder.hxx"
 #include "MFront/MFrontMaterialPropertyInterface.hxx"
 #include "MFront/StaticVariableDescription.hxx"
 #include "MFront/GlobalDomainSpecificLanguageOptionsManager.hxx"
@@ -241,6 +242,7 @@ namespace mfront {
         (tfel::utilities::starts_with(f, "edf:"))) {
 #ifdef MFRONT_HAVE_MADNEX
       const auto path = decomposeImplementationPathInMadnexFile(f);
+      DependenciesRecorder::record(std::get<0>(path));
       const auto& material = std::get<2>(path);
       const auto& name = std::get<3>(path);
       const auto impl = madnex::getMFrontImplementation(
@@ -269,6 +271,7 @@ namespace mfront {
       tfel::raise("DSLBase::openFile: madnex support was not enabled");
 #endif /* MFRONT_HAVE_MADNEX */
     } else {
+      DependenciesRecorder::record(f);
       CxxTokenizer::openFile(f);
     }
     // substitutions
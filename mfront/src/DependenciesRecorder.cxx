@@ -0,0 +1,39 @@
+/*!
+ * \file   mfront/src/DependenciesRecorder.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include "MFront/DependenciesRecorder.hxx"
+
+namespace mfront {
+
+  //! \brief last recorder created in the current thread
+  static thread_local DependenciesRecorder* active_recorder = nullptr;
+
+  void DependenciesRecorder::record(const std::string& f) {
+    for (auto* r = active_recorder; r != nullptr; r = r->previous) {
+      r->files.insert(f);
+    }
+  }  // end of record
+
+  DependenciesRecorder::DependenciesRecorder() : previous(active_recorder) {
+    active_recorder = this;
+  }  // end of DependenciesRecorder
+
+  const std::set<std::string>& DependenciesRecorder::getFiles() const {
+    return this->files;
+  }  // end of getFiles
+
+  DependenciesRecorder::~DependenciesRecorder() {
+    active_recorder = this->previous;
+  }  // end of ~DependenciesRecorder
+
+}  // end of namespace mfront
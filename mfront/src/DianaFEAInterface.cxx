@@ -11,7 +11,6 @@
  * project under specific licensing conditions.
  */
 
-#include <fstream>
 #include <sstream>
 #include <cstdlib>
 #include <stdexcept>
@@ -21,6 +20,7 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontLock.hxx"
 #include "MFront/MFrontUtilities.hxx"
@@ -151,7 +151,7 @@ namespace mfront {
     systemCall::mkdir("include/MFront/DianaFEA");
     systemCall::mkdir("dianafea");
 
-    std::ofstream out;
+    GeneratedFileStream out;
 
     // header
     auto fname = "DianaFEA" + name + ".hxx";
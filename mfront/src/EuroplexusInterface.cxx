@@ -11,7 +11,6 @@
  * project under specific licensing conditions.
  */
 
-#include <fstream>
 #include <sstream>
 #include <cstdlib>
 #include <stdexcept>
@@ -20,6 +19,7 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontUtilities.hxx"
 #include "MFront/MFrontLogStream.hxx"
@@ -302,7 +302,7 @@ namespace mfront {
 
     // header
     auto fname = "europlexus" + name + ".hxx";
-    std::ofstream out("include/MFront/Europlexus/" + fname);
+    GeneratedFileStream out("include/MFront/Europlexus/" + fname);
     throw_if(!out, "could not open file '" + fname + "'");
 
     out << "/*!\n"
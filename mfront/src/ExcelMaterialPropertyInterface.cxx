@@ -38,6 +38,7 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontHeader.hxx"
 #include "MFront/MFrontLock.hxx"
@@ -147,7 +148,7 @@ namespace mfront {
     for (const auto& v : mpd.inputs) {
       p2->variables.push_back(v.name);
     }
-    std::ofstream wrapper(fname);
+    GeneratedFileStream wrapper(fname);
     throw_if(!wrapper, "unable to open '" + fname + "'");
     for (const auto& i : interfaces) {
       wrapper << i.function << " " << i.library << " ";
@@ -158,7 +159,7 @@ namespace mfront {
     }
     for (const auto& i : interfaces2) {
       const auto& libName = i.first;
-      std::ofstream file("src/" + libName + ".bas");
+      GeneratedFileStream file("src/" + libName + ".bas");
       throw_if(!file, "unable to open file 'src/" + libName + ".bas'");
       for (const auto& f : i.second) {
         file << "Declare Function " << f.function << " Lib \"" << libName
@@ -36,6 +36,7 @@
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/MFrontHeader.hxx"
 #include "MFront/MFrontLock.hxx"
 #include "MFront/DSLUtilities.hxx"
@@ -251,14 +252,14 @@ namespace mfront {
           (mpd.material.empty() ? "" : mpd.material + '_') + mpd.law;
       fcts[fname] = {this->getFunctionName(mpd), mpd.inputs.size()};
     }
-    std::ofstream mf{fmmlst};
+    GeneratedFileStream mf{fmmlst};
     throw_if(!mf, "unable to open '" + fmmlst + "'");
     mf.exceptions(std::ios::badbit | std::ios::failbit);
     for (const auto& m : fcts) {
       mf << m.first << " " << m.second.name << " " << m.second.n_args << "\n";
     }
     mf.close();
-    std::ofstream fm{"fortran/" + fmname + ".inc"};
+    GeneratedFileStream fm{"fortran/" + fmname + ".inc"};
     throw_if(!mf, "unable to open 'fortran/" + fmname + ".inc'");
     fm.exceptions(std::ios::badbit | std::ios::failbit);
     fm << "Module " << fmname << "\n"
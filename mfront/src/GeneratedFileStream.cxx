@@ -0,0 +1,87 @@
+/*!
+ * \file   mfront/src/GeneratedFileStream.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <fstream>
+#include <iterator>
+#include "MFront/GeneratedFileStream.hxx"
+
+namespace mfront {
+
+  GeneratedFileStream::GeneratedFileStream() : std::ostream(nullptr) {
+    this->rdbuf(&(this->buffer));
+  }  // end of GeneratedFileStream
+
+  GeneratedFileStream::GeneratedFileStream(const std::string& f)
+      : GeneratedFileStream() {
+    this->open(f);
+  }  // end of GeneratedFileStream
+
+  void GeneratedFileStream::open(const std::string& f) {
+    if (this->opened) {
+      this->setstate(std::ios::failbit);
+      return;
+    }
+    // checking that the file can be written. Opening the file in append
+    // mode creates the file if it does not exist but preserves its
+    // content and its modification time otherwise.
+    const std::ofstream test(f, std::ios::app);
+    if (!test) {
+      this->setstate(std::ios::failbit);
+      return;
+    }
+    this->file = f;
+    this->opened = true;
+    this->buffer.str(std::string{});
+    this->clear();
+  }  // end of open
+
+  bool GeneratedFileStream::is_open() const {
+    return this->opened;
+  }  // end of is_open
+
+  void GeneratedFileStream::close() {
+    if (!this->opened) {
+      this->setstate(std::ios::failbit);
+      return;
+    }
+    this->opened = false;
+    const auto content = this->buffer.str();
+    this->buffer.str(std::string{});
+    {
+      std::ifstream in(this->file);
+      if (in) {
+        const auto previous = std::string{std::istreambuf_iterator<char>{in},
+                                          std::istreambuf_iterator<char>{}};
+        if (previous == content) {
+          return;
+        }
+      }
+    }
+    std::ofstream out(this->file);
+    out << content;
+    out.close();
+    if (!out) {
+      this->setstate(std::ios::failbit);
+    }
+  }  // end of close
+
+  GeneratedFileStream::~GeneratedFileStream() {
+    if (this->opened) {
+      try {
+        this->close();
+      } catch (...) {
+      }
+    }
+  }  // end of ~GeneratedFileStream
+
+}  // end of namespace mfront
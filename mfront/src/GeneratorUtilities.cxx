@@ -0,0 +1,126 @@
+/*!
+ * \file   mfront/src/GeneratorUtilities.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/StringAlgorithms.hxx"
+#include "TFEL/System/System.hxx"
+#include "MFront/GeneratedFileStream.hxx"
+#include "MFront/GeneratorUtilities.hxx"
+
+namespace mfront {
+
+  /*!
+   * \brief open a file written by the functions of this file
+   * \param[out] out: output stream
+   * \param[in] d: directory
+   * \param[in] f: file name
+   */
+  static void openGeneratedFile(GeneratedFileStream& out,
+                                const std::string& d,
+                                const std::string& f) {
+    const auto p = d + tfel::system::dirStringSeparator() + f;
+    out.open(p);
+    out.exceptions(std::ios::badbit | std::ios::failbit);
+    tfel::raise_if(!out, "openGeneratedFile: can't open file '" + p + "'");
+  }  // end of openGeneratedFile
+
+  const char* getPrecompiledHeaderFileName() {
+    return "mfront-pch.hxx";
+  }  // end of getPrecompiledHeaderFileName
+
+  void writePrecompiledHeader(const std::string& d) {
+    GeneratedFileStream out;
+    openGeneratedFile(out, d, getPrecompiledHeaderFileName());
+    out << "/*!\n"
+        << " * \\file   " << getPrecompiledHeaderFileName() << '\n'
+        << " * \\brief  headers commonly used by the sources generated "
+        << "by mfront.\n"
+        << " *         This file is meant to be precompiled.\n"
+        << " *         File generated by mfront.\n"
+        << " */\n\n"
+        << "#ifndef LIB_MFRONT_PCH_HXX\n"
+        << "#define LIB_MFRONT_PCH_HXX\n\n"
+        << "#ifdef __cplusplus\n\n"
+        << "#include <cmath>\n"
+        << "#include <string>\n"
+        << "#include <vector>\n"
+        << "#include <limits>\n"
+        << "#include <sstream>\n"
+        << "#include <iostream>\n"
+        << "#include <algorithm>\n"
+        << "#include <stdexcept>\n\n"
+        << "#include \"TFEL/Config/TFELConfig.hxx\"\n"
+        << "#include \"TFEL/Config/TFELTypes.hxx\"\n"
+        << "#include \"TFEL/Raise.hxx\"\n"
+        << "#include \"TFEL/PhysicalConstants.hxx\"\n"
+        << "#include \"TFEL/Math/General/IEEE754.hxx\"\n"
+        << "#include \"TFEL/Math/tvector.hxx\"\n"
+        << "#include \"TFEL/Math/tmatrix.hxx\"\n"
+        << "#include \"TFEL/Math/stensor.hxx\"\n"
+        << "#include \"TFEL/Math/st2tost2.hxx\"\n"
+        << "#include \"TFEL/Material/ModellingHypothesis.hxx\"\n"
+        << "#include \"TFEL/Material/OutOfBoundsPolicy.hxx\"\n"
+        << "#include \"TFEL/Material/MechanicalBehaviour.hxx\"\n\n"
+        << "#endif /* __cplusplus */\n\n"
+        << "#endif /* LIB_MFRONT_PCH_HXX */\n";
+    out.close();
+  }  // end of writePrecompiledHeader
+
+  unsigned int getDefaultNumberOfBuildJobs() {
+    return std::max(std::thread::hardware_concurrency(), 1u);
+  }  // end of getDefaultNumberOfBuildJobs
+
+  TargetsDescription generateUnityBuildSources(const TargetsDescription& t,
+                                               const std::string& d,
+                                               const std::size_t n) {
+    using tfel::utilities::ends_with;
+    tfel::raise_if(n == 0, "generateUnityBuildSources: invalid batch size");
+    auto r = TargetsDescription{t};
+    for (auto& l : r.libraries) {
+      auto sources = std::vector<std::string>{};
+      auto cxx_sources = std::vector<std::string>{};
+      for (const auto& s : l.sources) {
+        if ((ends_with(s, ".cxx")) || (ends_with(s, ".cpp"))) {
+          cxx_sources.push_back(s);
+        } else {
+          sources.push_back(s);
+        }
+      }
+      if (cxx_sources.size() < 2) {
+        continue;
+      }
+      for (std::size_t i = 0; i * n < cxx_sources.size(); ++i) {
+        const auto f = l.name + "-unity-" + std::to_string(i) + ".cxx";
+        GeneratedFileStream out;
+        openGeneratedFile(out, d, f);
+        out << "/*!\n"
+            << " * \\file   " << f << '\n'
+            << " * \\brief  unity source of library " << l.name << '\n'
+            << " *         File generated by mfront.\n"
+            << " */\n\n";
+        const auto pe = std::min((i + 1) * n, cxx_sources.size());
+        for (auto j = i * n; j != pe; ++j) {
+          out << "#include \"" << cxx_sources[j] << "\"\n";
+        }
+        out.close();
+        sources.push_back(f);
+      }
+      l.sources = std::move(sources);
+    }
+    return r;
+  }  // end of generateUnityBuildSources
+
+}  // end of namespace mfront
@@ -12,10 +12,10 @@
  */
 
 #include <sstream>
-#include <fstream>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/System/System.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/FileDescription.hxx"
 #include "MFront/LibraryDescription.hxx"
@@ -1127,7 +1127,7 @@ namespace mfront {
         (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) &&
         (bd.isStrainMeasureDefined()) &&
         (bd.getStrainMeasure() != BehaviourDescription::LINEARISED);
-    std::ofstream out("include/MFront/GenericBehaviour/" + header);
+    GeneratedFileStream out("include/MFront/GenericBehaviour/" + header);
     if (!out) {
       raise("could not open file '" + header + "'");
     }
@@ -56,6 +56,10 @@ namespace mfront {
     return "GENERIC_MATERIALPROPERTY";
   }  // end of getOutOfBoundsPolicyEnumerationPrefix
 
+  bool GenericMaterialPropertyInterface::shallGenerateArrayEntryPoint() const {
+    return true;
+  }  // end of shallGenerateArrayEntryPoint
+
   GenericMaterialPropertyInterface::~GenericMaterialPropertyInterface() =
       default;
 
@@ -24,6 +24,7 @@
 #include "TFEL/System/System.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/MFrontHeader.hxx"
 #include "MFront/MFrontLock.hxx"
 #include "MFront/DSLUtilities.hxx"
@@ -40,6 +41,11 @@ namespace mfront {
   GenericMaterialPropertyInterfaceBase::GenericMaterialPropertyInterfaceBase() =
       default;
 
+  bool GenericMaterialPropertyInterfaceBase::shallGenerateArrayEntryPoint()
+      const {
+    return false;
+  }  // end of shallGenerateArrayEntryPoint
+
   std::pair<bool,
             tfel::utilities::CxxTokenizer::TokensContainer::const_iterator>
   GenericMaterialPropertyInterfaceBase::treatKeyword(
@@ -234,6 +240,108 @@ namespace mfront {
     }
   }  // end of writeBounds
 
+  /*!
+   * \return the condition stating that the i-th value of the given array
+   * is out of the given bounds
+   * \param[in] b: bounds
+   * \param[in] real_type: floating point type
+   * \param[in] values: name of the array of values
+   */
+  static std::string getArrayBoundsViolationCondition(
+      const VariableBoundsDescription& b,
+      const std::string& real_type,
+      const std::string& values) {
+    const auto x = values + "[mfront_i]";
+    auto bound = [&real_type](const long double v) {
+      auto o = std::ostringstream{};
+      o << real_type << "(" << v << ")";
+      return o.str();
+    };
+    const auto lb = "(" + x + " < " + bound(b.lowerBound) + ")";
+    const auto ub = "(" + x + " > " + bound(b.upperBound) + ")";
+    if (b.boundsType == VariableBoundsDescription::LOWER) {
+      return lb;
+    } else if (b.boundsType == VariableBoundsDescription::UPPER) {
+      return ub;
+    }
+    return "(" + lb + " || " + ub + ")";
+  }  // end of getArrayBoundsViolationCondition
+
+  /*!
+   * \brief write a loop counting the number of values of the given array
+   * which are out of the given bounds. The result is stored in the
+   * `mfront_nvalues` variable. This loop is meant to be vectorised by the
+   * compiler.
+   */
+  static void writeArrayBoundsViolationsCount(
+      std::ostream& os,
+      const VariableBoundsDescription& b,
+      const std::string& real_type,
+      const std::string& integer_type,
+      const std::string& values) {
+    os << "auto mfront_nvalues = " << integer_type << "{0};\n"
+       << "for (auto mfront_i = " << integer_type
+       << "{0}; mfront_i != mfront_n; ++mfront_i) {\n"
+       << "mfront_nvalues += "
+       << getArrayBoundsViolationCondition(b, real_type, values)
+       << " ? 1 : 0;\n"
+       << "}\n";
+  }  // end of writeArrayBoundsViolationsCount
+
+  static void writeArrayPhysicalBounds(std::ostream& os,
+                                       const std::string& real_type,
+                                       const std::string& integer_type,
+                                       const VariableDescription& v,
+                                       const std::string& values,
+                                       const size_t i) {
+    if (!v.hasPhysicalBounds()) {
+      return;
+    }
+    os << "{\n";
+    writeArrayBoundsViolationsCount(os, v.getPhysicalBounds(), real_type,
+                                    integer_type, values);
+    os << "if(mfront_nvalues != 0){\n"
+       << "mfront_report(std::to_string(mfront_nvalues) + \" value(s) of "
+       << v.name << " are out of the physical bounds.\\n\");\n"
+       << "mfront_output_status->status = -1;\n"
+       << "mfront_output_status->bounds_status = -" << i << ";\n"
+       << "mfront_invalidate_outputs();\n"
+       << "errno = mfront_errno_old;\n"
+       << "return;\n"
+       << "}\n"
+       << "}\n";
+  }  // end of writeArrayPhysicalBounds
+
+  static void writeArrayBounds(std::ostream& os,
+                               const std::string& iucname,
+                               const std::string& real_type,
+                               const std::string& integer_type,
+                               const VariableDescription& v,
+                               const std::string& values,
+                               const size_t i) {
+    if (!v.hasBounds()) {
+      return;
+    }
+    os << "if(mfront_out_of_bounds_policy!=" << iucname << "_NONE_POLICY){\n";
+    writeArrayBoundsViolationsCount(os, v.getBounds(), real_type, integer_type,
+                                    values);
+    os << "if(mfront_nvalues != 0){\n"
+       << "mfront_report(std::to_string(mfront_nvalues) + \" value(s) of "
+       << v.name << " are out of bounds.\\n\");\n"
+       << "if(mfront_out_of_bounds_policy==" << iucname
+       << "_STRICT_POLICY){\n"
+       << "mfront_output_status->status = -1;\n"
+       << "mfront_output_status->bounds_status = -" << i << ";\n"
+       << "mfront_invalidate_outputs();\n"
+       << "errno = mfront_errno_old;\n"
+       << "return;\n"
+       << "}\n"
+       << "mfront_output_status->status = 1;\n"
+       << "mfront_output_status->bounds_status = " << i << ";\n"
+       << "}\n"
+       << "}\n";
+  }  // end of writeArrayBounds
+
   void GenericMaterialPropertyInterfaceBase::writeOutputFiles(
       const MaterialPropertyDescription& mpd, const FileDescription& fd) const {
     this->writeHeaderFile(mpd, fd);
@@ -246,7 +354,7 @@ namespace mfront {
     const auto types = this->getTypesDescription();
     const auto name = this->getFunctionName(mpd);
     const auto fn = "include/" + this->getHeaderFileName(name);
-    std::ofstream os{fn};
+    GeneratedFileStream os{fn};
     tfel::raise_if(!os,
                    "GenericMaterialPropertyInterfaceBase::writeOutputFiles: "
                    "unable to open '" +
@@ -285,6 +393,15 @@ namespace mfront {
        << "const " << types.real_type << "* const,"
        << "const " << types.integer_type << ","
        << "const " << types.out_of_bounds_policy_type << ");\n\n";
+    if (this->shallGenerateArrayEntryPoint()) {
+      os << "MFRONT_SHAREDOBJ void\n"
+         << name << "_array(" << types.output_status_type << "* const,"
+         << types.real_type << "* const,"
+         << "const " << types.real_type << "* const* const,"
+         << "const " << types.integer_type << ","
+         << "const " << types.integer_type << ","
+         << "const " << types.out_of_bounds_policy_type << ");\n\n";
+    }
     if (!mpd.parameters.empty()) {
       os << "MFRONT_SHAREDOBJ int\n"
          << name << "_setParameter(const char *const,"
@@ -305,7 +422,7 @@ namespace mfront {
     const auto prefix = this->getOutOfBoundsPolicyEnumerationPrefix();
     const auto name = this->getFunctionName(mpd);
     const auto fn = "src/" + this->getSourceFileName(name);
-    std::ofstream os{fn};
+    GeneratedFileStream os{fn};
     tfel::raise_if(!os,
                    "GenericMaterialPropertyInterfaceBase::writeOutputFiles: "
                    "unable to open '" +
@@ -459,7 +576,10 @@ namespace mfront {
            << "return std::nan(" << iname << "::" << name
            << "MaterialPropertyHandler::get" << name
            << "MaterialPropertyHandler().msg.c_str());\n"
-           << "}\n";
+           << "}\n"
+           << "// the first access to the parameters handler may have\n"
+           << "// modified errno, notably if no parameters file exists\n"
+           << "errno = 0;\n";
       }
     }
     writeAssignMaterialPropertyParameters(os, mpd, name, "real", iname);
@@ -537,24 +657,204 @@ namespace mfront {
          << "mfront_output_status->status = -3;\n"
          << "mfront_output_status->c_error_number = errno;\n"
          << "mfront_report(strerror(errno));\n"
-         << "}\n"
-         << "errno = mfront_errno_old;\n"
-         << "if(!tfel::math::ieee754::isfinite(" << mpd.output.name << ")){\n"
+         << "} else if(!tfel::math::ieee754::isfinite(" << mpd.output.name
+         << ")){\n"
          << "mfront_output_status->status = -4;\n"
-         << "}\n";
+         << "}\n"
+         << "errno = mfront_errno_old;\n";
     }
     if (useQuantities(mpd)) {
       os << "return " << mpd.output.name << ".getValue();\n";
     } else {
       os << "return " << mpd.output.name << ";\n";
     }
-    os << "} // end of " << name << "\n\n"
-       << "#ifdef __cplusplus\n"
+    os << "} // end of " << name << "\n\n";
+    if (this->shallGenerateArrayEntryPoint()) {
+      this->writeArrayEntryPoint(os, mpd, fd);
+    }
+    os << "#ifdef __cplusplus\n"
        << "} // end of extern \"C\"\n"
        << "#endif /* __cplusplus */\n\n";
     os.close();
   }  // end of writeSrcFile()
 
+  void GenericMaterialPropertyInterfaceBase::writeArrayEntryPoint(
+      std::ostream& os,
+      const MaterialPropertyDescription& mpd,
+      const FileDescription& fd) const {
+    const auto types = this->getTypesDescription();
+    const auto iucname = this->getInterfaceNameInUpperCase();
+    const auto iname = this->getInterfaceName();
+    const auto prefix = this->getOutOfBoundsPolicyEnumerationPrefix();
+    const auto name = this->getFunctionName(mpd);
+    const auto& params = mpd.parameters;
+    const auto checks = !areRuntimeChecksDisabled(mpd);
+    const auto has_bounds = (hasBounds(mpd.inputs)) ||
+                            (hasBounds(mpd.output)) ||
+                            (hasPhysicalBounds(mpd.inputs)) ||
+                            (hasPhysicalBounds(mpd.output));
+    os << "MFRONT_SHAREDOBJ void\n"
+       << name << "_array(" << types.output_status_type
+       << "* const mfront_output_status,\n"
+       << types.real_type << "* const mfront_outputs,\n";
+    if (!mpd.inputs.empty()) {
+      os << "const " << types.real_type
+         << "* const* const mfront_arguments,\n";
+    } else {
+      os << "const " << types.real_type << "* const* const,\n";
+    }
+    os << "const " << types.integer_type << " mfront_nargs,\n"
+       << "const " << types.integer_type << " mfront_n,\n";
+    if ((checks) && (has_bounds)) {
+      os << "const " << types.out_of_bounds_policy_type
+         << " mfront_out_of_bounds_policy";
+    } else {
+      os << "const " << types.out_of_bounds_policy_type << "";
+    }
+    os << ")\n{\n";
+    writeBeginningOfMaterialPropertyBody(os, mpd, fd, "double", true);
+    os << "auto mfront_report = "
+       << "[&mfront_output_status](const std::string& "
+       << "mfront_error_message){\n"
+       << "if(mfront_error_message.empty()){\n"
+       << "return;\n"
+       << "}\n"
+       << "std::strncpy(mfront_output_status->msg,"
+       << "mfront_error_message.c_str(),511);\n"
+       << "mfront_output_status->msg[511]='\\0';\n"
+       << "};\n"
+       << "auto mfront_invalidate_outputs = [mfront_outputs, mfront_n]{\n"
+       << "std::fill(mfront_outputs, mfront_outputs + mfront_n, "
+       << "std::nan(\"\"));\n"
+       << "};\n";
+    if (checks) {
+      os << "const int mfront_errno_old = errno;\n";
+    }
+    os << "mfront_output_status->status = 0;\n"
+       << "mfront_output_status->bounds_status = 0;\n"
+       << "mfront_output_status->c_error_number = 0;\n";
+    if (checks) {
+      os << "errno = 0;\n"
+         << "if(mfront_nargs!= " << mpd.inputs.size() << "){\n"
+         << "mfront_output_status->status = -5;\n"
+         << "mfront_report(\"invalid number of arguments "
+         << "(\"+std::to_string(mfront_nargs)+\" given, " << mpd.inputs.size()
+         << " expected)\");\n"
+         << "mfront_invalidate_outputs();\n"
+         << "errno = mfront_errno_old;\n"
+         << "return;\n"
+         << "}\n";
+      if ((!areParametersTreatedAsStaticVariables(mpd)) && (!params.empty())) {
+        const auto hn = getMaterialPropertyParametersHandlerClassName(name);
+        os << "if(!" << iname << "::" << hn << "::get" << hn << "().ok){\n"
+           << "mfront_output_status->status = -6;\n"
+           << "mfront_report(" << iname << "::" << hn << "::get" << hn
+           << "().msg);\n"
+           << "mfront_invalidate_outputs();\n"
+           << "errno = mfront_errno_old;\n"
+           << "return;\n"
+           << "}\n"
+           << "// the first access to the parameters handler may have\n"
+           << "// modified errno, notably if no parameters file exists\n"
+           << "errno = 0;\n";
+      }
+    }
+    writeAssignMaterialPropertyParameters(os, mpd, name, "real", iname);
+    if ((checks) &&
+        ((hasPhysicalBounds(mpd.inputs)) || (hasBounds(mpd.inputs)))) {
+      // the bounds are checked once for the whole set of points, before
+      // any evaluation
+      os << "#ifndef NO_" << iucname << "_BOUNDS_CHECK\n";
+      for (decltype(mpd.inputs.size()) i = 0; i != mpd.inputs.size(); ++i) {
+        const auto values = "mfront_arguments[" + std::to_string(i) + "]";
+        writeArrayPhysicalBounds(os, types.real_type, types.integer_type,
+                                 mpd.inputs[i], values, i + 1);
+      }
+      for (decltype(mpd.inputs.size()) i = 0; i != mpd.inputs.size(); ++i) {
+        const auto values = "mfront_arguments[" + std::to_string(i) + "]";
+        writeArrayBounds(os, prefix, types.real_type, types.integer_type,
+                         mpd.inputs[i], values, i + 1);
+      }
+      os << "#endif /* NO_" << iucname << "_BOUNDS_CHECK */\n";
+    }
+    // the loop over the points is kept free of any check to allow the
+    // compiler to vectorise it
+    os << "try{\n";
+    for (decltype(mpd.inputs.size()) i = 0; i != mpd.inputs.size(); ++i) {
+      os << "const auto* const mfront_" << mpd.inputs[i].name
+         << "_values = mfront_arguments[" << i << "];\n";
+    }
+    os << "for (auto mfront_i = " << types.integer_type
+       << "{0}; mfront_i != mfront_n; ++mfront_i) {\n";
+    for (const auto& i : mpd.inputs) {
+      const auto cast_start = useQuantities(mpd) ? i.type + "(" : "";
+      const auto cast_end = useQuantities(mpd) ? ")" : "";
+      os << "const auto " << i.name << " = " << cast_start << "mfront_"
+         << i.name << "_values[mfront_i]" << cast_end << ";\n";
+    }
+    os << "auto " << mpd.output.name << " = " << mpd.output.type << "{};\n"
+       << "{\n"
+       << mpd.f.body << "\n"
+       << "}\n";
+    if (useQuantities(mpd)) {
+      os << "mfront_outputs[mfront_i] = " << mpd.output.name
+         << ".getValue();\n";
+    } else {
+      os << "mfront_outputs[mfront_i] = " << mpd.output.name << ";\n";
+    }
+    os << "}\n"
+       << "} catch(std::exception& e){\n"
+       << "mfront_output_status->status = -2;\n"
+       << "mfront_report(e.what());\n"
+       << "mfront_invalidate_outputs();\n";
+    if (checks) {
+      os << "errno = mfront_errno_old;\n";
+    }
+    os << "return;\n"
+       << "} catch(...){\n"
+       << "mfront_output_status->status = -2;\n"
+       << "mfront_report(\"unknown C++ exception\");\n"
+       << "mfront_invalidate_outputs();\n";
+    if (checks) {
+      os << "errno = mfront_errno_old;\n";
+    }
+    os << "return;\n"
+       << "}\n";
+    if (checks) {
+      if ((mpd.output.hasPhysicalBounds()) || (mpd.output.hasBounds())) {
+        os << "#ifndef NO_" << iucname << "_BOUNDS_CHECK\n";
+        writeArrayPhysicalBounds(os, types.real_type, types.integer_type,
+                                 mpd.output, "mfront_outputs",
+                                 mpd.inputs.size() + 1);
+        writeArrayBounds(os, prefix, types.real_type, types.integer_type,
+                         mpd.output, "mfront_outputs", mpd.inputs.size() + 1);
+        os << "#endif /* NO_" << iucname << "_BOUNDS_CHECK */\n";
+      }
+      os << "if (errno != 0) {\n"
+         << "mfront_output_status->status = -3;\n"
+         << "mfront_output_status->c_error_number = errno;\n"
+         << "mfront_report(strerror(errno));\n"
+         << "} else {\n"
+         << "// the invalid values are only reported if no error was\n"
+         << "// reported by the C library, since such errors generally\n"
+         << "// also lead to invalid values\n"
+         << "auto mfront_nvalues = " << types.integer_type << "{0};\n"
+         << "for (auto mfront_i = " << types.integer_type
+         << "{0}; mfront_i != mfront_n; ++mfront_i) {\n"
+         << "mfront_nvalues += "
+         << "tfel::math::ieee754::isfinite(mfront_outputs[mfront_i]) ? 0 : 1;\n"
+         << "}\n"
+         << "if(mfront_nvalues != 0){\n"
+         << "mfront_output_status->status = -4;\n"
+         << "mfront_report(std::to_string(mfront_nvalues) + "
+         << "\" invalid value(s) computed\");\n"
+         << "}\n"
+         << "}\n"
+         << "errno = mfront_errno_old;\n";
+    }
+    os << "} // end of " << name << "_array\n\n";
+  }  // end of writeArrayEntryPoint
+
   GenericMaterialPropertyInterfaceBase::
       ~GenericMaterialPropertyInterfaceBase() = default;
 
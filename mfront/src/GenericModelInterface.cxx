@@ -11,12 +11,12 @@
  * project under specific licensing conditions.
  */
 
-#include <fstream>
 #include <algorithm>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/System/System.hxx"
 #include "TFEL/Material/ModellingHypothesis.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/FileDescription.hxx"
@@ -125,7 +125,7 @@ namespace mfront {
     tfel::system::systemCall::mkdir("include/MFront/GenericModel");
     const auto name = md.library + md.className;
     const auto header = name + "-generic.hxx";
-    std::ofstream os("include/MFront/GenericModel/" + header);
+    GeneratedFileStream os("include/MFront/GenericModel/" + header);
     if (!os) {
       raise("could not open file '" + header + "'");
     }
@@ -161,6 +161,21 @@ namespace mfront {
          << name << "_setParameter(const char *const, const double);\n\n";
     }
 
+    os << "/*!\n"
+       << " * \\brief function evaluating the " << name
+       << " model on a field of points\n"
+       << " *\n"
+       << " * The values of the variables are stored by variable: the value\n"
+       << " * of the j-th variable at the i-th point is stored at index\n"
+       << " * i + j * n.\n"
+       << " *\n"
+       << " * \\param[in,out] d: material data\n"
+       << " * \\param[in] n: number of points\n"
+       << " */\n"
+       << "MFRONT_SHAREDOBJ int " << name
+       << "_array(mfront_gb_BehaviourData* const, const mfront_gb_size_type);"
+       << "\n\n";
+
     for (const auto& h : ModellingHypothesis::getModellingHypotheses()) {
       const auto f = name + "_" + ModellingHypothesis::toString(h);
       os << "/*!\n"
@@ -199,11 +214,22 @@ namespace mfront {
       }
       return pv - variables.begin();
     };  // end of getVariablePosition
+    // index of a variable in the arrays of the behaviour data. When
+    // evaluating the model on a field, the values of the variables are
+    // stored by variable.
+    auto getVariableIndex = [&getVariablePosition](const auto& variables,
+                                                   const auto& n) {
+      const auto pos = getVariablePosition(variables, n);
+      if (pos == 0) {
+        return std::string{"mfront_offset"};
+      }
+      return "mfront_offset + " + std::to_string(pos) + " * mfront_stride";
+    };  // end of getVariableIndex
     const auto name = md.library + md.className;
     const auto header = name + "-generic.hxx";
     const auto src = name + "-generic.cxx";
     const auto cn = md.className + "RealParametersInitializer";
-    std::ofstream os("src/" + src);
+    GeneratedFileStream os("src/" + src);
     os.precision(14);
     if (!os) {
       raise("could not open file '" + src + "'");
@@ -225,7 +251,8 @@ namespace mfront {
       os << "#include \"TFEL/Math/qt.hxx\"\n";
     }
     os << "#include \"TFEL/Material/BoundsCheck.hxx\"\n";
-    os << "#include \"MFront/GenericBehaviour/Integrate.hxx\"\n\n"
+    os << "#include \"MFront/GenericBehaviour/Integrate.hxx\"\n"
+       << "#include \"MFront/GenericModel/EvaluateField.hxx\"\n\n"
        << "#include \"MFront/GenericModel/" << header << "\"\n\n";
     //
     if (!md.includes.empty()) {
@@ -281,14 +308,16 @@ namespace mfront {
     if (has_constructor) {
       os << md.className << "(";
       if (!md.constantMaterialProperties.empty()) {
-        os << "const mfront_gb_BehaviourData& mfront_model_data";
+        os << "const mfront_gb_BehaviourData& mfront_model_data,\n"
+           << "const mfront_gb_size_type mfront_offset = 0,\n"
+           << "const mfront_gb_size_type mfront_stride = 1";
       }
       os << ")\n:";
       auto first = true;
       for (const auto& mp : md.constantMaterialProperties) {
         os << (first ? "" : ",\n");
         os << mp.name << "(mfront_model_data.s1.material_properties["
-           << getVariablePosition(md.constantMaterialProperties, mp.name)
+           << getVariableIndex(md.constantMaterialProperties, mp.name)
            << "])";
         first = false;
       }
@@ -305,7 +334,10 @@ namespace mfront {
     }
     for (const auto& f : md.functions) {
       os << "void execute_" << f.name
-         << "(mfront_gb_BehaviourData& mfront_model_data) const{\n";
+         << "(mfront_gb_BehaviourData& mfront_model_data,\n"
+         << "[[maybe_unused]] const mfront_gb_size_type mfront_offset = 0,\n"
+         << "[[maybe_unused]] const mfront_gb_size_type mfront_stride = 1) "
+         << "const{\n";
       os << "using namespace std;\n"
          << "using namespace tfel::math;\n"
          << "using namespace tfel::material;\n";
@@ -324,20 +356,20 @@ namespace mfront {
       }
       for (const auto& mv : f.modifiedVariables) {
         const auto& v = md.outputs.getVariable(mv);
-        const auto pos = getVariablePosition(md.outputs, mv);
+        const auto pos = getVariableIndex(md.outputs, mv);
         os << "auto " << v.name << " = " << v.type
            << "{mfront_model_data.s0.internal_state_variables[" << pos
            << "]};\n";
       }
       for (const auto& mv : f.usedVariables) {
         const auto [n, vdepth] = md.decomposeVariableName(mv);
-        const auto [v, type, pos] = [&md, &getVariablePosition, n = n]()
-            -> std::tuple<VariableDescription, std::string, std::ptrdiff_t> {
+        const auto [v, type, pos] = [&md, &getVariableIndex, n = n]()
+            -> std::tuple<VariableDescription, std::string, std::string> {
           if (md.outputs.contains(n)) {
-            const auto vpos = getVariablePosition(md.outputs, n);
+            const auto vpos = getVariableIndex(md.outputs, n);
             return {md.outputs.getVariable(n), "internal", vpos};
           }
-          const auto vpos = getVariablePosition(md.inputs, n);
+          const auto vpos = getVariableIndex(md.inputs, n);
           return {md.inputs.getVariable(n), "external", vpos};
         }();
         if (vdepth > 1) {
@@ -421,7 +453,7 @@ namespace mfront {
       for (const auto& mv : f.modifiedVariables) {
         const auto [n, vdepth] = md.decomposeVariableName(mv);
         const auto& v = md.outputs.getVariable(mv);
-        const auto pos = getVariablePosition(md.outputs, mv);
+        const auto pos = getVariableIndex(md.outputs, mv);
         os << "tfel::math::map<" << v.type
            << ">(mfront_model_data.s1.internal_state_variables[" << pos
            << "]) = " << v.name << ";\n";
@@ -496,6 +528,30 @@ namespace mfront {
        << "}\n"
        << "return 1;\n"
        << "}\n\n";
+    os << "static int " << name
+       << "_array_implementation(mfront_gb_BehaviourData& d,\n"
+       << "const mfront_gb_size_type b,\n"
+       << "const mfront_gb_size_type e,\n"
+       << "const mfront_gb_size_type n){\n";
+    os << "try{\n";
+    if (md.constantMaterialProperties.empty()) {
+      os << "const " << md.className << " m;\n";
+    }
+    os << "for(auto i = b; i != e; ++i){\n";
+    if (!md.constantMaterialProperties.empty()) {
+      os << "const " << md.className << " m(d, i, n);\n";
+    }
+    for (const auto& f : md.functions) {
+      os << "m.execute_" << f.name << "(d, i, n);\n";
+    }
+    os << "}\n"
+       << "} catch(...){\n"
+       << "mfront::gb::reportFailureByException(d);\n"
+       << "*(d.rdt) = 0.1;\n"
+       << "return -1;"
+       << "}\n"
+       << "return 1;\n"
+       << "}\n\n";
     os << "} // end of namespace mfront::gm\n\n";
     //
     if ((hasRealParameters(md)) &&
@@ -521,6 +577,16 @@ namespace mfront {
          << "} // end of " << name << "_setParameter\n\n";
     }
     //
+    os << "int " << name << "_array(mfront_gb_BehaviourData* const d, "
+       << "const mfront_gb_size_type n){\n"
+       << "auto f = [n](mfront_gb_BehaviourData& cd, "
+       << "const mfront_gb_size_type b, const mfront_gb_size_type e){\n"
+       << "return mfront::gm::" << name
+       << "_array_implementation(cd, b, e, n);\n"
+       << "};\n"
+       << "return mfront::gm::evaluateField(*d, n, f);\n"
+       << "}\n\n";
+    //
     for (const auto& h : ModellingHypothesis::getModellingHypotheses()) {
       const auto fct = name + "_" + ModellingHypothesis::toString(h);
       os << "int " << fct << "(mfront_gb_BehaviourData* const d){\n"
@@ -546,7 +612,7 @@ namespace mfront {
               "$(shell " + tfel_config + " --library-path)");
     insert_if(l.link_libraries, "$(shell " + tfel_config +
                                     " --library-dependency "
-                                    "--material --mfront-profiling)");
+                                    "--material --system --mfront-profiling)");
     for (const auto& h : ModellingHypothesis::getModellingHypotheses()) {
       insert_if(l.epts, name + "_" + ModellingHypothesis::toString(h));
     }
@@ -16,6 +16,7 @@
 #include <stdexcept>
 
 #include "TFEL/Raise.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/MFrontHeader.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontUtilities.hxx"
@@ -202,7 +203,7 @@ namespace mfront {
     const auto& inputs = mpd.inputs;
     const auto name =
         (material.empty()) ? className : material + "_" + className;
-    std::ofstream out("src/" + name + ".gp");
+    GeneratedFileStream out("src/" + name + ".gp");
     tfel::raise_if(!out,
                    "GnuplotMaterialPropertyInterface::writeOutputFiles: "
                    "unable to open 'src/" +
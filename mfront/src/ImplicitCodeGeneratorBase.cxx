@@ -1057,6 +1057,7 @@ namespace mfront {
     os << "using namespace tfel::math;\n";
     writeMaterialLaws(os, this->bd.getMaterialLaws());
     os << "this->stiffness_matrix_type = smt;" << '\n';
+    os << "this->iter = 0;\n";
     if (!this->bd.getTangentOperatorBlocks().empty()) {
       if ((this->bd.getBehaviourType() ==
            BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) ||
@@ -1083,7 +1084,57 @@ namespace mfront {
                                              BehaviourData::Integrator);
     }
     this->solver.initializeNumericalParameters(os, this->bd, h);
-    os << "if(!this->solveNonLinearSystem()){\n";
+    // If the behaviour provides a criterion stating that the time step is
+    // most likely elastic, the elastic solution is tested first. The
+    // implicit system is only solved if this solution is rejected. This
+    // is only possible if the jacobian is fully computed by
+    // `computeFdF` or numerically, so that the consistent tangent
+    // operator can be computed as usual.
+    const auto try_elastic_step = [this, &d, h] {
+      if ((this->bd.getBehaviourType() !=
+           BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) ||
+          (!this->bd.hasAttribute(h, BehaviourData::elasticStepCriterion)) ||
+          (this->bd
+               .getAttribute<std::string>(h,
+                                          BehaviourData::elasticStepCriterion)
+               .empty()) ||
+          (!this->bd.isGradientName("eto")) ||
+          (!d.isIntegrationVariableName("eel"))) {
+        return false;
+      }
+      return (this->solver.usesJacobian()) &&
+             ((this->solver.requiresNumericalJacobian()) ||
+              (this->solver
+                   .requiresJacobianToBeReinitialisedToIdentityAtEachIterations()));
+    }();
+    if (try_elastic_step) {
+      const auto& c = this->bd.getAttribute<std::string>(
+          h, BehaviourData::elasticStepCriterion);
+      os << "this->mfront_elastic_step = false;\n"
+         << "if(" << c << "){\n"
+         << "const auto mfront_initial_zeros = this->zeros;\n"
+         << "std::fill(this->zeros.begin(), this->zeros.end(), "
+         << "NumericType(0));\n";
+      if (this->bd.hasAttribute(h, "eel_normalisation_factor")) {
+        const auto& nf =
+            this->bd.getAttribute<std::string>(h, "eel_normalisation_factor");
+        os << "this->deel = (this->deto) / (" << nf << ");\n";
+      } else {
+        os << "this->deel = this->deto;\n";
+      }
+      os << "if(this->computeResidual()){\n"
+         << "this->mfront_elastic_step = "
+         << "this->checkConvergence(this->computeResidualNorm());\n"
+         << "}\n"
+         << "if(!this->mfront_elastic_step){\n"
+         << "this->zeros = mfront_initial_zeros;\n"
+         << "}\n"
+         << "}\n"
+         << "if((!this->mfront_elastic_step) && "
+         << "(!this->solveNonLinearSystem())){\n";
+    } else {
+      os << "if(!this->solveNonLinearSystem()){\n";
+    }
     if (this->bd.useQt()) {
       os << "return MechanicalBehaviour<" << btype
          << ",hypothesis, NumericType, use_qt>::FAILURE;\n";
@@ -1170,7 +1221,27 @@ namespace mfront {
        << "TFEL_HOST_DEVICE NumericType computeResidualNorm() {\n"
        << "return tfel::math::norm(this->fzeros) / (" << n2 << ");\n"
        << "}\n"
-       << "/*!\n"
+       << "//! \\return the number of iterations of the last resolution\n"
+       << "TFEL_HOST_DEVICE unsigned short "
+       << "getNumberOfIterations() const noexcept {\n"
+       << "return this->iter;\n"
+       << "}\n"
+       << "//! \\return the norm of the last residual computed\n"
+       << "TFEL_HOST_DEVICE NumericType getResidualNorm() const noexcept {\n"
+       << "return tfel::math::norm(this->fzeros) / (" << n2 << ");\n"
+       << "}\n";
+    if (try_elastic_step) {
+      os << "/*!\n"
+         << " * \\return if the resolution of the implicit system was skipped\n"
+         << " * since the elastic solution satisfies it\n"
+         << " */\n"
+         << "TFEL_HOST_DEVICE bool isElasticStep() const noexcept {\n"
+         << "return this->mfront_elastic_step;\n"
+         << "}\n"
+         << "//! \\brief boolean stating if the time step is elastic\n"
+         << "bool mfront_elastic_step = false;\n";
+    }
+    os << "/*!\n"
        << " * \\brief check the convergence of the method\n"
        << " * \\param[in] error: current error\n"
        << " */\n"
@@ -0,0 +1,236 @@
+/*!
+ * \file   mfront/src/InputFilesCache.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <filesystem>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/CxxTokenizer.hxx"
+#include "TFEL/Utilities/StringAlgorithms.hxx"
+#include "MFront/GeneratedFileStream.hxx"
+#include "MFront/MFrontLock.hxx"
+#include "MFront/MFrontLogStream.hxx"
+#include "MFront/MFrontUtilities.hxx"
+#include "MFront/InputFilesCache.hxx"
+
+namespace mfront {
+
+  /*!
+   * \return the hash of the content of a file, if the file can be read
+   * \param[in] f: file
+   */
+  static std::optional<std::string> hashFile(const std::string& f) {
+    std::ifstream in(f, std::ios::binary);
+    if (!in) {
+      return {};
+    }
+    return InputFilesCache::hash(std::string{
+        std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}});
+  }  // end of hashFile
+
+  /*!
+   * \brief write a string in the format read by the `CxxTokenizer` class
+   * \param[out] os: output stream
+   * \param[in] id: identifier
+   * \param[in] s: string
+   */
+  static void writeInputFilesCacheString(std::ostream& os,
+                                         const std::string& id,
+                                         const std::string& s) {
+    using tfel::utilities::replace_all;
+    os << id << " : \"" << replace_all(s, "\"", "\\\"") << "\";\n";
+  }  // end of writeInputFilesCacheString
+
+  /*!
+   * \brief read a cache file. Invalid cache files are ignored.
+   * \param[out] entries: entries read
+   * \param[in] f: cache file
+   */
+  static void readInputFilesCache(
+      std::map<std::string, InputFilesCache::Entry>& entries,
+      const std::string& f) {
+    using tfel::utilities::CxxTokenizer;
+    const auto m = "readInputFilesCache";
+    const std::ifstream test{f};
+    if (!test) {
+      return;
+    }
+    try {
+      CxxTokenizer tokenizer{f};
+      auto c = tokenizer.begin();
+      const auto pe = tokenizer.end();
+      while (c != pe) {
+        CxxTokenizer::readSpecifiedToken(m, "input", c, pe);
+        CxxTokenizer::readSpecifiedToken(m, ":", c, pe);
+        CxxTokenizer::readSpecifiedToken(m, "{", c, pe);
+        auto name = std::string{};
+        auto key = std::string{};
+        auto dependencies = std::vector<std::string>{};
+        auto hashes = std::vector<std::string>{};
+        auto targets = std::optional<TargetsDescription>{};
+        CxxTokenizer::checkNotEndOfLine(m, c, pe);
+        while (c->value != "}") {
+          const auto tag = c->value;
+          ++c;
+          CxxTokenizer::readSpecifiedToken(m, ":", c, pe);
+          if (tag == "targets") {
+            targets.emplace(read<TargetsDescription>(c, pe));
+          } else {
+            if (tag == "file") {
+              name = read<std::string>(c, pe);
+            } else if (tag == "key") {
+              key = read<std::string>(c, pe);
+            } else if (tag == "dependencies") {
+              dependencies = read<std::vector<std::string>>(c, pe);
+            } else if (tag == "hashes") {
+              hashes = read<std::vector<std::string>>(c, pe);
+            } else {
+              tfel::raise("readInputFilesCache: unexpected tag '" + tag +
+                          "'");
+            }
+            CxxTokenizer::readSpecifiedToken(m, ";", c, pe);
+          }
+          CxxTokenizer::checkNotEndOfLine(m, c, pe);
+        }
+        CxxTokenizer::readSpecifiedToken(m, "}", c, pe);
+        CxxTokenizer::readSpecifiedToken(m, ";", c, pe);
+        if ((name.empty()) || (!targets.has_value()) ||
+            (dependencies.size() != hashes.size())) {
+          tfel::raise("readInputFilesCache: invalid entry");
+        }
+        entries.erase(name);
+        entries.emplace(name, InputFilesCache::Entry{
+                                  key, dependencies, hashes,
+                                  std::move(*targets)});
+      }
+    } catch (...) {
+      entries.clear();
+    }
+  }  // end of readInputFilesCache
+
+  std::string InputFilesCache::hash(const std::string& s) {
+    // FNV-1a algorithm
+    auto h = std::uint64_t{14695981039346656037u};
+    for (const auto c : s) {
+      h ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+      h *= std::uint64_t{1099511628211u};
+    }
+    const auto digits = "0123456789abcdef";
+    auto r = std::string(16, '0');
+    for (auto i = r.rbegin(); i != r.rend(); ++i, h >>= 4) {
+      *i = digits[h & 0xf];
+    }
+    return r;
+  }  // end of hash
+
+  InputFilesCache::InputFilesCache(const std::string& f, const std::string& k)
+      : file(f), key(k) {
+    MFrontLockGuard lock;
+    readInputFilesCache(this->entries, this->file);
+  }  // end of InputFilesCache
+
+  std::optional<TargetsDescription> InputFilesCache::get(
+      const std::string& f) const {
+    namespace fs = std::filesystem;
+    auto e = [this, &f]() -> std::optional<Entry> {
+      std::lock_guard<std::mutex> lock(this->m);
+      const auto p = this->entries.find(f);
+      if ((p == this->entries.end()) || (p->second.key != this->key)) {
+        return {};
+      }
+      return p->second;
+    }();
+    if ((!e.has_value()) || (e->dependencies.empty())) {
+      return {};
+    }
+    for (decltype(e->dependencies.size()) i = 0; i != e->dependencies.size();
+         ++i) {
+      const auto h = hashFile(e->dependencies[i]);
+      if ((!h.has_value()) || (*h != e->hashes[i])) {
+        return {};
+      }
+    }
+    // checking that the generated files still exist
+    auto ec = std::error_code{};
+    for (const auto& l : e->targets.libraries) {
+      for (const auto& s : l.sources) {
+        if (!fs::exists(fs::path("src") / s, ec)) {
+          return {};
+        }
+      }
+    }
+    for (const auto& h : e->targets.headers) {
+      if (!fs::exists(fs::path("include") / h, ec)) {
+        return {};
+      }
+    }
+    return std::move(e->targets);
+  }  // end of get
+
+  void InputFilesCache::update(const std::string& f,
+                               const std::set<std::string>& d,
+                               const TargetsDescription& t) {
+    auto dependencies = std::vector<std::string>{};
+    auto hashes = std::vector<std::string>{};
+    for (const auto& df : d) {
+      const auto h = hashFile(df);
+      if (!h.has_value()) {
+        // files which can't be read can't be tracked
+        std::lock_guard<std::mutex> lock(this->m);
+        this->entries.erase(f);
+        this->updated.insert(f);
+        return;
+      }
+      dependencies.push_back(df);
+      hashes.push_back(*h);
+    }
+    std::lock_guard<std::mutex> lock(this->m);
+    this->entries.erase(f);
+    this->entries.emplace(f, Entry{this->key, std::move(dependencies),
+                                   std::move(hashes), t});
+    this->updated.insert(f);
+  }  // end of update
+
+  void InputFilesCache::write() const {
+    MFrontLockGuard lock;
+    std::lock_guard<std::mutex> lock2(this->m);
+    // entries written by concurrent sessions are preserved
+    auto all = std::map<std::string, Entry>{};
+    readInputFilesCache(all, this->file);
+    for (const auto& f : this->updated) {
+      all.erase(f);
+      const auto p = this->entries.find(f);
+      if (p != this->entries.end()) {
+        all.emplace(f, p->second);
+      }
+    }
+    GeneratedFileStream out{this->file};
+    if (!out) {
+      getLogStream() << "can't open file '" << this->file << "'\n";
+      return;
+    }
+    for (const auto& [f, e] : all) {
+      out << "input : {\n";
+      writeInputFilesCacheString(out, "file", f);
+      writeInputFilesCacheString(out, "key", e.key);
+      mfront::write(out, e.dependencies, "dependencies");
+      mfront::write(out, e.hashes, "hashes");
+      out << "targets : " << e.targets;
+      out << "};\n";
+    }
+  }  // end of write
+
+  InputFilesCache::~InputFilesCache() = default;
+
+}  // end of namespace mfront
@@ -38,6 +38,7 @@
 #include "TFEL/System/System.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/MFrontHeader.hxx"
 #include "MFront/MFrontLock.hxx"
 #include "MFront/DSLUtilities.hxx"
@@ -279,7 +280,7 @@ namespace mfront {
     const auto name =
         (!mpd.material.empty()) ? mpd.material + "_" + mpd.law : mpd.law;
     const auto srcFileName = "src/" + name + "-java.cxx";
-    std::ofstream srcFile{srcFileName};
+    GeneratedFileStream srcFile{srcFileName};
     throw_if(!srcFile,
              "unable to open '" + srcFileName + "' for writing output file.");
     srcFile.exceptions(std::ios::badbit | std::ios::failbit);
@@ -471,7 +472,7 @@ namespace mfront {
       f.close();
     }
     methods[mpd.law] = mpd.inputs.size();
-    std::ofstream mf{jcmlst};
+    GeneratedFileStream mf{jcmlst};
     throw_if(!mf, "unable to open '" + jcmlst + "'");
     mf.exceptions(std::ios::badbit | std::ios::failbit);
     mf << this->package << '\n';
@@ -479,8 +480,8 @@ namespace mfront {
       mf << m.first << " " << m.second << "\n";
     }
     mf.close();
-    std::ofstream jc{"java/" + getJavaClassFileName(mpd, this->package) +
-                     ".java"};
+    GeneratedFileStream jc{"java/" + getJavaClassFileName(mpd, this->package) +
+                           ".java"};
     throw_if(!jc, "unable to open '" + jcname + ".java'");
     jc.exceptions(std::ios::badbit | std::ios::failbit);
     if (!this->package.empty()) {
@@ -18,6 +18,7 @@
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/System/System.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontLock.hxx"
 #include "MFront/FileDescription.hxx"
@@ -28,7 +29,7 @@ namespace mfront {
 
   //! \brief copy lsdyna utility files locally
   static void copyLSDYNAFiles() {
-    std::ofstream out;
+    GeneratedFileStream out;
     MFrontLockGuard lock;
     for (const std::string f :
          {"CMakeLists.txt", "mfront-lsdyna.cxx", "test-lsdyna.cxx"}) {
@@ -23,6 +23,19 @@
 #include <cstring>
 #include <string>
 #include <memory>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <optional>
+#include <filesystem>
+
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+#include <process.h>
+#else
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
@@ -32,6 +45,7 @@
 #include "TFEL/System/ExternalLibraryManager.hxx"
 
 #include "MFront/MFrontHeader.hxx"
+#include "MFront/SearchPathsHandler.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MFront/TargetsDescription.hxx"
 #include "MFront/DSLFactory.hxx"
@@ -45,6 +59,8 @@
 #include "MFront/BehaviourBrick/KinematicHardeningRuleFactory.hxx"
 #include "MFront/ModelInterfaceFactory.hxx"
 #include "MFront/MFrontLock.hxx"
+#include "MFront/InputFilesCache.hxx"
+#include "MFront/DependenciesRecorder.hxx"
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/MFrontUtilities.hxx"
 #include "MFront/CMakeGenerator.hxx"
@@ -284,6 +300,37 @@ namespace mfront {
     }
   }  // end of MFront::treatSilentBuild
 
+  void MFront::treatJobs() {
+    const auto& o = this->currentArgument->getOption();
+    const auto n = [&o] {
+      try {
+        return std::stoi(o);
+      } catch (std::exception&) {
+        tfel::raise("MFront::treatJobs: invalid number of jobs '" + o + "'");
+      }
+    }();
+    tfel::raise_if(n <= 0,
+                   "MFront::treatJobs: invalid number of jobs '" + o + "'");
+    this->jobs = static_cast<unsigned int>(n);
+  }  // end of MFront::treatJobs
+
+  void MFront::treatIncremental() {
+    this->incremental = true;
+  }  // end of MFront::treatIncremental
+
+  void MFront::treatPGO() {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(),
+                   "MFront::treatPGO: no test specified "
+                   "for the '--pgo' option");
+    for (const auto& f : tfel::utilities::tokenize(o, ',')) {
+      tfel::raise_if(f.empty(), "MFront::treatPGO: empty test specified");
+      this->pgoTests.push_back(f);
+    }
+    this->genMake = true;
+    this->buildLibs = true;
+  }  // end of MFront::treatPGO
+
   void MFront::treatTarget() {
     using tfel::utilities::tokenize;
     const auto& t = tokenize(this->currentArgument->getOption(), ',');
@@ -462,6 +509,18 @@ namespace mfront {
                               "generate build file with optimized compilations "
                               "flags (see also --obuild)",
                               true);
+    this->registerNewCallBack(
+        "--jobs", "-j", &MFront::treatJobs,
+        "maximum number of input files analysed concurrently", true);
+    this->registerNewCallBack(
+        "--incremental", &MFront::treatIncremental,
+        "skip the input files which did not change since the last session");
+    this->registerNewCallBack(
+        "--pgo", &MFront::treatPGO,
+        "build the libraries using a profile guided optimisation. The "
+        "profiles are collected by running the given comma-separated list "
+        "of mtest or ptest files (implies --build)",
+        true);
     this->registerNewCallBack("--obuild", "-b", &MFront::treatOBuild,
                               "generate build file with optimized compilations "
                               "flags and build libraries",
@@ -636,6 +695,12 @@ namespace mfront {
 #endif /* __CYGWIN__ */
     this->registerNewCallBack("--nomelt", &MFront::treatNoMelt,
                               "don't melt librairies sources");
+    this->registerNewCallBack(
+        "--unity-build", &MFront::treatUnityBuild,
+        "gather the C++ sources of each library in a few translation units");
+    this->registerNewCallBack(
+        "--precompiled-headers", &MFront::treatPrecompiledHeaders,
+        "precompile the headers commonly used by the generated sources");
 #if !(defined _WIN32 || defined _WIN64 || defined __CYGWIN__)
     this->registerNewCallBack("--win32", &MFront::treatWin32,
                               "specify that the target system is win32");
@@ -752,6 +817,14 @@ namespace mfront {
     this->opts.melt = false;
   }  // end of MFront::treatNoMelt
 
+  void MFront::treatUnityBuild() {
+    this->opts.unityBuild = true;
+  }  // end of MFront::treatUnityBuild
+
+  void MFront::treatPrecompiledHeaders() {
+    this->opts.precompiledHeaders = true;
+  }  // end of MFront::treatPrecompiledHeaders
+
 #if (defined _WIN32 || defined _WIN64 || defined __CYGWIN__)
   void MFront::treatDefFile() {
     const auto& o = this->getCurrentCommandLineArgument().getOption();
@@ -768,10 +841,47 @@ namespace mfront {
   }  // end of void MFront::treatDefFile
 #endif /* (defined _WIN32 || defined _WIN64 ||defined __CYGWIN__) */
 
+  /*!
+   * \return a mutex associated with a file.
+   *
+   * This mutex prevents the same file from being treated concurrently,
+   * which may happen when the input files are treated in parallel and
+   * depend on a common file (for instance, a material property used by
+   * two behaviours).
+   *
+   * \param[in] f: file
+   */
+  static std::recursive_mutex& getFileTreatmentMutex(const std::string& f) {
+    static std::mutex m;
+    static std::map<std::string, std::unique_ptr<std::recursive_mutex>>
+        mutexes;
+    auto ec = std::error_code{};
+    const auto p = std::filesystem::weakly_canonical(f, ec);
+    const auto k = ec ? f : p.string();
+    std::lock_guard<std::mutex> lock(m);
+    auto& fm = mutexes[k];
+    if (fm == nullptr) {
+      fm = std::make_unique<std::recursive_mutex>();
+    }
+    return *fm;
+  }  // end of getFileTreatmentMutex
+
   TargetsDescription MFront::treatFile(const std::string& f) const {
+    std::lock_guard<std::recursive_mutex> lock(getFileTreatmentMutex(f));
+    if (this->cache != nullptr) {
+      auto otd = this->cache->get(f);
+      if (otd.has_value()) {
+        if (getVerboseMode() >= VERBOSE_LEVEL2) {
+          getLogStream() << "Skipping unchanged file: '" << f << "'"
+                         << std::endl;
+        }
+        return std::move(*otd);
+      }
+    }
     if (getVerboseMode() >= VERBOSE_LEVEL2) {
       getLogStream() << "Treating file: '" << f << "'" << std::endl;
     }
+    DependenciesRecorder dependencies;
     auto dsl = MFrontBase::getDSL(f);
     if (!this->interfaces.empty()) {
       dsl->setInterfaces(this->interfaces);
@@ -788,9 +898,28 @@ namespace mfront {
 #endif /* _MSC_VER */
       }
     }
+    if (this->cache != nullptr) {
+      this->cache->update(f, dependencies.getFiles(), td);
+    }
     return td;
   }  // end of MFront::treatFile()
 
+  std::string MFront::getInputFilesCacheKey() const {
+    auto k = MFrontHeader::getVersionNumber();
+    for (const auto& a : this->args) {
+      const auto& n = a.as_string();
+      if ((this->inputs.count(n) != 0) || (n == "--jobs") || (n == "-j") ||
+          (n == "--incremental") || (n == "--verbose")) {
+        continue;
+      }
+      k += '\n' + n + '=' + a.getOption();
+    }
+    for (const auto& p : SearchPathsHandler::getSearchPaths()) {
+      k += '\n' + p;
+    }
+    return InputFilesCache::hash(k);
+  }  // end of MFront::getInputFilesCacheKey
+
   void MFront::analyseTargetsFile() {
     using tfel::system::dirStringSeparator;
     MFrontLockGuard lock;
@@ -823,6 +952,131 @@ namespace mfront {
     }
   }  // end of MFront::buildLibraries
 
+  /*!
+   * \brief call an external program and wait for its completion
+   * \param[in] args: program and its arguments
+   */
+  static void callExternalProgram(const std::vector<std::string>& args) {
+    auto argv = std::vector<const char*>{};
+    for (const auto& a : args) {
+      argv.push_back(a.c_str());
+    }
+    argv.push_back(nullptr);
+    auto error = [&args](const std::string& e) {
+      auto msg = "callExternalProgram: " + e + "\nCommand was:";
+      for (const auto& a : args) {
+        msg += ' ' + a;
+      }
+      tfel::raise(msg);
+    };
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    if (_spawnvp(_P_WAIT, argv[0], argv.data()) != 0) {
+      error("command failed");
+    }
+#else
+    const auto child_pid = fork();
+    if (child_pid != 0) {
+      int status;
+      if (waitpid(child_pid, &status, 0) == -1) {
+        error("something went wrong while waiting end of process");
+      }
+      if (status != 0) {
+        error("command failed");
+      }
+    } else {
+      execvp(argv[0], const_cast<char* const*>(argv.data()));
+      ::exit(EXIT_FAILURE);
+    }
+#endif
+  }  // end of callExternalProgram
+
+  /*!
+   * \return the raw profiles generated by libraries compiled with `clang`
+   * in the current directory. Those profiles must be merged using the
+   * `llvm-profdata` utility before being used.
+   */
+  static std::vector<std::string> getRawProfiles() {
+    namespace fs = std::filesystem;
+    auto r = std::vector<std::string>{};
+    for (const auto& e : fs::directory_iterator(".")) {
+      const auto n = e.path().filename().string();
+      if ((e.is_regular_file()) && (e.path().extension() == ".profraw") &&
+          (tfel::utilities::starts_with(n, "default"))) {
+        r.push_back(n);
+      }
+    }
+    return r;
+  }  // end of getRawProfiles
+
+  /*!
+   * \brief remove the profiles generated by previous sessions.
+   *
+   * `gcc` stores the profiles next to the object files, i.e. in the `src`
+   * directory. `clang` stores the raw profiles in the current directory
+   * and the merged profiles are stored in the `src` directory.
+   */
+  static void removeProfiles() {
+    namespace fs = std::filesystem;
+    for (const auto& f : getRawProfiles()) {
+      fs::remove(f);
+    }
+    for (const auto& e : fs::directory_iterator("src")) {
+      if ((e.is_regular_file()) &&
+          ((e.path().extension() == ".gcda") ||
+           (e.path().filename() == "default.profdata"))) {
+        fs::remove(e.path());
+      }
+    }
+  }  // end of removeProfiles
+
+  void MFront::buildLibrariesUsingProfileGuidedOptimisation() {
+    tfel::raise_if(this->generator == CMAKE,
+                   "MFront::buildLibrariesUsingProfileGuidedOptimisation: "
+                   "profile guided optimisation is only supported by "
+                   "the Makefile generator");
+    auto& log = getLogStream();
+    auto build = [this, &log](
+                     const GeneratorOptions::ProfileGuidedOptimisationStage s) {
+      auto o = this->opts;
+      o.pgo = s;
+      generateMakeFile(this->targets, o);
+      // object files shall be rebuilt with the new flags
+      callMake("clean");
+      for (const auto& t : this->specifiedTargets) {
+        if (getVerboseMode() >= VERBOSE_LEVEL0) {
+          log << "Treating target : " << t << std::endl;
+        }
+        callMake(t);
+      }
+    };
+    removeProfiles();
+    if (getVerboseMode() >= VERBOSE_LEVEL1) {
+      log << "Building instrumented libraries" << std::endl;
+    }
+    build(GeneratorOptions::PGO_INSTRUMENTATION);
+    const auto mtest = tfel::getTFELExecutableName("mtest");
+    for (const auto& f : this->pgoTests) {
+      if (getVerboseMode() >= VERBOSE_LEVEL1) {
+        log << "Collecting profiles using test '" << f << "'" << std::endl;
+      }
+      callExternalProgram({mtest, f});
+    }
+    const auto raw_profiles = getRawProfiles();
+    if (!raw_profiles.empty()) {
+      const auto* const e = ::getenv("LLVM_PROFDATA");
+      auto args = std::vector<std::string>{
+          e != nullptr ? e : "llvm-profdata", "merge",
+          "-output=src" + tfel::system::dirStringSeparator() +
+              "default.profdata"};
+      args.insert(args.end(), raw_profiles.begin(), raw_profiles.end());
+      callExternalProgram(args);
+    }
+    if (getVerboseMode() >= VERBOSE_LEVEL1) {
+      log << "Building optimised libraries" << std::endl;
+    }
+    build(GeneratorOptions::PGO_OPTIMISATION);
+  }  // end of MFront::buildLibrariesUsingProfileGuidedOptimisation
+
   void MFront::cleanLibraries() {
     if (this->generator == CMAKE) {
       //      callCMake("clean");
@@ -868,6 +1122,64 @@ namespace mfront {
     file << this->targets;
   }  // end of MFront::writeTargetDescription
 
+  void MFront::treatFilesConcurrently(
+      std::vector<std::pair<std::string, std::string>>& errors) {
+    //! \brief result of the treatment of an input file
+    struct Result {
+      //! \brief description of the generated targets, if succeeded
+      std::optional<TargetsDescription> td;
+      //! \brief outputs written in the logging stream
+      std::string log;
+      //! \brief error message, if any
+      std::string error;
+    };
+    const auto files =
+        std::vector<std::string>(this->inputs.begin(), this->inputs.end());
+    auto results = std::vector<Result>(files.size());
+    auto next = std::atomic<std::size_t>{0};
+    auto treat = [this, &files, &results, &next] {
+      for (auto i = next++; i < files.size(); i = next++) {
+        auto& r = results[i];
+        // the outputs are buffered and written once all the files have
+        // been treated, in the order of the input files
+        std::ostringstream log;
+        setThreadLogStream(log);
+        try {
+          r.td.emplace(this->treatFile(files[i]));
+        } catch (std::exception& e) {
+          r.error = e.what();
+        } catch (...) {
+          r.error = "unknown exception";
+        }
+        resetThreadLogStream();
+        r.log = log.str();
+      }
+    };
+    const auto n =
+        std::min(static_cast<std::size_t>(this->jobs), files.size());
+    auto threads = std::vector<std::thread>{};
+    for (std::size_t i = 1; i < n; ++i) {
+      threads.emplace_back(treat);
+    }
+    treat();
+    for (auto& t : threads) {
+      t.join();
+    }
+    // merging the results in the order of the input files so that the
+    // outputs do not depend on the number of jobs
+    auto& log = getLogStream();
+    for (std::size_t i = 0; i != files.size(); ++i) {
+      const auto& r = results[i];
+      log << r.log;
+      if (r.td.has_value()) {
+        mergeTargetsDescription(this->targets, *(r.td), true);
+      } else {
+        errors.push_back({files[i], r.error});
+      }
+    }
+    log.flush();
+  }  // end of MFront::treatFilesConcurrently
+
   void MFront::exe() {
     tfel::system::systemCall::mkdir("src");
     tfel::system::systemCall::mkdir("include");
@@ -886,13 +1198,22 @@ namespace mfront {
     // get file generated by previous sessions
     this->analyseTargetsFile();
     auto errors = std::vector<std::pair<std::string, std::string>>{};
+    if ((this->incremental) && (!this->inputs.empty())) {
+      this->cache = std::make_unique<InputFilesCache>(
+          "src" + tfel::system::dirStringSeparator() + "mfront-cache.lst",
+          this->getInputFilesCacheKey());
+    }
     if (!this->inputs.empty()) {
-      for (const auto& i : this->inputs) {
-        try {
-          const auto td = this->treatFile(i);
-          mergeTargetsDescription(this->targets, td, true);
-        } catch (std::exception& e) {
-          errors.push_back({i, e.what()});
+      if ((this->jobs > 1) && (this->inputs.size() > 1)) {
+        this->treatFilesConcurrently(errors);
+      } else {
+        for (const auto& i : this->inputs) {
+          try {
+            const auto td = this->treatFile(i);
+            mergeTargetsDescription(this->targets, td, true);
+          } catch (std::exception& e) {
+            errors.push_back({i, e.what()});
+          }
         }
       }
       for (auto& t : this->targets.specific_targets) {
@@ -917,6 +1238,9 @@ namespace mfront {
       }
       // save all
       this->writeTargetsDescription();
+      if (this->cache != nullptr) {
+        this->cache->write();
+      }
     }
     if (!errors.empty()) {
       auto msg = std::string{};
@@ -949,11 +1273,15 @@ namespace mfront {
     if ((this->buildLibs) &&
         ((has_libs) || (!this->targets.specific_targets.empty()))) {
       auto& log = getLogStream();
-      for (const auto& t : this->specifiedTargets) {
-        if (getVerboseMode() >= VERBOSE_LEVEL0) {
-          log << "Treating target : " << t << std::endl;
+      if (!this->pgoTests.empty()) {
+        this->buildLibrariesUsingProfileGuidedOptimisation();
+      } else {
+        for (const auto& t : this->specifiedTargets) {
+          if (getVerboseMode() >= VERBOSE_LEVEL0) {
+            log << "Treating target : " << t << std::endl;
+          }
+          this->buildLibraries(t);
         }
-        this->buildLibraries(t);
       }
       if (getVerboseMode() >= VERBOSE_LEVEL0) {
         if (has_libs) {
@@ -97,7 +97,13 @@ namespace mfront {
     }
   }  // end of setVerboseMode
 
+  //! \brief logging stream specific to the current thread, if any
+  static thread_local std::ostream* thread_log_stream = nullptr;
+
   std::ostream& getLogStream() {
+    if (thread_log_stream != nullptr) {
+      return *thread_log_stream;
+    }
     auto& log = LogStream::getLogStream();
     return log.getStream();
   }  // end of function getLogStream
@@ -112,6 +118,14 @@ namespace mfront {
     log.setLogStream(os);
   }  // end of function setLogStream
 
+  void setThreadLogStream(std::ostream& os) {
+    thread_log_stream = &os;
+  }  // end of function setThreadLogStream
+
+  void resetThreadLogStream() {
+    thread_log_stream = nullptr;
+  }  // end of function resetThreadLogStream
+
   namespace internals {
 
     static bool& getUnicodeOutputOption() {
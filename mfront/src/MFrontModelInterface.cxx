@@ -11,11 +11,11 @@
  * project under specific licensing conditions.
  */
 
-#include <fstream>
 #include <iterator>
 #include <algorithm>
 #include "TFEL/Raise.hxx"
 #include "TFEL/System/System.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MFront/FileDescription.hxx"
@@ -137,7 +137,7 @@ namespace mfront {
     };
     tfel::system::systemCall::mkdir("include/MFront");
     const auto hname = getHeaderFileName(md) + ".hxx";
-    std::ofstream header("include/" + hname);
+    GeneratedFileStream header("include/" + hname);
     throw_if(!header, "can't open file 'include/" + hname + "'");
     header.exceptions(std::ios::badbit | std::ios::failbit);
     header << "/*!\n"
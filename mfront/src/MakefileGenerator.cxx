@@ -12,10 +12,10 @@
  */
 
 #include <set>
+#include <vector>
 #include <cstring>
 #include <ostream>
 #include <sstream>
-#include <fstream>
 #include <iterator>
 #include <algorithm>
 
@@ -43,6 +43,7 @@
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/MFrontHeader.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MFront/InstallPath.hxx"
@@ -51,6 +52,7 @@
 #include "MFront/MFrontDebugMode.hxx"
 #include "MFront/TargetsDescription.hxx"
 #include "MFront/GeneratorOptions.hxx"
+#include "MFront/GeneratorUtilities.hxx"
 #include "MFront/MakefileGenerator.hxx"
 
 namespace mfront {
@@ -173,14 +175,27 @@ namespace mfront {
     tfel::raise("getTargetName: no target associated with '" + n + "'");
   }  // end of getTargetName
 
-  void generateMakeFile(const TargetsDescription& t,
-                        const GeneratorOptions& o,
-                        const std::string& d,
-                        const std::string& f) {
-    if (getVerboseMode() >= VERBOSE_LEVEL2) {
-      getLogStream() << "generating Makefile\n";
-    }
-    MFrontLockGuard lock;
+  /*!
+   * \return the option passed to `make` to build the targets in parallel,
+   * or an empty string if the number of jobs is already specified by the
+   * `MAKEFLAGS` environment variable.
+   */
+  static std::string getMakeJobsOption() {
+    const auto* const mflags = ::getenv("MAKEFLAGS");
+    if (mflags != nullptr) {
+      const auto flags = std::string{mflags};
+      if ((flags.find("-j") != std::string::npos) ||
+          (flags.find("--jobserver") != std::string::npos)) {
+        return "";
+      }
+    }
+    return "-j" + std::to_string(getDefaultNumberOfBuildJobs());
+  }  // end of getMakeJobsOption
+
+  static void writeMakeFile(const TargetsDescription& t,
+                            const GeneratorOptions& o,
+                            const std::string& d,
+                            const std::string& f) {
     const auto env_cc = ::getenv("CC");
     const auto env_cxx = ::getenv("CXX");
     const auto inc = ::getenv("INCLUDES");
@@ -191,8 +206,11 @@ namespace mfront {
     const auto cxx = (env_cxx == nullptr) ? "$(CXX)" : env_cxx;
     const auto cc = (env_cc == nullptr) ? "$(CC)" : env_cc;
     const auto tfel_config = tfel::getTFELConfigExecutableName();
+    const auto pch = o.precompiledHeaders
+                         ? std::string{getPrecompiledHeaderFileName()}
+                         : std::string{};
     auto mfile = d + tfel::system::dirStringSeparator() + f;
-    std::ofstream m(mfile);
+    GeneratedFileStream m(mfile);
     m.exceptions(std::ios::badbit | std::ios::failbit);
     tfel::raise_if(!m, "generateMakeFile : can't open file '" + mfile + "'");
     auto cppSources = std::set<std::string>{};
@@ -275,6 +293,15 @@ namespace mfront {
     if (ldflags != nullptr) {
       m << "LDFLAGS := " << ldflags << '\n';
     }
+    // profile guided optimisation
+    if (o.pgo == GeneratorOptions::PGO_INSTRUMENTATION) {
+      m << "PGOFLAGS := $(shell " << tfel_config
+        << " --pgo-instrumentation-flags)\n\n";
+    } else if (o.pgo == GeneratorOptions::PGO_OPTIMISATION) {
+      m << "PGOFLAGS := $(shell " << tfel_config
+        << " --pgo-optimisation-flags)\n\n";
+    }
+    const auto pgo = (o.pgo != GeneratorOptions::NOPGO) ? "$(PGOFLAGS) " : "";
     // CXXFLAGS
     if (!cppSources.empty()) {
       m << "CXXFLAGS := -Wall -Wfatal-errors ";
@@ -299,11 +326,16 @@ namespace mfront {
           m << "$(shell " << tfel_config << " --debug-flags) ";
         }
       }
+      m << pgo;
       if ((o.sys == "win32") || (o.sys == "cygwin")) {
         m << "-DWIN32 -DMFRONT_COMPILING $(INCLUDES) \n\n";
       } else {
         m << "-fPIC $(INCLUDES) \n\n";
       }
+      if (!pch.empty()) {
+        writePrecompiledHeader(d);
+        m << "PCHFLAGS := -include " << pch << "\n\n";
+      }
     }
     // CFLAGS
     if (!cSources.empty()) {
@@ -326,6 +358,7 @@ namespace mfront {
             break;
         }
       }
+      m << pgo;
       if ((o.sys == "win32") || (o.sys == "cygwin")) {
         m << "-DWIN32 -DMFRONT_COMPILING $(INCLUDES)\n\n";
       } else {
@@ -448,7 +481,7 @@ namespace mfront {
       } else {
         m << "-shared ";
       }
-      m << "$^  -o $@ ";
+      m << pgo << "$^  -o $@ ";
       m << getLibraryLinkFlags(t, o, l.name);
       m << "\n";
       if (o.sys == "apple") {
@@ -499,12 +532,13 @@ namespace mfront {
                 std::ostream_iterator<std::string>(m, " "));
     }
     m << "\n";
+    const auto gch = pch.empty() ? "" : " *.gch";
     if ((o.sys == "win32") || (o.sys == "cygwin")) {
-      m << "\t" << sb << "rm -f *.o *.dll *.d *.d.*\n";
+      m << "\t" << sb << "rm -f *.o *.dll *.d *.d.*" << gch << "\n";
     } else if (o.sys == "apple") {
-      m << "\t" << sb << "rm -f *.o *.bundle *.d *.d*\n";
+      m << "\t" << sb << "rm -f *.o *.bundle *.d *.d*" << gch << "\n";
     } else {
-      m << "\t" << sb << "rm -f *.o *.so *.d *.d.*\n";
+      m << "\t" << sb << "rm -f *.o *.so *.d *.d.*" << gch << "\n";
     }
     if (p5 != t.specific_targets.end()) {
       for (const auto& cmd : p5->second.cmds) {
@@ -516,7 +550,14 @@ namespace mfront {
       m << "-include $(makefiles)\n\n";
     }
     // generic rules for objects file generation
-    if (!cppSources.empty()) {
+    if ((!cppSources.empty()) && (!pch.empty())) {
+      m << pch << ".gch:" << pch << "\n";
+      m << "\t" << sb << cxx << " $(CXXFLAGS) -x c++-header $< -o $@\n\n";
+      m << "%.o:%.cxx " << pch << ".gch\n";
+      m << "\t" << sb << cxx << " $(CXXFLAGS) $(PCHFLAGS) $< -o $@ -c\n\n";
+      m << "%.o:%.cpp " << pch << ".gch\n";
+      m << "\t" << sb << cxx << " $(CXXFLAGS) $(PCHFLAGS) $< -o $@ -c\n\n";
+    } else if (!cppSources.empty()) {
       m << "%.o:%.cxx\n";
       m << "\t" << sb << cxx << " $(CXXFLAGS) $< -o $@ -c\n\n";
       m << "%.o:%.cpp\n";
@@ -551,15 +592,38 @@ namespace mfront {
       }
     }
     m.close();
-  }
+  }  // end of writeMakeFile
+
+  void generateMakeFile(const TargetsDescription& t,
+                        const GeneratorOptions& o,
+                        const std::string& d,
+                        const std::string& f) {
+    if (getVerboseMode() >= VERBOSE_LEVEL2) {
+      getLogStream() << "generating Makefile\n";
+    }
+    MFrontLockGuard lock;
+    if (o.unityBuild) {
+      writeMakeFile(generateUnityBuildSources(t, d), o, d, f);
+    } else {
+      writeMakeFile(t, o, d, f);
+    }
+  }  // end of generateMakeFile
 
   void callMake(const std::string& t,
                 const std::string& d,
                 const std::string& f) {
     const char* make = getMakeCommand();
-    const char* silent = getDebugMode() ? nullptr : "-s";
-    const char* const argv[] = {make,      "-C",      d.c_str(), "-f",
-                                f.c_str(), t.c_str(), silent,    nullptr};
+    const auto jobs = getMakeJobsOption();
+    auto args = std::vector<const char*>{make, "-C", d.c_str(), "-f",
+                                         f.c_str(), t.c_str()};
+    if (!jobs.empty()) {
+      args.push_back(jobs.c_str());
+    }
+    if (!getDebugMode()) {
+      args.push_back("-s");
+    }
+    args.push_back(nullptr);
+    const char* const* const argv = args.data();
     auto error = [&argv, &t](const std::string& e) {
       auto msg = "callMake: can't build target '" + t + "'\n";
       if (!e.empty()) {
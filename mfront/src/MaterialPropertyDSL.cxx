@@ -104,6 +104,8 @@ namespace mfront {
     this->registerNewCallBack("@Output", &MaterialPropertyDSL::treatOutput);
     this->registerNewCallBack("@Function", &MaterialPropertyDSL::treatFunction);
     this->registerNewCallBack("@Data", &MaterialPropertyDSL::treatData);
+    this->registerNewCallBack("@Tabulation",
+                              &MaterialPropertyDSL::treatTabulation);
     this->registerNewCallBack("@Import", &MaterialPropertyDSL::treatImport);
     this->registerNewCallBack("@Interface",
                               &MaterialPropertyDSL::treatInterface);
@@ -243,6 +245,9 @@ namespace mfront {
   }  // end of doPedanticChecks
 
   void MaterialPropertyDSL::endsInputFileProcessing() {
+    if (this->tabulation.has_value()) {
+      this->tabulateFunction();
+    }
     if (getPedanticMode()) {
       this->doPedanticChecks();
     }
@@ -641,6 +646,131 @@ namespace mfront {
     this->md.f.modified = true;
   }
 
+  void MaterialPropertyDSL::treatTabulation() {
+    using namespace tfel::utilities;
+    if (this->tabulation.has_value()) {
+      this->throwRuntimeError("MaterialPropertyDSL::treatTabulation",
+                              "tabulation already defined");
+    }
+    const auto opts =
+        Data::read(this->current, this->tokens.end()).get<DataMap>();
+    try {
+      DataMapValidator{}
+          .addDataTypeValidator<std::string>("interpolation")
+          .addDataTypeValidator<double>("accuracy")
+          .addDataTypeValidator<int>("maximum_number_of_intervals")
+          .validate(opts);
+    } catch (std::exception& e) {
+      this->throwRuntimeError("MaterialPropertyDSL::treatTabulation",
+                              e.what());
+    }
+    const auto i = get_if<std::string>(opts, "interpolation", "cubic");
+    if ((i != "linear") && (i != "cubic")) {
+      this->throwRuntimeError("MaterialPropertyDSL::treatTabulation",
+                              "invalid interpolation '" + i +
+                                  "'. Valid interpolations are 'linear' "
+                                  "and 'cubic'");
+    }
+    if (!(get_if<double>(opts, "accuracy", 1e-8) > 0)) {
+      this->throwRuntimeError("MaterialPropertyDSL::treatTabulation",
+                              "invalid accuracy");
+    }
+    if (get_if<int>(opts, "maximum_number_of_intervals", 65536) < 2) {
+      this->throwRuntimeError("MaterialPropertyDSL::treatTabulation",
+                              "invalid maximum number of intervals");
+    }
+    this->readSpecifiedToken("MaterialPropertyDSL::treatTabulation", ";");
+    this->tabulation = opts;
+  }  // end of treatTabulation
+
+  void MaterialPropertyDSL::tabulateFunction() {
+    using namespace tfel::utilities;
+    auto throw_if = [](const bool b, const std::string& m) {
+      tfel::raise_if(b, "MaterialPropertyDSL::tabulateFunction: " + m);
+    };
+    const auto& opts = *(this->tabulation);
+    throw_if(this->md.f.body.empty(), "no function defined");
+    throw_if(this->md.inputs.size() != 1,
+             "only material properties with exactly one input "
+             "can be tabulated");
+    throw_if((!this->md.f.used_parameters.empty()) &&
+                 (!areParametersTreatedAsStaticVariables(this->md)),
+             "the parameters used by the function must be treated as static "
+             "variables (see the `parameters_as_static_variables` option)");
+    const auto interpolation =
+        get_if<std::string>(opts, "interpolation", "cubic");
+    const auto eps = get_if<double>(opts, "accuracy", 1e-8);
+    const auto nmax = get_if<int>(opts, "maximum_number_of_intervals", 65536);
+    // tabulation range
+    const auto& v = this->md.inputs[0];
+    auto lower = std::optional<long double>{};
+    auto upper = std::optional<long double>{};
+    if (v.hasBounds()) {
+      const auto& b = v.getBounds();
+      if (b.hasLowerBound()) {
+        lower = b.lowerBound;
+      }
+      if (b.hasUpperBound()) {
+        upper = b.upperBound;
+      }
+    }
+    if (v.hasPhysicalBounds()) {
+      const auto& b = v.getPhysicalBounds();
+      if ((!lower.has_value()) && (b.hasLowerBound())) {
+        lower = b.lowerBound;
+      }
+      if ((!upper.has_value()) && (b.hasUpperBound())) {
+        upper = b.upperBound;
+      }
+    }
+    throw_if((!lower.has_value()) || (!upper.has_value()),
+             "the lower and upper bounds of the input '" + v.name +
+                 "' must be given to define the tabulation range");
+    auto number = [](const long double x) {
+      std::ostringstream os;
+      os.precision(14);
+      os << x;
+      return os.str();
+    };
+    const auto& o = this->md.output;
+    const auto itype = interpolation == "linear" ? "LINEAR_INTERPOLATION"
+                                                 : "CUBIC_INTERPOLATION";
+    auto body = std::string{};
+    body += "const auto mfront_exact_function = ";
+    body += "[&](const numeric_type mfront_x) -> numeric_type {\n";
+    body += "const auto " + v.name + " = " + v.type + "{mfront_x};\n";
+    body += "auto " + o.name + " = " + o.type + "{};\n";
+    body += this->md.f.body + "\n";
+    body += "return tfel::math::base_type_cast(" + o.name + ");\n";
+    body += "};\n";
+    body += "using mfront_tabulation_type = ";
+    body += "tfel::math::UniformGridTabulation<numeric_type>;\n";
+    body += "static const auto mfront_tabulation = mfront_tabulation_type(";
+    body += "mfront_exact_function, ";
+    body += "numeric_type(" + number(*lower) + "), ";
+    body += "numeric_type(" + number(*upper) + "), ";
+    body += "numeric_type(" + number(eps) + "), ";
+    body += "mfront_tabulation_type::" + std::string{itype} + ", ";
+    body += std::to_string(nmax) + ");\n";
+    body += "const auto mfront_x = tfel::math::base_type_cast(" + v.name +
+            ");\n";
+    body += "if (mfront_tabulation.contains(mfront_x)) {\n";
+    body += o.name + " = " + o.type + "{mfront_tabulation(mfront_x)};\n";
+    body += "#ifndef NDEBUG\n";
+    body += "tfel::raise_if(!mfront_tabulation.check(mfront_x, ";
+    body += "mfront_exact_function(mfront_x)), ";
+    body += "\"" + this->md.className + ": inaccurate tabulation\");\n";
+    body += "#endif /* NDEBUG */\n";
+    body += "} else {\n";
+    body += o.name + " = " + o.type + "{mfront_exact_function(mfront_x)};\n";
+    body += "}\n";
+    this->md.f.body = body;
+    this->md.appendToIncludes(
+        "#include \"TFEL/Math/General/MathObjectTraits.hxx\"");
+    this->md.appendToIncludes(
+        "#include \"TFEL/Math/UniformGridTabulation.hxx\"");
+  }  // end of tabulateFunction
+
   void MaterialPropertyDSL::treatFunction() {
     auto throw_if = [this](const bool b, const std::string& m) {
       if (b) {
@@ -22,6 +22,7 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/System/System.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/MFrontHeader.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/FileDescription.hxx"
@@ -213,7 +214,7 @@ namespace mfront {
                           ? mpd.className
                           : mpd.material + "_" + mpd.className;
     const auto fn = "octave/" + name + ".cpp";
-    std::ofstream out{fn};
+    GeneratedFileStream out{fn};
     tfel::raise_if(!out,
                    "OctaveMaterialPropertyInterface::writeOutputFiles: "
                    "unable to open file '" +
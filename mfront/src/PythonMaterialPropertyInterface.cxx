@@ -37,6 +37,7 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/System/System.hxx"
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/MFrontUtilities.hxx"
 #include "MFront/MFrontHeader.hxx"
@@ -264,12 +265,12 @@ namespace mfront {
       tfel::raise_if(b,
                      "PythonMaterialPropertyInterface::writeOutputFiles: " + m);
     };
-    std::ofstream out;
+    GeneratedFileStream out;
     out.open(outName);
     throw_if(!out, "unable to open '" + outName + "' for writing output file.");
     out.exceptions(std::ios::badbit | std::ios::failbit);
     const auto srcFileName = "src/" + name + "-python.cxx";
-    std::ofstream srcFile;
+    GeneratedFileStream srcFile;
     srcFile.open(srcFileName);
     throw_if(!srcFile,
              "unable to open '" + srcFileName + "' for writing output file.");
@@ -525,7 +526,7 @@ namespace mfront {
       }
       return "src/" + library + "wrapper.cxx";
     }();
-    std::ofstream wrapper(wn);
+    GeneratedFileStream wrapper(wn);
     wrapper.exceptions(std::ios::badbit | std::ios::failbit);
     throw_if(!wrapper, "unable to open file '" + wn + "'");
     wrapper << "/*!\n";
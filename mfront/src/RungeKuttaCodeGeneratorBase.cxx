@@ -329,6 +329,10 @@ namespace mfront {
        << "return true;\n"
        << "} // end of " << this->bd.getClassName()
        << "::computeDerivative\n\n";
+    os << "//! \\brief number of accepted sub-steps\n"
+       << "unsigned int rk_number_of_substeps = 0;\n"
+       << "//! \\brief number of sub-steps tried\n"
+       << "unsigned int rk_number_of_trials = 0;\n\n";
   }  // end of writeBehaviourParserSpecificMembers
 
   void RungeKuttaCodeGeneratorBase::writeBehaviourUpdateStateVariables(
@@ -545,7 +549,8 @@ namespace mfront {
       os << "cout << endl << \"" << this->bd.getClassName()
          << "::integrate() : beginning of resolution\" << endl;\n";
     }
-    os << "while(!converged){\n";
+    os << "while(!converged){\n"
+       << "++(this->rk_number_of_trials);\n";
     if (getDebugMode()) {
       os << "cout << \"" << this->bd.getClassName()
          << "::integrate() : from \" << t <<  \" to \" << t+dt_ << \" with "
@@ -997,7 +1002,8 @@ namespace mfront {
     if (d.hasCode(BehaviourData::UpdateAuxiliaryStateVariables)) {
       os << "this->updateAuxiliaryStateVariables(dt_);\n";
     }
-    os << "t += dt_;\n"
+    os << "++(this->rk_number_of_substeps);\n"
+       << "t += dt_;\n"
        << "if(tfel::math::abs(this->dt-t)<dtprec){\n"
        << "converged=true;\n"
        << "}\n"
@@ -1301,6 +1307,7 @@ namespace mfront {
          << "::integrate() : beginning of resolution\" << endl;\n";
     }
     os << "while(!converged){\n"
+       << "++(this->rk_number_of_trials);\n"
        << "if(dt_< dtprec){\n"
        << "cout<<\" dt \"<<this->dt<<\" t \"<<t<<\" dt_ \"<<dt_<<endl;\n"
        << "string msg(\"" << this->bd.getClassName() << "\");\n"
@@ -1606,7 +1613,8 @@ namespace mfront {
     if (this->bd.hasCode(h, BehaviourData::UpdateAuxiliaryStateVariables)) {
       os << "this->updateAuxiliaryStateVariables(dt_);\n";
     }
-    os << "t += dt_;\n"
+    os << "++(this->rk_number_of_substeps);\n"
+       << "t += dt_;\n"
        << "if(tfel::math::abs(this->dt-t)<dtprec){\n"
        << "converged=true;\n"
        << "}\n"
@@ -1686,7 +1694,8 @@ namespace mfront {
       os << "cout << endl << \"" << this->bd.getClassName()
          << "::integrate() : beginning of resolution\" << endl;\n";
     }
-    os << "while(!converged){\n";
+    os << "while(!converged){\n"
+       << "++(this->rk_number_of_trials);\n";
     if (getDebugMode()) {
       os << "cout << \"" << this->bd.getClassName()
          << "::integrate() : from \" << t <<  \" to \" << t+dt_ << \" with "
@@ -2014,7 +2023,8 @@ namespace mfront {
     if (this->bd.hasCode(h, BehaviourData::UpdateAuxiliaryStateVariables)) {
       os << "this->updateAuxiliaryStateVariables(dt_);\n";
     }
-    os << "t += dt_;\n"
+    os << "++(this->rk_number_of_substeps);\n"
+       << "t += dt_;\n"
        << "if(tfel::math::abs(this->dt-t) < dtprec){\n"
        << "converged=true;\n"
        << "}\n"
@@ -2227,6 +2237,14 @@ namespace mfront {
       writeStandardPerformanceProfilingBegin(os, this->bd.getClassName(),
                                              BehaviourData::Integrator);
     }
+    if ((algorithm == "Euler") || (algorithm == "RungeKutta2") ||
+        (algorithm == "RungeKutta4")) {
+      os << "this->rk_number_of_substeps = 1;\n"
+         << "this->rk_number_of_trials = 1;\n";
+    } else {
+      os << "this->rk_number_of_substeps = 0;\n"
+         << "this->rk_number_of_trials = 0;\n";
+    }
     if (algorithm == "Euler") {
       this->writeBehaviourEulerIntegrator(os, h);
     } else if (algorithm == "RungeKutta2") {
@@ -2276,6 +2294,14 @@ namespace mfront {
     os << "}\n";
     writeReturnSuccess(os, this->bd);
     os << "} // end of " << this->bd.getClassName() << "::integrate\n\n";
+    os << "//! \\return the number of accepted sub-steps\n"
+       << "unsigned int getNumberOfSubSteps() const noexcept {\n"
+       << "return this->rk_number_of_substeps;\n"
+       << "}\n\n"
+       << "//! \\return the number of rejected sub-steps\n"
+       << "unsigned int getNumberOfRejectedSubSteps() const noexcept {\n"
+       << "return this->rk_number_of_trials - this->rk_number_of_substeps;\n"
+       << "}\n\n";
   }  // end of writeBehaviourIntegrator
 
   RungeKuttaCodeGeneratorBase::~RungeKuttaCodeGeneratorBase() = default;
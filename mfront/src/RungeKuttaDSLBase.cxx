@@ -80,6 +80,8 @@ namespace mfront {
     this->reserveName("cste1_50");
     this->reserveName("rk_update_error");
     this->reserveName("rk_error");
+    this->reserveName("rk_number_of_substeps");
+    this->reserveName("rk_number_of_trials");
     // CallBacks
     this->registerNewCallBack(
         "@UsableInPurelyImplicitResolution",
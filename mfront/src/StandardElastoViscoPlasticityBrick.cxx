@@ -11,6 +11,7 @@
  * project under specific licensing conditions.
  */
 
+#include <algorithm>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Glossary/Glossary.hxx"
 #include "TFEL/Glossary/GlossaryEntry.hxx"
@@ -1018,6 +1019,37 @@ namespace mfront {
       bd.setCode(uh, BehaviourData::UpdateAuxiliaryStateVariables, uasv,
                  BehaviourData::CREATEORAPPEND, BehaviourData::AT_BEGINNING);
     }
+    // If the Hooke stress potential is used and if all inelastic flows are
+    // plastic, the time step is elastic if no flow is activated by the
+    // elastic prediction. This criterion allows the implicit scheme to
+    // skip the resolution of the implicit system for elastic steps. The
+    // plane stress hypotheses are excluded since the axial strain is an
+    // additional integration variable in this case.
+    const auto allows_elastic_step =
+        (this->stress_potential->getName() == "Hooke") &&
+        (!this->isCoupledWithPorosityEvolution()) && (!this->flows.empty()) &&
+        (std::all_of(this->flows.begin(), this->flows.end(),
+                     [](const std::shared_ptr<bbrick::InelasticFlow>& pf) {
+                       return pf->requiresActivationState();
+                     }));
+    if (allows_elastic_step) {
+      auto c = std::string{};
+      for (size_t idx = 0; idx != this->flows.size(); ++idx) {
+        if (!c.empty()) {
+          c += ")||(";
+        }
+        c += "this->bpl" + getId(idx, this->flows.size());
+      }
+      c = "!((" + c + "))";
+      bd.setAttribute(uh, BehaviourData::elasticStepCriterion, c, false);
+      for (const auto h : bd.getDistinctModellingHypotheses()) {
+        if ((h == ModellingHypothesis::PLANESTRESS) ||
+            (h == ModellingHypothesis::AXISYMMETRICALGENERALISEDPLANESTRESS)) {
+          bd.updateAttribute(h, BehaviourData::elasticStepCriterion,
+                             std::string{});
+        }
+      }
+    }
   }  // end of StandardElastoViscoPlasticityBrick::endTreatment
 
   void StandardElastoViscoPlasticityBrick::
@@ -329,6 +329,7 @@ namespace mfront {
     this->writeAdditionalSymbols(out, i, bd, fd, name, h);
     this->writeComputesInternalEnergySymbol(out, i, bd, name, h);
     this->writeComputesDissipatedEnergySymbol(out, i, bd, name, h);
+    this->writeMetadataSymbol(out, i, bd, name, h);
   }
 
   void SymbolsGenerator::writeComputesInternalEnergySymbol(
@@ -353,6 +354,66 @@ namespace mfront {
         bd.hasCode(h, BehaviourData::ComputeDissipatedEnergy) ? 1u : 0u);
   }  // end of writeComputesDissipatedEnergySymbol
 
+  void SymbolsGenerator::writeMetadataSymbol(std::ostream& out,
+                                             const BehaviourInterfaceBase& i,
+                                             const BehaviourDescription& mb,
+                                             const std::string& name,
+                                             const Hypothesis h) const {
+    const auto& d = mb.getBehaviourData(h);
+    auto metadata = std::string{"mfront-metadata 1\\n"};
+    auto add_names = [&metadata](const std::string& n,
+                                 const std::vector<std::string>& names) {
+      metadata += "n " + n + " " + std::to_string(names.size());
+      for (const auto& v : names) {
+        metadata += " " + v;
+      }
+      metadata += "\\n";
+    };
+    auto add_types = [&metadata](const std::string& n,
+                                 const VariableDescriptionContainer& c,
+                                 const auto& get_type) {
+      metadata += "t " + n + " " + std::to_string(c.getNumberOfVariables());
+      for (const auto& v : c) {
+        const auto t = " " + std::to_string(get_type(v));
+        for (unsigned short idx = 0; idx != v.arraySize; ++idx) {
+          metadata += t;
+        }
+      }
+      metadata += "\\n";
+    };
+    auto get_variable_type = [](const VariableDescription& v) {
+      return v.getVariableTypeIdentifier();
+    };
+    auto get_parameter_type = [](const VariableDescription& v) {
+      if (v.type == "int") {
+        return 1;
+      } else if (v.type == "ushort") {
+        return 2;
+      }
+      return 0;
+    };
+    add_names("MaterialProperties",
+              this->getMaterialPropertiesExternalNames(i, mb, h));
+    const auto& isvs = d.getPersistentVariables();
+    auto isvs_names = std::vector<std::string>{};
+    mb.getExternalNames(isvs_names, h, isvs);
+    add_names("InternalStateVariables", isvs_names);
+    add_types("InternalStateVariables", isvs, get_variable_type);
+    auto esvs = d.getExternalStateVariables();
+    if (shallRemoveTemperatureFromExternalStateVariables(mb)) {
+      esvs.erase(esvs.begin());
+    }
+    add_names("ExternalStateVariables", mb.getExternalNames(h, esvs));
+    add_types("ExternalStateVariables", esvs, get_variable_type);
+    const auto parameters = areParametersTreatedAsStaticVariables(mb)
+                                ? VariableDescriptionContainer{}
+                                : d.getParameters();
+    add_names("Parameters", parameters.getExternalNames());
+    add_types("Parameters", parameters, get_parameter_type);
+    exportStringSymbol(
+        out, this->getSymbolName(i, name, h) + "_mfront_metadata", metadata);
+  }  // end of writeMetadataSymbol
+
   void
   SymbolsGenerator::writeTemperatureRemovedFromExternalStateVariablesSymbol(
       std::ostream& out,
@@ -392,35 +453,19 @@ namespace mfront {
         out, i.getFunctionNameBasis(name) + "_ModellingHypotheses", hypotheses);
   }  // end of writeSupportedModellingHypothesis
 
-  void SymbolsGenerator::writeMaterialPropertiesSymbols(
-      std::ostream& out,
+  std::vector<std::string>
+  SymbolsGenerator::getMaterialPropertiesExternalNames(
       const BehaviourInterfaceBase& i,
       const BehaviourDescription& mb,
-      const std::string& name,
       const Hypothesis h) const {
     const auto mprops = i.buildMaterialPropertiesList(mb, h);
     for (const auto& mp : mprops.first) {
       if (SupportedTypes::getTypeFlag(mp.type) != SupportedTypes::SCALAR) {
         tfel::raise(
-            "SymbolsGenerator::writeMaterialPropertiesSymbols: "
+            "SymbolsGenerator::getMaterialPropertiesExternalNames: "
             "internal error: the material properties shall all be scalars");
       }
     }
-    auto empty_case = [this, &out, &i, &name, h] {
-      exportUnsignedShortSymbol(
-          out, this->getSymbolName(i, name, h) + "_nMaterialProperties", 0u);
-      this->writeArrayOfStringsSymbol(
-          out, this->getSymbolName(i, name, h) + "_MaterialProperties", {});
-    };
-    if (mprops.first.empty()) {
-      empty_case();
-      return;
-    }
-    const auto& last = mprops.first.back();
-    SupportedTypes::TypeSize s;
-    s = last.offset;
-    s += SupportedTypes::getTypeSize(last.type, last.arraySize);
-    s -= mprops.second;
     // index of the first element which is not imposed by the material
     // properties
     auto ib = std::vector<BehaviourMaterialProperty>::size_type{};
@@ -432,27 +477,35 @@ namespace mfront {
         found = true;
       }
     }
+    auto mps = std::vector<std::string>{};
     if (!found) {
-      empty_case();
-      return;
+      return mps;
     }
-    const auto mpnames = [&mprops, &ib] {
-      auto mps = std::vector<std::string>{};
-      for (auto idx = ib; idx != mprops.first.size(); ++idx) {
-        const auto& m = mprops.first[idx];
-        if (m.arraySize == 1u) {
-          mps.push_back(m.getExternalName());
-        } else {
-          for (unsigned short j = 0; j != m.arraySize; ++j) {
-            mps.push_back(m.getExternalName() + '[' + std::to_string(j) + ']');
-          }
+    for (auto idx = ib; idx != mprops.first.size(); ++idx) {
+      const auto& m = mprops.first[idx];
+      if (m.arraySize == 1u) {
+        mps.push_back(m.getExternalName());
+      } else {
+        for (unsigned short j = 0; j != m.arraySize; ++j) {
+          mps.push_back(m.getExternalName() + '[' + std::to_string(j) + ']');
         }
       }
-      return mps;
-    }();
+    }
+    return mps;
+  }  // end of getMaterialPropertiesExternalNames
+
+  void SymbolsGenerator::writeMaterialPropertiesSymbols(
+      std::ostream& out,
+      const BehaviourInterfaceBase& i,
+      const BehaviourDescription& mb,
+      const std::string& name,
+      const Hypothesis h) const {
+    // the material properties being all scalars, the number of material
+    // properties is the number of their external names
+    const auto mpnames = this->getMaterialPropertiesExternalNames(i, mb, h);
     exportUnsignedShortSymbol(
         out, this->getSymbolName(i, name, h) + "_nMaterialProperties",
-        static_cast<unsigned short>(s.getValueForDimension(1)));
+        static_cast<unsigned short>(mpnames.size()));
     this->writeArrayOfStringsSymbol(
         out, this->getSymbolName(i, name, h) + "_MaterialProperties", mpnames);
   }  // end of writeMaterialPropertiesSymbol
@@ -13,7 +13,6 @@
 
 #include <cstdlib>
 #include <sstream>
-#include <fstream>
 #include <stdexcept>
 #include <algorithm>
 
@@ -22,6 +21,7 @@
 #include "TFEL/System/System.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 
+#include "MFront/GeneratedFileStream.hxx"
 #include "MFront/DSLUtilities.hxx"
 #include "MFront/InstallPath.hxx"
 #include "MFront/MFrontUtilities.hxx"
@@ -873,7 +873,7 @@ namespace mfront {
              ? 1
              : 0);
     throw_if(nbh == 0, "no suitable modelling hypothesis supported");
-    std::ofstream out("include/MFront/ZMAT/" + headerFileName);
+    GeneratedFileStream out("include/MFront/ZMAT/" + headerFileName);
     throw_if(!out, "could not open header file '" + headerFileName + "'");
     out << "/*!\n"
         << "* \\file   " << headerFileName << '\n'
@@ -0,0 +1,117 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/EntryPointsIndexTest.cxx
+ * \brief  This test checks that the descriptions of the entry points
+ * stored in the index of a directory are the ones obtained by querying
+ * the libraries.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/EntryPointsIndex.hxx"
+
+//! \brief path to the library, given on the command line
+static std::string library;
+
+struct EntryPointsIndexTest final : public tfel::tests::TestCase {
+  EntryPointsIndexTest()
+      : tfel::tests::TestCase("TFEL/System", "EntryPointsIndexTest") {
+  }  // end of EntryPointsIndexTest
+
+  tfel::tests::TestResult execute() override {
+    namespace fs = std::filesystem;
+    using namespace tfel::system;
+    // the library is copied in a dedicated directory
+    const auto d = fs::path("EntryPointsIndexTest");
+    fs::remove_all(d);
+    fs::create_directory(d);
+    const auto l = d / fs::path(library).filename();
+    fs::copy_file(library, l);
+    const auto index = d / EntryPointsIndexFileName;
+    const auto ref = sort(getEntryPointsDescriptions(l.string()));
+    TFEL_TESTS_ASSERT(!ref.empty());
+    // creation of the index
+    TFEL_TESTS_ASSERT(!fs::exists(index));
+    const auto r1 = sort(getIndexedEntryPointsDescriptions(d.string(), 2));
+    TFEL_TESTS_ASSERT(fs::exists(index));
+    TFEL_TESTS_ASSERT(check(r1, ref));
+    // reading the index
+    const auto t = fs::last_write_time(index);
+    const auto r2 = sort(getIndexedEntryPointsDescriptions(d.string(), 2));
+    TFEL_TESTS_ASSERT(fs::last_write_time(index) == t);
+    TFEL_TESTS_ASSERT(check(r2, ref));
+    // an invalid index is rebuilt
+    std::ofstream(index) << "invalid index\n";
+    const auto r3 = sort(getIndexedEntryPointsDescriptions(d.string(), 2));
+    TFEL_TESTS_ASSERT(check(r3, ref));
+    const auto r4 = sort(getIndexedEntryPointsDescriptions(d.string(), 2));
+    TFEL_TESTS_ASSERT(check(r4, ref));
+    return this->result;
+  }  // end of execute
+
+ private:
+  using EntryPointDescription = tfel::system::EntryPointDescription;
+  //! \return the descriptions sorted by name
+  static std::vector<EntryPointDescription> sort(
+      std::vector<EntryPointDescription> descriptions) {
+    std::sort(descriptions.begin(), descriptions.end(),
+              [](const EntryPointDescription& a,
+                 const EntryPointDescription& b) { return a.name < b.name; });
+    return descriptions;
+  }  // end of sort
+  /*!
+   * \return if the descriptions read from the index are equal to the
+   * reference ones
+   * \param[in] r: descriptions read from the index
+   * \param[in] ref: reference descriptions
+   */
+  static bool check(const std::vector<EntryPointDescription>& r,
+                    const std::vector<EntryPointDescription>& ref) {
+    namespace fs = std::filesystem;
+    if (r.size() != ref.size()) {
+      return false;
+    }
+    for (decltype(r.size()) i = 0; i != r.size(); ++i) {
+      if ((!fs::equivalent(r[i].library, ref[i].library)) ||
+          (r[i].name != ref[i].name) || (r[i].type != ref[i].type) ||
+          (r[i].material != ref[i].material) ||
+          (r[i].interface != ref[i].interface) ||
+          (r[i].source != ref[i].source) ||
+          (r[i].hypotheses != ref[i].hypotheses)) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of check
+};
+
+TFEL_TESTS_GENERATE_PROXY(EntryPointsIndexTest, "EntryPointsIndexTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "usage: " << argv[0] << " library\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& manager = tfel::tests::TestManager::getTestManager();
+  manager.addTestOutput(std::cout);
+  manager.addXMLTestOutput("EntryPointsIndexTest.xml");
+  return manager.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,97 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/ExternalLibraryManagerConcurrencyTest.cxx
+ * \brief  This test checks that the `ExternalLibraryManager` can be queried
+ * concurrently from several threads.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+
+//! \brief path to the library, given on the command line
+static std::string library;
+
+struct ExternalLibraryManagerConcurrencyTest final
+    : public tfel::tests::TestCase {
+  ExternalLibraryManagerConcurrencyTest()
+      : tfel::tests::TestCase("TFEL/System",
+                              "ExternalLibraryManagerConcurrencyTest") {
+  }  // end of ExternalLibraryManagerConcurrencyTest
+
+  tfel::tests::TestResult execute() override {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto b = std::string{"ImplicitNorton"};
+    const auto h = std::string{"Tridimensional"};
+    // reference values, computed sequentially
+    const auto mps = elm.getUMATMaterialPropertiesNames(library, b, h);
+    const auto isvs = elm.getUMATInternalStateVariablesNames(library, b, h);
+    const auto isvs_types =
+        elm.getUMATInternalStateVariablesTypes(library, b, h);
+    const auto params = elm.getUMATParametersNames(library, b, h);
+    TFEL_TESTS_ASSERT(!isvs.empty());
+    TFEL_TESTS_ASSERT(!params.empty());
+    // the library is unloaded so that the first concurrent queries
+    // also load it and fill the caches
+    elm.unloadLibrary(library);
+    auto failures = std::atomic<int>{0};
+    auto threads = std::vector<std::thread>{};
+    for (int i = 0; i != 8; ++i) {
+      threads.emplace_back([&] {
+        try {
+          for (int j = 0; j != 100; ++j) {
+            if ((elm.getUMATMaterialPropertiesNames(library, b, h) != mps) ||
+                (elm.getUMATInternalStateVariablesNames(library, b, h) !=
+                 isvs) ||
+                (elm.getUMATInternalStateVariablesTypes(library, b, h) !=
+                 isvs_types) ||
+                (elm.getUMATParametersNames(library, b, h) != params) ||
+                (elm.getGenericBehaviourFunction(library, b + "_" + h) ==
+                 nullptr)) {
+              ++failures;
+            }
+          }
+        } catch (...) {
+          ++failures;
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    TFEL_TESTS_ASSERT(failures == 0);
+    return this->result;
+  }  // end of execute
+};
+
+TFEL_TESTS_GENERATE_PROXY(ExternalLibraryManagerConcurrencyTest,
+                          "ExternalLibraryManagerConcurrencyTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "usage: " << argv[0] << " library\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& manager = tfel::tests::TestManager::getTestManager();
+  manager.addTestOutput(std::cout);
+  manager.addXMLTestOutput("ExternalLibraryManagerConcurrencyTest.xml");
+  return manager.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,149 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/ExternalLibraryManagerMetadataTest.cxx
+ * \brief  This test checks that the metadata exported by behaviours in a
+ * single symbol are consistent with the individual symbols.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <dlfcn.h>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/StringAlgorithms.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+
+//! \brief path to the library, given on the command line
+static std::string library;
+
+struct ExternalLibraryManagerMetadataTest final
+    : public tfel::tests::TestCase {
+  ExternalLibraryManagerMetadataTest()
+      : tfel::tests::TestCase("TFEL/System",
+                              "ExternalLibraryManagerMetadataTest") {
+  }  // end of ExternalLibraryManagerMetadataTest
+
+  tfel::tests::TestResult execute() override {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto b = std::string{"ImplicitNorton"};
+    // the metadata of the hypotheses which don't define specific ones
+    // are exported without the name of the hypothesis
+    for (const auto& h : {"Tridimensional", "PlaneStress"}) {
+      const auto* const m =
+          static_cast<const char* const*>(getSymbol(b, h, "mfront_metadata"));
+      TFEL_TESTS_ASSERT(m != nullptr);
+      if (m != nullptr) {
+        TFEL_TESTS_ASSERT(
+            tfel::utilities::starts_with(*m, "mfront-metadata 1\n"));
+      }
+    }
+    for (const auto& h : {"Tridimensional", "PlaneStress"}) {
+      // the values returned by the external library manager are
+      // decoded from the metadata symbol
+      TFEL_TESTS_ASSERT(elm.getUMATMaterialPropertiesNames(library, b, h) ==
+                        this->getNames(b, h, "MaterialProperties"));
+      TFEL_TESTS_ASSERT(
+          elm.getUMATInternalStateVariablesNames(library, b, h) ==
+          this->getNames(b, h, "InternalStateVariables"));
+      TFEL_TESTS_ASSERT(
+          elm.getUMATInternalStateVariablesTypes(library, b, h) ==
+          this->getTypes(b, h, "InternalStateVariables"));
+      TFEL_TESTS_ASSERT(
+          elm.getUMATExternalStateVariablesNames(library, b, h) ==
+          this->getNames(b, h, "ExternalStateVariables"));
+      TFEL_TESTS_ASSERT(elm.getUMATParametersNames(library, b, h) ==
+                        this->getNames(b, h, "Parameters"));
+      TFEL_TESTS_ASSERT(elm.getUMATParametersTypes(library, b, h) ==
+                        this->getTypes(b, h, "Parameters"));
+    }
+    const auto isvs =
+        elm.getUMATInternalStateVariablesNames(library, b, "PlaneStress");
+    TFEL_TESTS_ASSERT((isvs == std::vector<std::string>{
+                                   "ElasticStrain", "p", "AxialStrain"}));
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \return the handle of the library, opened without the manager
+  static void* getLibrary() {
+    static void* lib = ::dlopen(library.c_str(), RTLD_NOW);
+    return lib;
+  }  // end of getLibrary
+  /*!
+   * \return the address of the symbol `f_h_n` or `f_n`
+   * \param[in] f: entry point
+   * \param[in] h: modelling hypothesis
+   * \param[in] n: name of the symbol
+   */
+  static void* getSymbol(const std::string& f,
+                         const std::string& h,
+                         const std::string& n) {
+    auto* const p = ::dlsym(getLibrary(), (f + "_" + h + "_" + n).c_str());
+    if (p != nullptr) {
+      return p;
+    }
+    return ::dlsym(getLibrary(), (f + "_" + n).c_str());
+  }  // end of getSymbol
+  //! \return the number of variables of the given array
+  static std::size_t getSize(const std::string& f,
+                             const std::string& h,
+                             const std::string& n) {
+    const auto* const p =
+        static_cast<unsigned short*>(getSymbol(f, h, "n" + n));
+    return p == nullptr ? 0 : *p;
+  }  // end of getSize
+  //! \return the names of the variables read from the individual symbols
+  std::vector<std::string> getNames(const std::string& f,
+                                    const std::string& h,
+                                    const std::string& n) {
+    const auto s = getSize(f, h, n);
+    if (s == 0) {
+      return {};
+    }
+    const auto* const p =
+        static_cast<const char* const*>(getSymbol(f, h, n));
+    TFEL_TESTS_ASSERT(p != nullptr);
+    return std::vector<std::string>(p, p + s);
+  }  // end of getNames
+  //! \return the types of the variables read from the individual symbols
+  std::vector<int> getTypes(const std::string& f,
+                            const std::string& h,
+                            const std::string& n) {
+    const auto s = getSize(f, h, n);
+    if (s == 0) {
+      return {};
+    }
+    const auto* const p =
+        static_cast<const int*>(getSymbol(f, h, n + "Types"));
+    TFEL_TESTS_ASSERT(p != nullptr);
+    return std::vector<int>(p, p + s);
+  }  // end of getTypes
+};
+
+TFEL_TESTS_GENERATE_PROXY(ExternalLibraryManagerMetadataTest,
+                          "ExternalLibraryManagerMetadataTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "usage: " << argv[0] << " library\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& manager = tfel::tests::TestManager::getTestManager();
+  manager.addTestOutput(std::cout);
+  manager.addXMLTestOutput("ExternalLibraryManagerMetadataTest.xml");
+  return manager.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,31 @@
+# run mtest on a file whose treatment is expected to fail with the
+# given error message
+# arguments checking
+if(NOT MTEST)
+  message(FATAL_ERROR "Require MTEST to be defined")
+endif(NOT MTEST)
+if(NOT LIBRARY)
+  message(FATAL_ERROR "Require LIBRARY to be defined")
+endif(NOT LIBRARY)
+if(NOT MTEST_FILE)
+  message(FATAL_ERROR "Require MTEST_FILE to be defined")
+endif(NOT MTEST_FILE)
+if(NOT EXPECTED_ERROR)
+  message(FATAL_ERROR "Require EXPECTED_ERROR to be defined")
+endif(NOT EXPECTED_ERROR)
+
+execute_process(
+  COMMAND ${MTEST} --verbose=level0 --xml-output=false
+  "--@library@=\"${LIBRARY}\"" ${MTEST_FILE}
+  OUTPUT_VARIABLE TEST_OUTPUT
+  ERROR_VARIABLE TEST_ERROR
+  RESULT_VARIABLE TEST_RESULT)
+
+if(TEST_RESULT EQUAL 0)
+  message(FATAL_ERROR "Failed: ${MTEST_FILE} was expected to fail")
+endif(TEST_RESULT EQUAL 0)
+string(FIND "${TEST_OUTPUT}${TEST_ERROR}" "${EXPECTED_ERROR}" pos)
+if(pos EQUAL -1)
+  message(FATAL_ERROR "Failed: unexpected error\n${TEST_OUTPUT}${TEST_ERROR}")
+endif(pos EQUAL -1)
+message(STATUS "Passed: ${MTEST_FILE} failed as expected")
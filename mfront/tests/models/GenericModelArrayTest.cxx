@@ -0,0 +1,211 @@
+/*!
+ * \file   mfront/tests/models/GenericModelArrayTest.cxx
+ * \brief  This test checks that the evaluation of models on whole fields
+ * through the array entry points generated by the `generic` interface is
+ * consistent with the point-wise entry points.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <dlfcn.h>
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+
+//! \brief path to the library, given on the command line
+static std::string library;
+
+struct GenericModelArrayTest final : public tfel::tests::TestCase {
+  GenericModelArrayTest()
+      : tfel::tests::TestCase("MFront/Model", "GenericModelArrayTest") {
+  }  // end of GenericModelArrayTest
+
+  tfel::tests::TestResult execute() override {
+    this->checkValidValues();
+    // failures in two chunks: the first failing one is reported
+    this->checkFailure({6000, 8000});
+    // failure in the last chunk only
+    this->checkFailure({8000});
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief number of points, greater than the one of the serial path
+  static constexpr mfront_gb_size_type n = 10000;
+  //! \brief a simple alias
+  using ArrayFunction = int (*)(mfront_gb_BehaviourData* const,
+                                const mfront_gb_size_type);
+  //! \brief fields of a model, stored by variable
+  struct Fields {
+    //! \brief external state variables at the beginning of the time step
+    std::vector<double> esv0;
+    //! \brief external state variables at the end of the time step
+    std::vector<double> esv1;
+    //! \brief internal state variables at the beginning of the time step
+    std::vector<double> isv0;
+    //! \brief internal state variables at the end of the time step
+    std::vector<double> isv1;
+  };
+  //! \brief result of an evaluation
+  struct Result {
+    //! \brief returned value
+    int r;
+    //! \brief proposed time step scaling factor
+    double rdt;
+    //! \brief error message
+    std::string msg;
+  };
+  //! \return the array entry point of the given model
+  static ArrayFunction getArrayFunction(const std::string& m) {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    auto* const lib = elm.loadLibrary(library);
+    return reinterpret_cast<ArrayFunction>(
+        ::dlsym(lib, (m + "_array").c_str()));
+  }  // end of getArrayFunction
+  //! \brief evaluate a model on all the points using the array entry point
+  static Result evaluate(const std::string& m, Fields& f) {
+    auto msg = std::array<char, 512>{};
+    auto rdt = double{1};
+    auto d = mfront_gb_BehaviourData{};
+    d.error_message = msg.data();
+    d.dt = 3600;
+    d.rdt = &rdt;
+    d.s0.external_state_variables = f.esv0.data();
+    d.s0.internal_state_variables = f.isv0.data();
+    d.s1.external_state_variables = f.esv1.data();
+    d.s1.internal_state_variables = f.isv1.data();
+    const auto r = getArrayFunction(m)(&d, n);
+    return {r, rdt, msg.data()};
+  }  // end of evaluate
+  /*!
+   * \brief evaluate a model at one point using the point-wise entry point
+   * \param[in] m: model
+   * \param[in] f: fields
+   * \param[in] i: index of the point
+   */
+  static Result evaluatePointWise(const std::string& m,
+                                  Fields& f,
+                                  const mfront_gb_size_type i) {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto fct =
+        elm.getGenericBehaviourFunction(library, m + "_Tridimensional");
+    const auto nesv = f.esv0.size() / n;
+    const auto nisv = f.isv0.size() / n;
+    auto esv0 = std::vector<double>(nesv);
+    auto esv1 = std::vector<double>(nesv);
+    auto isv0 = std::vector<double>(nisv);
+    auto isv1 = std::vector<double>(nisv);
+    for (decltype(f.esv0.size()) j = 0; j != nesv; ++j) {
+      esv0[j] = f.esv0[i + j * n];
+      esv1[j] = f.esv1[i + j * n];
+    }
+    for (decltype(f.isv0.size()) j = 0; j != nisv; ++j) {
+      isv0[j] = f.isv0[i + j * n];
+    }
+    auto msg = std::array<char, 512>{};
+    auto rdt = double{1};
+    auto d = mfront_gb_BehaviourData{};
+    d.error_message = msg.data();
+    d.dt = 3600;
+    d.rdt = &rdt;
+    d.s0.external_state_variables = esv0.data();
+    d.s0.internal_state_variables = isv0.data();
+    d.s1.external_state_variables = esv1.data();
+    d.s1.internal_state_variables = isv1.data();
+    const auto r = fct(&d);
+    for (decltype(f.isv0.size()) j = 0; j != nisv; ++j) {
+      f.isv1[i + j * n] = isv1[j];
+    }
+    return {r, rdt, msg.data()};
+  }  // end of evaluatePointWise
+  //! \brief compare the evaluation of a valid field to point-wise calls
+  void checkValidValues() {
+    // the `UO2_Shrinkage_RAPHAEL2008` model has two external state
+    // variables, the burn-up and the temperature, and one output
+    const auto m = std::string{"UO2_Shrinkage_RAPHAEL2008"};
+    auto f = Fields{std::vector<double>(2 * n), std::vector<double>(2 * n),
+                    std::vector<double>(n), std::vector<double>(n)};
+    for (mfront_gb_size_type i = 0; i != n; ++i) {
+      f.esv0[i] = 1.e-4 * i;
+      f.esv1[i] = f.esv0[i] + 0.5;
+      f.esv0[i + n] = 600 + 0.2 * i;
+      f.esv1[i + n] = f.esv0[i + n] + 10;
+      f.isv0[i] = -1.e-7 * i;
+    }
+    const auto r = evaluate(m, f);
+    TFEL_TESTS_ASSERT(r.r == 1);
+    TFEL_TESTS_ASSERT(r.rdt == 1);
+    const auto s = f.isv1;
+    auto ok = true;
+    for (mfront_gb_size_type i = 0; i != n; ++i) {
+      ok = (evaluatePointWise(m, f, i).r == 1) && ok;
+    }
+    TFEL_TESTS_ASSERT(ok);
+    TFEL_TESTS_ASSERT(s == f.isv1);
+  }  // end of checkValidValues
+  /*!
+   * \brief check the failure of the evaluation of a field
+   * \param[in] failures: points at which the evaluation fails
+   */
+  void checkFailure(const std::vector<mfront_gb_size_type>& failures) {
+    // the `SiC_IrradiationSwellingModel_GoFaster` model has three external
+    // state variables, the temperature, the fast neutron fluence and the
+    // fast neutron flux, and one output. It throws an exception if the
+    // temperature is greater than 1500°C.
+    const auto m = std::string{"SiC_IrradiationSwellingModel_GoFaster"};
+    auto f = Fields{std::vector<double>(3 * n), std::vector<double>(3 * n),
+                    std::vector<double>(n), std::vector<double>(n)};
+    for (mfront_gb_size_type i = 0; i != n; ++i) {
+      f.esv0[i] = f.esv1[i] = 1000;
+      f.esv0[i + n] = 1.e24;
+      f.esv1[i + n] = 1.1e24;
+      f.esv0[i + 2 * n] = f.esv1[i + 2 * n] = 1.e17;
+    }
+    for (const auto i : failures) {
+      f.esv0[i] = f.esv1[i] = 1700 + 100 * (i / 1000);
+    }
+    const auto r = evaluate(m, f);
+    const auto r2 = evaluatePointWise(m, f, failures.front());
+    TFEL_TESTS_ASSERT(r2.r == -1);
+    TFEL_TESTS_ASSERT(!r2.msg.empty());
+    TFEL_TESTS_ASSERT(r.r == -1);
+    TFEL_TESTS_ASSERT(r.msg == r2.msg);
+    TFEL_TESTS_ASSERT(r.rdt == r2.rdt);
+    TFEL_TESTS_ASSERT(r.rdt < 1);
+  }  // end of checkFailure
+};
+
+TFEL_TESTS_GENERATE_PROXY(GenericModelArrayTest, "GenericModelArrayTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "usage: " << argv[0] << " library\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& manager = tfel::tests::TestManager::getTestManager();
+  manager.addTestOutput(std::cout);
+  manager.addXMLTestOutput("GenericModelArrayTest.xml");
+  return manager.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,184 @@
+/*!
+ * \file   mfront/tests/properties/GenericMaterialPropertyArrayTest.cxx
+ * \brief  This test checks that the array entry points generated by the
+ * `generic` interface are consistent with the point-wise entry points.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cerrno>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+
+//! \brief path to the library, given on the command line
+static std::string library;
+
+struct GenericMaterialPropertyArrayTest final : public tfel::tests::TestCase {
+  GenericMaterialPropertyArrayTest()
+      : tfel::tests::TestCase("MFront", "GenericMaterialPropertyArrayTest") {
+  }  // end of GenericMaterialPropertyArrayTest
+
+  tfel::tests::TestResult execute() override {
+    this->checkValidValues();
+    this->checkOutOfBoundsValues();
+    this->checkErrnoHandling();
+    this->checkInvalidNumberOfArguments();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief a simple alias
+  using OutputStatus = mfront_gmp_OutputStatus;
+  //! \brief result of an evaluation
+  struct Result {
+    //! \brief output status
+    OutputStatus status;
+    //! \brief values
+    std::vector<double> values;
+  };
+  //! \brief evaluate a material property using the array entry point
+  static Result evaluate(const std::string& f,
+                         const std::vector<double>& args,
+                         const mfront_gmp_OutOfBoundsPolicy p,
+                         const mfront_gmp_size_type nargs = 1) {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto mp = elm.getGenericMaterialPropertyArrayFunction(library, f);
+    auto r = Result{};
+    r.values.resize(args.size());
+    const double* const a[1] = {args.data()};
+    mp(&(r.status), r.values.data(), a, nargs,
+       static_cast<mfront_gmp_size_type>(args.size()), p);
+    return r;
+  }  // end of evaluate
+  //! \brief evaluate a material property using the point-wise entry point
+  static Result evaluatePointWise(const std::string& f,
+                                  const std::vector<double>& args,
+                                  const mfront_gmp_OutOfBoundsPolicy p) {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto mp = elm.getGenericMaterialProperty(library, f);
+    auto r = Result{};
+    r.status.status = 0;
+    for (const auto v : args) {
+      auto s = OutputStatus{};
+      r.values.push_back(mp(&s, &v, 1, p));
+      if (s.status != 0) {
+        r.status = s;
+      }
+    }
+    return r;
+  }  // end of evaluatePointWise
+  //! \brief check the evaluation of valid values
+  void checkValidValues() {
+    const auto f = std::string{"VanadiumAlloy_YoungModulus_SRMA"};
+    auto T = std::vector<double>{};
+    for (int i = 0; i != 1000; ++i) {
+      T.push_back(293.15 + 680 * i / 999.);
+    }
+    const auto r = evaluate(f, T, GENERIC_MATERIALPROPERTY_STRICT_POLICY);
+    const auto r2 =
+        evaluatePointWise(f, T, GENERIC_MATERIALPROPERTY_STRICT_POLICY);
+    TFEL_TESTS_ASSERT(r.status.status == 0);
+    TFEL_TESTS_ASSERT(r2.status.status == 0);
+    TFEL_TESTS_ASSERT(r.values == r2.values);
+  }  // end of checkValidValues
+  //! \brief check the treatment of values out of bounds
+  void checkOutOfBoundsValues() {
+    const auto f = std::string{"VanadiumAlloy_YoungModulus_SRMA"};
+    const auto T = std::vector<double>{300, 200, 900, 100};
+    // strict policy: all the outputs are invalidated
+    const auto r = evaluate(f, T, GENERIC_MATERIALPROPERTY_STRICT_POLICY);
+    TFEL_TESTS_ASSERT(r.status.status == -1);
+    TFEL_TESTS_ASSERT(r.status.bounds_status == -1);
+    TFEL_TESTS_ASSERT(std::string{r.status.msg}.find("2 value(s)") !=
+                      std::string::npos);
+    for (const auto v : r.values) {
+      TFEL_TESTS_ASSERT(std::isnan(v));
+    }
+    // warning policy: the outputs are computed
+    const auto r2 = evaluate(f, T, GENERIC_MATERIALPROPERTY_WARNING_POLICY);
+    const auto r3 =
+        evaluatePointWise(f, T, GENERIC_MATERIALPROPERTY_WARNING_POLICY);
+    TFEL_TESTS_ASSERT(r2.status.status == 1);
+    TFEL_TESTS_ASSERT(r2.status.bounds_status == 1);
+    TFEL_TESTS_ASSERT(r3.status.status == 1);
+    TFEL_TESTS_ASSERT(r2.values == r3.values);
+    // physical bounds are checked whatever the policy
+    const auto r4 =
+        evaluate(f, {300, -1}, GENERIC_MATERIALPROPERTY_NONE_POLICY);
+    TFEL_TESTS_ASSERT(r4.status.status == -1);
+    TFEL_TESTS_ASSERT(std::isnan(r4.values[0]));
+  }  // end of checkOutOfBoundsValues
+  //! \brief check that errors reported by the C library are detected
+  void checkErrnoHandling() {
+    // the `ErrnoHandlingCheck` material property computes `acos(x)`
+    const auto f = std::string{"ErrnoHandlingCheck"};
+    const auto x = std::vector<double>{0, 0.5, 2, -0.5};
+    errno = 0;
+    const auto r = evaluate(f, x, GENERIC_MATERIALPROPERTY_NONE_POLICY);
+    const auto r2 =
+        evaluatePointWise(f, x, GENERIC_MATERIALPROPERTY_NONE_POLICY);
+    // the errno value is restored
+    TFEL_TESTS_ASSERT(errno == 0);
+    // the error of the C library takes precedence over the invalid values
+    TFEL_TESTS_ASSERT(r.status.status == -3);
+    TFEL_TESTS_ASSERT(r.status.c_error_number == EDOM);
+    TFEL_TESTS_ASSERT(r2.status.status == -3);
+    TFEL_TESTS_ASSERT(r2.status.c_error_number == EDOM);
+    for (decltype(x.size()) i = 0; i != x.size(); ++i) {
+      if (i == 2) {
+        TFEL_TESTS_ASSERT(std::isnan(r.values[i]));
+        TFEL_TESTS_ASSERT(std::isnan(r2.values[i]));
+      } else {
+        TFEL_TESTS_ASSERT(r.values[i] == r2.values[i]);
+        TFEL_TESTS_ASSERT(std::abs(r.values[i] - std::acos(x[i])) < 1e-14);
+      }
+    }
+    const auto r3 = evaluate(f, {0, 0.5}, GENERIC_MATERIALPROPERTY_NONE_POLICY);
+    TFEL_TESTS_ASSERT(r3.status.status == 0);
+  }  // end of checkErrnoHandling
+  //! \brief check that an invalid number of arguments is detected
+  void checkInvalidNumberOfArguments() {
+    const auto r = evaluate("VanadiumAlloy_YoungModulus_SRMA", {300, 400},
+                            GENERIC_MATERIALPROPERTY_STRICT_POLICY, 2);
+    TFEL_TESTS_ASSERT(r.status.status == -5);
+    for (const auto v : r.values) {
+      TFEL_TESTS_ASSERT(std::isnan(v));
+    }
+  }  // end of checkInvalidNumberOfArguments
+};
+
+TFEL_TESTS_GENERATE_PROXY(GenericMaterialPropertyArrayTest,
+                          "GenericMaterialPropertyArrayTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "usage: " << argv[0] << " library\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& manager = tfel::tests::TestManager::getTestManager();
+  manager.addTestOutput(std::cout);
+  manager.addXMLTestOutput("GenericMaterialPropertyArrayTest.xml");
+  return manager.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
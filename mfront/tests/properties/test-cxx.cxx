@@ -23,6 +23,7 @@
 #include <cmath>
 #include <cstdlib>
 #include <cassert>
+#include <algorithm>
 #include <iostream>
 
 #include "TFEL/Tests/TestCase.hxx"
@@ -32,6 +33,8 @@
 #include "ErrnoHandlingCheck-cxx.hxx"
 #include "VanadiumAlloy_YoungModulus_SRMA-cxx.hxx"
 #include "VanadiumAlloy_PoissonRatio_SRMA-cxx.hxx"
+#include "TabulationTest-cxx.hxx"
+#include "TabulationTest2-cxx.hxx"
 
 struct CxxMaterialPropertyInterfaceTest final : public tfel::tests::TestCase {
   CxxMaterialPropertyInterfaceTest()
@@ -71,6 +74,59 @@ struct CxxMaterialPropertyInterfaceTest final : public tfel::tests::TestCase {
 TFEL_TESTS_GENERATE_PROXY(CxxMaterialPropertyInterfaceTest,
                           "CxxMaterialPropertyInterfaceTest");
 
+struct TabulationTest final : public tfel::tests::TestCase {
+  TabulationTest()
+      : tfel::tests::TestCase("TFEL/Math", "TabulationTest") {
+  }  // end of TabulationTest
+  tfel::tests::TestResult execute() override {
+    // analytical expression of the tabulated material properties
+    const auto k = [](const double T) {
+      return 1 / (0.0375 + 2.165e-4 * T) +
+             4.715e9 / (T * T) * std::exp(-16361 / T);
+    };
+    const auto Tmin = 300.;
+    const auto Tmax = 2000.;
+    const auto n = 10000;
+    // maximum absolute value of the material property over the
+    // tabulation range, to which the accuracy is relative
+    auto kmax = 0.;
+    for (int i = 0; i <= n; ++i) {
+      kmax = std::max(kmax, std::abs(k(Tmin + (Tmax - Tmin) * i / n)));
+    }
+    const auto cubic = mfront::TabulationTest();
+    const auto linear = mfront::TabulationTest2();
+    // maximum errors over points which are not on the grid and over the
+    // bounds of the tabulation range
+    auto cubic_error = 0.;
+    auto linear_error = 0.;
+    auto update_errors = [&](const double T) {
+      cubic_error = std::max(cubic_error, std::abs(cubic(T) - k(T)));
+      linear_error = std::max(linear_error, std::abs(linear(T) - k(T)));
+    };
+    for (int i = 0; i <= n; ++i) {
+      update_errors(Tmin + (Tmax - Tmin) * (i + 0.37) / (n + 1));
+    }
+    update_errors(Tmin);
+    update_errors(Tmax);
+    TFEL_TESTS_ASSERT(cubic_error < 1.e-10 * kmax);
+    TFEL_TESTS_ASSERT(linear_error < 1.e-6 * kmax);
+    // the tabulations are not exact
+    TFEL_TESTS_ASSERT(cubic_error > 0);
+    TFEL_TESTS_ASSERT(linear_error > 0);
+    // the exact function is used outside the tabulation range
+#if (!defined _WIN32)
+    unsetenv("OUT_OF_BOUNDS_POLICY");
+#endif
+    for (const auto T : {250., 2500.}) {
+      TFEL_TESTS_ASSERT(std::abs(cubic(T) - k(T)) < 1.e-14 * k(T));
+      TFEL_TESTS_ASSERT(std::abs(linear(T) - k(T)) < 1.e-14 * k(T));
+    }
+    return this->result;
+  }  // end of execute
+};
+
+TFEL_TESTS_GENERATE_PROXY(TabulationTest, "TabulationTest");
+
 /* coverity [UNCAUGHT_EXCEPT]*/
 int main() {
   auto& manager = tfel::tests::TestManager::getTestManager();
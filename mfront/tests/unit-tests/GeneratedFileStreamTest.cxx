@@ -0,0 +1,99 @@
+/*!
+ * \file   mfront/tests/unit-tests/GeneratedFileStreamTest.cxx
+ * \brief  This test checks that the `GeneratedFileStream` class only
+ * writes files whose content changed.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <chrono>
+#include <string>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <filesystem>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "MFront/GeneratedFileStream.hxx"
+
+struct GeneratedFileStreamTest final : public tfel::tests::TestCase {
+  GeneratedFileStreamTest()
+      : tfel::tests::TestCase("MFront", "GeneratedFileStreamTest") {
+  }  // end of GeneratedFileStreamTest
+
+  tfel::tests::TestResult execute() override {
+    namespace fs = std::filesystem;
+    const auto f = std::string{"GeneratedFileStreamTest.txt"};
+    fs::remove(f);
+    // creation of a new file
+    write(f, "content");
+    TFEL_TESTS_ASSERT(fs::exists(f));
+    TFEL_TESTS_ASSERT(read(f) == "content");
+    // the modification time is set in the past, so that any rewriting of
+    // the file can be detected
+    const auto t = fs::last_write_time(f) - std::chrono::hours(1);
+    fs::last_write_time(f, t);
+    // writing the same content keeps the file untouched
+    write(f, "content");
+    TFEL_TESTS_ASSERT(read(f) == "content");
+    TFEL_TESTS_ASSERT(fs::last_write_time(f) == t);
+    // a new content is written
+    write(f, "new content");
+    TFEL_TESTS_ASSERT(read(f) == "new content");
+    TFEL_TESTS_ASSERT(fs::last_write_time(f) != t);
+    // a shorter content is written
+    write(f, "new");
+    TFEL_TESTS_ASSERT(read(f) == "new");
+    // the stream can't be opened twice
+    mfront::GeneratedFileStream out(f);
+    TFEL_TESTS_ASSERT(out.is_open());
+    out.open(f);
+    TFEL_TESTS_ASSERT(!out);
+    out.close();
+    TFEL_TESTS_ASSERT(!out.is_open());
+    // a file in a non existing directory can't be opened
+    mfront::GeneratedFileStream out2("GeneratedFileStreamTest/file.txt");
+    TFEL_TESTS_ASSERT(!out2);
+    TFEL_TESTS_ASSERT(!out2.is_open());
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief write the given content using a generated file stream
+  void write(const std::string& f, const std::string& c) {
+    mfront::GeneratedFileStream out(f);
+    TFEL_TESTS_ASSERT(out.is_open());
+    out << c;
+    out.close();
+    TFEL_TESTS_ASSERT(static_cast<bool>(out));
+  }  // end of write
+  //! \return the content of the given file
+  static std::string read(const std::string& f) {
+    std::ifstream in(f);
+    return std::string{std::istreambuf_iterator<char>{in},
+                       std::istreambuf_iterator<char>{}};
+  }  // end of read
+};
+
+TFEL_TESTS_GENERATE_PROXY(GeneratedFileStreamTest, "GeneratedFileStreamTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("GeneratedFileStreamTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
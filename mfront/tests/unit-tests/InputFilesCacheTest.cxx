@@ -0,0 +1,161 @@
+/*!
+ * \file   mfront/tests/unit-tests/InputFilesCacheTest.cxx
+ * \brief  This test checks that the `InputFilesCache` class detects the
+ * modifications of the input files, of their dependencies, of the
+ * options of the session and of the generated files.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <set>
+#include <string>
+#include <vector>
+#include <optional>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "MFront/InputFilesCache.hxx"
+
+struct InputFilesCacheTest final : public tfel::tests::TestCase {
+  InputFilesCacheTest()
+      : tfel::tests::TestCase("MFront", "InputFilesCacheTest") {
+  }  // end of InputFilesCacheTest
+
+  tfel::tests::TestResult execute() override {
+    namespace fs = std::filesystem;
+    using mfront::InputFilesCache;
+    // FNV-1a reference values
+    TFEL_TESTS_ASSERT(InputFilesCache::hash("") == "cbf29ce484222325");
+    TFEL_TESTS_ASSERT(InputFilesCache::hash("a") == "af63dc4c8601ec8c");
+    // the generated files are looked for in the `src` and `include`
+    // subdirectories of the current directory
+    const auto d = fs::path("InputFilesCacheTest");
+    fs::remove_all(d);
+    fs::create_directories(d / "src");
+    fs::create_directories(d / "include");
+    const auto cwd = fs::current_path();
+    fs::current_path(d);
+    std::ofstream("Test.mfront") << "@DSL Default;\n";
+    std::ofstream("Test.hxx") << "// dependency\n";
+    std::ofstream("src/Test.cxx") << "// source\n";
+    std::ofstream("include/Test.hxx") << "// header\n";
+    const auto t = getTargets();
+    const auto deps = std::set<std::string>{"Test.mfront", "Test.hxx"};
+    {
+      InputFilesCache c("cache.txt", "key");
+      TFEL_TESTS_ASSERT(!c.get("Test.mfront").has_value());
+      c.update("Test.mfront", deps, t);
+      TFEL_TESTS_ASSERT(check(c.get("Test.mfront")));
+      TFEL_TESTS_ASSERT(!c.get("Test2.mfront").has_value());
+      c.write();
+    }
+    // the cache is read back
+    TFEL_TESTS_ASSERT(check(InputFilesCache("cache.txt", "key")  //
+                                .get("Test.mfront")));
+    // a different session key invalidates the entries
+    TFEL_TESTS_ASSERT(
+        !InputFilesCache("cache.txt", "key2").get("Test.mfront").has_value());
+    // modification of a dependency
+    std::ofstream("Test.hxx") << "// modified dependency\n";
+    TFEL_TESTS_ASSERT(
+        !InputFilesCache("cache.txt", "key").get("Test.mfront").has_value());
+    // the files are compared by content, not by modification time
+    std::ofstream("Test.hxx") << "// dependency\n";
+    TFEL_TESTS_ASSERT(check(InputFilesCache("cache.txt", "key")  //
+                                .get("Test.mfront")));
+    // removal of a dependency
+    fs::remove("Test.hxx");
+    TFEL_TESTS_ASSERT(
+        !InputFilesCache("cache.txt", "key").get("Test.mfront").has_value());
+    std::ofstream("Test.hxx") << "// dependency\n";
+    // removal of a generated source
+    fs::remove("src/Test.cxx");
+    TFEL_TESTS_ASSERT(
+        !InputFilesCache("cache.txt", "key").get("Test.mfront").has_value());
+    std::ofstream("src/Test.cxx") << "// source\n";
+    // removal of a generated header
+    fs::remove("include/Test.hxx");
+    TFEL_TESTS_ASSERT(
+        !InputFilesCache("cache.txt", "key").get("Test.mfront").has_value());
+    std::ofstream("include/Test.hxx") << "// header\n";
+    TFEL_TESTS_ASSERT(check(InputFilesCache("cache.txt", "key")  //
+                                .get("Test.mfront")));
+    // entries whose dependencies can't be read are removed
+    {
+      InputFilesCache c("cache.txt", "key");
+      c.update("Test.mfront", {"Test.mfront", "Missing.hxx"}, t);
+      TFEL_TESTS_ASSERT(!c.get("Test.mfront").has_value());
+      c.write();
+    }
+    TFEL_TESTS_ASSERT(
+        !InputFilesCache("cache.txt", "key").get("Test.mfront").has_value());
+    // entries without dependencies are never valid
+    {
+      InputFilesCache c("cache.txt", "key");
+      c.update("Test.mfront", {}, t);
+      TFEL_TESTS_ASSERT(!c.get("Test.mfront").has_value());
+    }
+    // invalid cache files are ignored
+    std::ofstream("cache.txt") << "invalid cache file\n";
+    {
+      InputFilesCache c("cache.txt", "key");
+      TFEL_TESTS_ASSERT(!c.get("Test.mfront").has_value());
+      c.update("Test.mfront", deps, t);
+      c.write();
+    }
+    TFEL_TESTS_ASSERT(check(InputFilesCache("cache.txt", "key")  //
+                                .get("Test.mfront")));
+    fs::current_path(cwd);
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \return the targets generated by the test file
+  static mfront::TargetsDescription getTargets() {
+    auto t = mfront::TargetsDescription{};
+    auto& l = t.getLibrary("libTest");
+    l.sources.push_back("Test.cxx");
+    l.epts.push_back("Test");
+    t.headers.push_back("Test.hxx");
+    return t;
+  }  // end of getTargets
+  //! \return if the given targets are the ones generated by the test file
+  static bool check(const std::optional<mfront::TargetsDescription>& t) {
+    if (!t.has_value()) {
+      return false;
+    }
+    if ((t->libraries.size() != 1u) || (t->headers.size() != 1u)) {
+      return false;
+    }
+    const auto& l = t->libraries[0];
+    return (l.name == "libTest") &&
+           (l.sources == std::vector<std::string>{"Test.cxx"}) &&
+           (l.epts == std::vector<std::string>{"Test"}) &&
+           (t->headers[0] == "Test.hxx");
+  }  // end of check
+};
+
+TFEL_TESTS_GENERATE_PROXY(InputFilesCacheTest, "InputFilesCacheTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("InputFilesCacheTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,218 @@
+/*!
+ * \file   mtest/include/MTest/BehaviourBenchmark.hxx
+ * \brief  This file declares the `BehaviourBenchmark` class which measures
+ * the throughput of the integration of a behaviour on a set of
+ * independent material points.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_BEHAVIOURBENCHMARK_HXX
+#define LIB_MTEST_BEHAVIOURBENCHMARK_HXX
+
+#include <map>
+#include <vector>
+#include <string>
+#include <iosfwd>
+#include <cstddef>
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+#include "MTest/SolverOptions.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief a class measuring the number of behaviour integrations per
+   * second for various modelling hypotheses, loadings, types of
+   * stiffness matrices and numbers of threads.
+   *
+   * Each thread integrates the behaviour on its own set of material
+   * points, each material point being subjected to a strain-driven
+   * loading made of constant increments of the gradients.
+   */
+  struct MTEST_VISIBILITY_EXPORT BehaviourBenchmark {
+    //! \brief type of loading imposed to the material points
+    enum struct LoadingType {
+      //! \brief small increments of the gradients
+      ELASTIC,
+      //! \brief increments of the gradients of moderate amplitude
+      PLASTIC,
+      //! \brief large increments of the gradients
+      LARGEINCREMENTS
+    };  // end of LoadingType
+    //! \brief result of a benchmark case
+    struct Result {
+      //! \brief modelling hypothesis
+      std::string hypothesis;
+      //! \brief loading
+      std::string loading;
+      //! \brief type of stiffness matrix requested
+      std::string stiffness_matrix_type;
+      //! \brief number of threads
+      std::size_t number_of_threads = 0;
+      //! \brief number of integrations
+      std::size_t number_of_integrations = 0;
+      //! \brief number of failed integrations
+      std::size_t number_of_failures = 0;
+      //! \brief elapsed (wall clock) time, in seconds
+      double elapsed_time = 0;
+      //! \brief number of integrations per seconds
+      double integrations_per_second = 0;
+    };  // end of Result
+    /*!
+     * \return the loading type associated with the given string
+     * \param[in] l: loading name
+     */
+    static LoadingType getLoadingType(const std::string&);
+    /*!
+     * \return the name of the given loading type
+     * \param[in] l: loading type
+     */
+    static std::string getLoadingTypeName(const LoadingType);
+    /*!
+     * \return the stiffness matrix type associated with the given string
+     * \param[in] t: type name
+     */
+    static StiffnessMatrixType getStiffnessMatrixType(const std::string&);
+    /*!
+     * \return the name of the given stiffness matrix type
+     * \param[in] t: type
+     */
+    static std::string getStiffnessMatrixTypeName(const StiffnessMatrixType);
+    /*!
+     * \brief constructor
+     * \param[in] i: interface
+     * \param[in] l: library
+     * \param[in] f: function
+     */
+    BehaviourBenchmark(const std::string&,
+                       const std::string&,
+                       const std::string&);
+    //! \brief move constructor
+    BehaviourBenchmark(BehaviourBenchmark&&);
+    //! \brief copy constructor
+    BehaviourBenchmark(const BehaviourBenchmark&);
+    //! \brief move assignement
+    BehaviourBenchmark& operator=(BehaviourBenchmark&&);
+    //! \brief standard assignement
+    BehaviourBenchmark& operator=(const BehaviourBenchmark&);
+    /*!
+     * \brief set the value of a material property
+     * \param[in] n: name
+     * \param[in] v: value
+     */
+    void setMaterialProperty(const std::string&, const real);
+    /*!
+     * \brief set the value of an external state variable
+     * \param[in] n: name
+     * \param[in] v: value
+     */
+    void setExternalStateVariable(const std::string&, const real);
+    /*!
+     * \brief set the value of a parameter
+     * \param[in] n: name
+     * \param[in] v: value
+     */
+    void setParameter(const std::string&, const real);
+    /*!
+     * \brief set the value of an integer parameter
+     * \param[in] n: name
+     * \param[in] v: value
+     */
+    void setIntegerParameter(const std::string&, const int);
+    /*!
+     * \brief set the value of an unsigned short parameter
+     * \param[in] n: name
+     * \param[in] v: value
+     */
+    void setUnsignedIntegerParameter(const std::string&, const unsigned short);
+    /*!
+     * \brief set the modelling hypotheses to be tested. By default,
+     * all the modelling hypotheses supported by the behaviour are
+     * tested.
+     * \param[in] h: modelling hypotheses
+     */
+    void setModellingHypotheses(const std::vector<std::string>&);
+    //! \brief set the loadings to be tested
+    void setLoadings(const std::vector<LoadingType>&);
+    //! \brief set the types of stiffness matrices to be tested
+    void setStiffnessMatrixTypes(const std::vector<StiffnessMatrixType>&);
+    /*!
+     * \brief set the maximum number of threads. The benchmarks are run
+     * using 1, 2, 4, ... threads up to the given number.
+     * \param[in] n: number of threads
+     */
+    void setMaximumNumberOfThreads(const std::size_t);
+    //! \brief set the number of material points treated by each thread
+    void setNumberOfMaterialPoints(const std::size_t);
+    //! \brief set the number of time steps
+    void setNumberOfTimeSteps(const std::size_t);
+    //! \brief set the time increment
+    void setTimeIncrement(const real);
+    //! \brief run all the benchmark cases
+    std::vector<Result> execute() const;
+    /*!
+     * \brief write the results in a `JSON` format
+     * \param[out] os: output stream
+     * \param[in] results: results of the benchmark
+     */
+    void writeJSON(std::ostream&, const std::vector<Result>&) const;
+    //! \brief destructor
+    ~BehaviourBenchmark();
+
+   private:
+    /*!
+     * \brief run a benchmark case
+     * \param[in] h: modelling hypothesis
+     * \param[in] l: loading
+     * \param[in] k: type of stiffness matrix
+     * \param[in] n: number of threads
+     */
+    Result run(const std::string&,
+               const LoadingType,
+               const StiffnessMatrixType,
+               const std::size_t) const;
+    //! \brief interface
+    std::string interface;
+    //! \brief library
+    std::string library;
+    //! \brief function
+    std::string function;
+    //! \brief material properties
+    std::map<std::string, real> material_properties;
+    //! \brief external state variables
+    std::map<std::string, real> external_state_variables;
+    //! \brief parameters
+    std::map<std::string, real> parameters;
+    //! \brief integer parameters
+    std::map<std::string, int> integer_parameters;
+    //! \brief unsigned short parameters
+    std::map<std::string, unsigned short> unsigned_short_parameters;
+    //! \brief modelling hypotheses
+    std::vector<std::string> hypotheses;
+    //! \brief loadings
+    std::vector<LoadingType> loadings = {LoadingType::ELASTIC,
+                                         LoadingType::PLASTIC,
+                                         LoadingType::LARGEINCREMENTS};
+    //! \brief types of the stiffness matrices
+    std::vector<StiffnessMatrixType> stiffness_matrix_types = {
+        StiffnessMatrixType::CONSISTENTTANGENTOPERATOR};
+    //! \brief maximum number of threads
+    std::size_t number_of_threads = 1;
+    //! \brief number of material points per thread
+    std::size_t number_of_material_points = 1000;
+    //! \brief number of time steps
+    std::size_t number_of_time_steps = 20;
+    //! \brief time increment
+    real dt = 1;
+  };  // end of struct BehaviourBenchmark
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_BEHAVIOURBENCHMARK_HXX */
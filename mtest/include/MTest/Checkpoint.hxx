@@ -0,0 +1,110 @@
+/*!
+ * \file   mtest/include/MTest/Checkpoint.hxx
+ * \brief  This file declares the functions used to write and read the
+ * checkpoint files of `mtest` and `ptest`.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_CHECKPOINT_HXX
+#define LIB_MTEST_CHECKPOINT_HXX
+
+#include <iosfwd>
+#include <string>
+#include <cstddef>
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+
+namespace mtest {
+
+  // forward declaration
+  struct CurrentState;
+
+  /*!
+   * \brief write the header of a checkpoint file
+   * \param[out] os: output stream
+   * \param[in] t: time at which the checkpoint is written
+   *
+   * The checkpoint files are written in a binary format which is not
+   * portable: a checkpoint file can only be read on the architecture
+   * on which it was written.
+   */
+  MTEST_VISIBILITY_EXPORT void writeCheckpointHeader(std::ostream&,
+                                                     const real);
+  /*!
+   * \brief read the header of a checkpoint file
+   * \return the time at which the checkpoint was written
+   * \param[in] is: input stream
+   */
+  MTEST_VISIBILITY_EXPORT real readCheckpointHeader(std::istream&);
+  /*!
+   * \brief write a value in a checkpoint file
+   * \param[out] os: output stream
+   * \param[in] v: value
+   */
+  MTEST_VISIBILITY_EXPORT void writeCheckpointData(std::ostream&, const bool);
+  //! \brief overload for integers
+  MTEST_VISIBILITY_EXPORT void writeCheckpointData(std::ostream&,
+                                                   const std::size_t);
+  //! \brief overload for reals
+  MTEST_VISIBILITY_EXPORT void writeCheckpointData(std::ostream&, const real);
+  //! \brief overload for strings
+  MTEST_VISIBILITY_EXPORT void writeCheckpointData(std::ostream&,
+                                                   const std::string&);
+  //! \brief overload for vectors
+  MTEST_VISIBILITY_EXPORT void writeCheckpointData(
+      std::ostream&, const tfel::math::vector<real>&);
+  //! \brief overload for matrices
+  MTEST_VISIBILITY_EXPORT void writeCheckpointData(
+      std::ostream&, const tfel::math::matrix<real>&);
+  //! \brief overload for rotation matrices
+  MTEST_VISIBILITY_EXPORT void writeCheckpointData(
+      std::ostream&, const tfel::math::tmatrix<3u, 3u, real>&);
+  //! \brief overload for the state of a material point
+  MTEST_VISIBILITY_EXPORT void writeCheckpointData(std::ostream&,
+                                                   const CurrentState&);
+  /*!
+   * \brief read a value from a checkpoint file
+   * \param[in] is: input stream
+   * \param[out] v: value
+   */
+  MTEST_VISIBILITY_EXPORT void readCheckpointData(std::istream&, bool&);
+  //! \brief overload for integers
+  MTEST_VISIBILITY_EXPORT void readCheckpointData(std::istream&, std::size_t&);
+  //! \brief overload for reals
+  MTEST_VISIBILITY_EXPORT void readCheckpointData(std::istream&, real&);
+  //! \brief overload for strings
+  MTEST_VISIBILITY_EXPORT void readCheckpointData(std::istream&, std::string&);
+  /*!
+   * \brief overload for vectors.
+   * \note if the vector is not empty, the size of the vector read must
+   * match the size of the given vector.
+   */
+  MTEST_VISIBILITY_EXPORT void readCheckpointData(std::istream&,
+                                                  tfel::math::vector<real>&);
+  //! \brief overload for matrices
+  MTEST_VISIBILITY_EXPORT void readCheckpointData(std::istream&,
+                                                  tfel::math::matrix<real>&);
+  //! \brief overload for rotation matrices
+  MTEST_VISIBILITY_EXPORT void readCheckpointData(
+      std::istream&, tfel::math::tmatrix<3u, 3u, real>&);
+  /*!
+   * \brief overload for the state of a material point.
+   * \note the state must have been allocated: the sizes of the arrays
+   * read are checked against the sizes of the arrays of the state.
+   */
+  MTEST_VISIBILITY_EXPORT void readCheckpointData(std::istream&,
+                                                  CurrentState&);
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_CHECKPOINT_HXX */
@@ -15,8 +15,10 @@
 #define LIB_MTEST_MTESTEVOLUTION_HXX
 
 #include <map>
+#include <atomic>
 #include <vector>
 #include <memory>
+#include <cstddef>
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
 
@@ -82,7 +84,14 @@ namespace mtest {
     real value;
   };
 
-  //! \brief a linear per interval evolution
+  /*!
+   * \brief a linear per interval evolution.
+   *
+   * The times and the values are stored in flat sorted arrays. The
+   * index of the last interval used is kept and used as a starting
+   * point for the next evaluation, which makes the evaluation
+   * performed at increasing times almost free.
+   */
   struct MTEST_VISIBILITY_EXPORT LPIEvolution final : public Evolution {
     /*!
      * \return the interpolation in a set of values
@@ -105,7 +114,12 @@ namespace mtest {
     ~LPIEvolution() override;
 
    private:
-    std::map<real, real> values;
+    //! \brief times, sorted in increasing order
+    std::vector<real> times;
+    //! \brief values associated with the times
+    std::vector<real> values;
+    //! \brief index of the upper bound of the last interval used
+    mutable std::atomic<std::size_t> cursor = 0;
   };  // end of struct LPIEvolution
 
   /*!
@@ -14,6 +14,9 @@
 #ifndef LIB_MTEST_MTESTFUNCTIONEVOLUTION_HXX
 #define LIB_MTEST_MTESTFUNCTIONEVOLUTION_HXX
 
+#include <vector>
+#include <string>
+#include <memory>
 #include "TFEL/Math/Evaluator.hxx"
 
 #include "MTest/Config.hxx"
@@ -22,6 +25,15 @@
 
 namespace mtest {
 
+  /*!
+   * \brief an evolution defined by a formula which may depend on the
+   * time and on other evolutions.
+   *
+   * The arguments of the formula are resolved once for all at the
+   * first evaluation and the last evaluation is memoised: the formula
+   * is only evaluated if the time or the value of one of its arguments
+   * changed.
+   */
   struct MTEST_VISIBILITY_EXPORT FunctionEvolution : public Evolution {
     /*!
      * constructor
@@ -37,10 +49,30 @@ namespace mtest {
     ~FunctionEvolution() override;
 
    private:
+    //! \brief resolve the arguments of the formula, if not already done
+    void resolveArguments() const;
     //! \brief externally defined evolutions
     const EvolutionManager& evm;
+    //! \brief names of the arguments of the formula
+    std::vector<std::string> args;
     //! \brief Evaluator
     mutable tfel::math::Evaluator f;
+    /*!
+     * \brief evolutions associated with each argument of the formula, or
+     * `nullptr` if the argument is the time. Those pointers refer to
+     * the elements of the evolution manager, so that an evolution
+     * redefined after the resolution of the arguments is taken into
+     * account.
+     */
+    mutable std::vector<const std::shared_ptr<Evolution>*> slots;
+    //! \brief boolean stating if the arguments have been resolved
+    mutable bool resolved = false;
+    //! \brief values of the arguments used in the last evaluation
+    mutable std::vector<real> arguments_values;
+    //! \brief result of the last evaluation
+    mutable real value = 0;
+    //! \brief boolean stating if the last evaluation is available
+    mutable bool memoised = false;
   };
 
 }  // end of namespace mtest
@@ -36,8 +36,17 @@
 #include "MTest/AccelerationAlgorithm.hxx"
 #include "MTest/SingleStructureScheme.hxx"
 
+namespace tfel::system {
+  // forward declaration
+  struct ThreadPool;
+}  // end of namespace tfel::system
+
 namespace mtest {
 
+  //! forward declaration
+  struct BehaviourWorkSpace;
+  //! forward declaration
+  struct StructureCurrentState;
   //! forward declaration
   struct UserDefinedPostProcessing;
 
@@ -69,6 +78,32 @@ namespace mtest {
       //! desctructor
       virtual ~UTest();
     };
+    /*!
+     * \brief description of a material point of an aggregate.
+     *
+     * When material points are declared, the material is described as
+     * an aggregate of material points subjected to the same gradients
+     * (Taylor homogenisation scheme). The thermodynamic forces, the
+     * tangent operator, the internal state variables and the energies
+     * of the aggregate are the weighted averages of the ones of the
+     * material points.
+     */
+    struct MaterialPoint {
+      //! \brief weight (volume fraction) of the material point
+      real weight = 1;
+      //! \brief if true, the rotation matrix has been defined
+      bool isRotationMatrixDefined = false;
+      //! \brief rotation matrix
+      tfel::math::tmatrix<3u, 3u, real> r =
+          tfel::math::tmatrix<3u, 3u, real>::Id();
+      //! \brief values of the material properties specific to the point
+      std::map<std::string, real> material_properties;
+      /*!
+       * \brief name of the phase to which the material point belongs.
+       * Phases are only used to write the averaged state of each phase.
+       */
+      std::string phase;
+    };  // end of MaterialPoint
     /*!
      * default constructor
      */
@@ -186,6 +221,33 @@ namespace mtest {
      */
     virtual void setRotationMatrix(const tfel::math::tmatrix<3u, 3u, real>&,
                                    const bool = false);
+    /*!
+     * \brief add a new material point to the aggregate
+     * \param[in] p: material point
+     */
+    virtual void addMaterialPoint(const MaterialPoint&);
+    //! \return the number of material points of the aggregate
+    std::size_t getNumberOfMaterialPoints() const;
+    /*!
+     * \brief set the name of the file where the state of each material
+     * point of the aggregate is written
+     * \param[in] f: file name
+     */
+    virtual void setMaterialPointsOutputFile(const std::string&);
+    /*!
+     * \brief set the name of the file where the averaged state of each
+     * phase of the aggregate is written
+     * \param[in] f: file name
+     */
+    virtual void setMaterialPointsPhasesOutputFile(const std::string&);
+    /*!
+     * \brief set the number of threads used to integrate the behaviour
+     * on the material points of the aggregate or, if no material point
+     * is declared, to perform the perturbed integrations required to
+     * compute the numerical tangent operator
+     * \param[in] n: number of threads
+     */
+    virtual void setNumberOfThreads(const std::size_t);
     /*!
      * \brief set criterium value for the convergence test on the on
      * the driving variable
@@ -254,6 +316,58 @@ namespace mtest {
      */
     virtual void setGaussPointPositionForEvolutionsEvaluation(
         const CurrentState&) const override;
+    bool doPackagingStep(StudyCurrentState&) const override;
+    /*!
+     * \brief integrate the behaviour. If material points have been
+     * declared, the behaviour is integrated on each material point and
+     * the state `s` is set to the average of the states of the
+     * material points.
+     * \param[in,out] state: current state of the study
+     * \param[in,out] s: current state
+     * \param[in,out] bwk: behaviour workspace
+     * \param[in] dt: time increment
+     * \param[in] mt: type of stiffness matrix
+     */
+    std::pair<bool, real> integrateBehaviour(StudyCurrentState&,
+                                             CurrentState&,
+                                             BehaviourWorkSpace&,
+                                             const real,
+                                             const StiffnessMatrixType) const;
+    /*!
+     * \brief compute the prediction operator. If material points have
+     * been declared, the prediction operator is the average of the
+     * prediction operators of the material points.
+     * \param[in,out] state: current state of the study
+     * \param[in,out] s: current state
+     * \param[in,out] bwk: behaviour workspace
+     * \param[in] mt: type of stiffness matrix
+     */
+    std::pair<bool, real> computePredictionOperator(
+        StudyCurrentState&,
+        const CurrentState&,
+        BehaviourWorkSpace&,
+        const StiffnessMatrixType) const;
+    /*!
+     * \brief compute the numerical tangent operator by centred finite
+     * differences, the perturbed integrations being performed
+     * concurrently by the threads of the thread pool. Each thread
+     * uses a private copy of the state and a private workspace.
+     * \return true on success
+     * \param[in,out] scs: current state of the structure
+     * \param[in] s: current state, after the integration
+     * \param[in,out] bwk: behaviour workspace. The numerical tangent
+     * operator is stored in the `nk` member
+     * \param[in] dt: time increment
+     * \param[in] mt: type of stiffness matrix
+     * \note the thread pool must have been created and no material
+     * point must have been declared.
+     */
+    bool computeNumericalTangentOperatorInParallel(
+        StructureCurrentState&,
+        const CurrentState&,
+        BehaviourWorkSpace&,
+        const real,
+        const StiffnessMatrixType) const;
     /*!
      * \return the number of unknowns (size of driving variables plus
      * the number of lagrangian multipliers)
@@ -281,6 +395,35 @@ namespace mtest {
     real pv = -1;
     //! compare to numerical jacobian
     bool cto = false;
+    //! \brief material points of the aggregate
+    std::vector<MaterialPoint> material_points;
+    /*!
+     * \brief normalised weights of the material points and positions
+     * and values of the material properties specific to each material
+     * point
+     */
+    std::vector<std::pair<real, std::vector<std::pair<std::size_t, real>>>>
+        material_points_data;
+    //! \brief name of the output file of the material points
+    std::string material_points_output;
+    //! \brief output file of the material points
+    mutable std::ofstream material_points_out;
+    /*!
+     * \brief phases of the aggregate. For each phase, the positions of
+     * the material points belonging to this phase and their weights,
+     * normalised by the weight of the phase, are stored.
+     */
+    std::vector<std::pair<std::string,
+                          std::vector<std::pair<std::size_t, real>>>>
+        phases;
+    //! \brief name of the output file of the phases
+    std::string material_points_phases_output;
+    //! \brief output file of the phases
+    mutable std::ofstream material_points_phases_out;
+    //! \brief number of threads
+    std::size_t number_of_threads = 1;
+    //! \brief thread pool used to integrate the material points
+    std::shared_ptr<tfel::system::ThreadPool> thread_pool;
   };  // end of struct MTest
 
 }  // end of namespace mtest
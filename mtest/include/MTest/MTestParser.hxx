@@ -261,6 +261,37 @@ namespace mtest {
      * \param[in,out] p: position in the input file
      */
     virtual void handleUserDefinedPostProcessing(MTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@MaterialPoint` keyword
+     * \param[in,out] t: `MTest` object to be configured
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleMaterialPoint(MTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@MaterialPoints` keyword
+     * \param[in,out] t: `MTest` object to be configured
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleMaterialPoints(MTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@MaterialPointsOutputFile` keyword
+     * \param[in,out] t: `MTest` object to be configured
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleMaterialPointsOutputFile(MTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@MaterialPointsPhasesOutputFile` keyword
+     * \param[in,out] t: `MTest` object to be configured
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleMaterialPointsPhasesOutputFile(MTest&,
+                                                      tokens_iterator&);
+    /*!
+     * \brief handle the `@NumberOfThreads` keyword
+     * \param[in,out] t: `MTest` object to be configured
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleNumberOfThreads(MTest&, tokens_iterator&);
     /*!
      * \brief read the options associated with a constraint
      * \param[in] m: calling method
@@ -479,6 +479,12 @@ namespace mtest {
      * \param[in] n: named of the variable tested
      */
     void checkIntegralTestArgument(const std::string&) const;
+    //! \brief write the states of the oxidation models
+    void writeAdditionalCheckpointData(std::ostream&,
+                                       const StudyCurrentState&) const override;
+    //! \brief read the states of the oxidation models
+    void readAdditionalCheckpointData(std::istream&,
+                                      StudyCurrentState&) const override;
 
    private:
     //! \brief a simple alias
@@ -495,7 +501,7 @@ namespace mtest {
       //! \brief description
       std::string d;
       //! \brief functor
-      std::function<void(std::ostream&, const StudyCurrentState&)> f;
+      std::function<real(const StudyCurrentState&)> f;
     };
     //! \brief additional outputs
     std::vector<AdditionalOutput> aoutputs;
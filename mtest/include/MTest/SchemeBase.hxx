@@ -17,10 +17,12 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <iosfwd>
 #include <fstream>
 
 #include "TFEL/Material/ModellingHypothesis.hxx"
 #include "TFEL/Material/MechanicalBehaviour.hxx"
+#include "TFEL/Utilities/BinaryData.hxx"
 
 #include "MTest/Types.hxx"
 #include "MTest/Config.hxx"
@@ -39,6 +41,11 @@ namespace mtest {
       USERDEFINEDTIMES,
       EVERYPERIOD
     };  // end of enum OutputFrequency
+    //! \brief format of the output file
+    enum OutputFileFormat {
+      TEXTFORMAT,
+      BINARYFORMAT
+    };  // end of enum OutputFileFormat
     //! a simple alias
     using ModellingHypothesis = tfel::material::ModellingHypothesis;
     //! a simple alias
@@ -80,6 +87,11 @@ namespace mtest {
      * \param[in] p : precision
      */
     virtual void setOutputFilePrecision(const unsigned int);
+    /*!
+     * \brief set the output file format
+     * \param[in] f : format
+     */
+    virtual void setOutputFileFormat(const OutputFileFormat);
     /*!
      * \brief set the residual file
      * \param[in] f : file name
@@ -224,6 +236,19 @@ namespace mtest {
      * \param[in] p : period
      */
     virtual void setCastemAccelerationPeriod(const int);
+    /*!
+     * \brief set the checkpoint file
+     * \param[in] f: file name
+     * \param[in] n: number of time steps between two checkpoints
+     */
+    virtual void setCheckpointFileName(const std::string&,
+                                       const std::size_t = 1);
+    /*!
+     * \brief set the name of the checkpoint file from which the
+     * computation is restarted
+     * \param[in] f: file name
+     */
+    virtual void setRestartFileName(const std::string&);
     /*!
      * \brief close and reopen the output files
      */
@@ -239,6 +264,50 @@ namespace mtest {
    protected:
     //! \return the default stiffness matrix type
     virtual StiffnessMatrixType getDefaultStiffnessMatrixType() const = 0;
+    /*!
+     * \brief restore the state from the restart file, if any.
+     * \return the index of the time from which the computation is resumed
+     * \param[out] s: state
+     */
+    std::vector<real>::size_type restart(StudyCurrentState&) const;
+    /*!
+     * \brief write a checkpoint, if required
+     * \param[in] s: state
+     * \param[in] i: index of the time reached
+     */
+    void writeCheckpoint(const StudyCurrentState&,
+                         const std::vector<real>::size_type) const;
+    /*!
+     * \brief write the data specific to the scheme in a checkpoint file
+     * \param[out] os: output stream
+     * \param[in] s: state
+     */
+    virtual void writeAdditionalCheckpointData(std::ostream&,
+                                               const StudyCurrentState&) const;
+    /*!
+     * \brief read the data specific to the scheme from a checkpoint file
+     * \param[in] is: input stream
+     * \param[out] s: state
+     */
+    virtual void readAdditionalCheckpointData(std::istream&,
+                                              StudyCurrentState&) const;
+    /*!
+     * \brief write the header of the output file
+     * \param[in] d: description of the columns
+     * \param[in] l: legends of the columns
+     *
+     * In the text format, the descriptions are written as comments. In
+     * the binary format, the legends are stored in the header of the file.
+     */
+    void writeOutputFileHeader(const std::vector<std::string>&,
+                               const std::vector<std::string>&) const;
+    /*!
+     * \brief write a row of values in the output file
+     * \param[in] v: values
+     */
+    void writeOutputFileRow(const std::vector<real>&) const;
+    //! \brief flush the output file
+    void flushOutputFile() const;
     /*!
      * \brief declare a new variable
      * \param[in] v : variable name
@@ -272,6 +341,8 @@ namespace mtest {
     std::string output;
     //! output file
     mutable std::ofstream out;
+    //! \brief output file in the binary format
+    mutable std::unique_ptr<tfel::utilities::BinaryDataWriter> binary_out;
     //! residual file name
     std::string residualFileName;
     //! xml file name
@@ -283,8 +354,16 @@ namespace mtest {
     OutputFrequency output_frequency = USERDEFINEDTIMES;
     //! output file precision
     int oprec = -1;
+    //! \brief output file format
+    OutputFileFormat output_file_format = TEXTFORMAT;
     //! residual file precision
     int rprec = -1;
+    //! \brief checkpoint file name
+    std::string checkpoint_file;
+    //! \brief number of time steps between two checkpoints
+    std::size_t checkpoint_frequency = 1;
+    //! \brief name of the checkpoint file used to restart the computation
+    std::string restart_file;
   };  // end of struct SchemeBase
 
 }  // end of namespace mtest
@@ -64,6 +64,11 @@ namespace mtest {
      * \param[in,out] p : position in the input file
      */
     virtual void handleMessage(SchemeBase&, tokens_iterator&);
+    /*!
+     * \brief handle the `@Checkpoint` keyword
+     * \param[in,out] p : position in the input file
+     */
+    virtual void handleCheckpoint(SchemeBase&, tokens_iterator&);
     /*!
      * \brief handle the `@OutputFrequency` keyword
      * \param[in,out] p : position in the input file
@@ -183,6 +188,11 @@ namespace mtest {
      * \param[in,out] p : position in the input file
      */
     virtual void handleOutputFilePrecision(SchemeBase&, tokens_iterator&);
+    /*!
+     * \brief handle the `@OutputFileFormat` keyword
+     * \param[in,out] p : position in the input file
+     */
+    virtual void handleOutputFileFormat(SchemeBase&, tokens_iterator&);
     /*!
      * \brief handle the `@ResidualFile` keyword
      * \param[in,out] p : position in the input file
@@ -173,6 +173,16 @@ namespace mtest {
     virtual void setBehaviour(const std::shared_ptr<Behaviour>&);
     //! \return the default stiffness matrix type
     StiffnessMatrixType getDefaultStiffnessMatrixType() const override;
+    /*!
+     * \brief compute the thermal strains at the beginning and at the
+     * end of the time step, if required.
+     * \param[in,out] s: current state
+     * \param[in] t: current time
+     * \param[in] dt: time increment
+     */
+    virtual void computeThermalStrains(CurrentState&,
+                                       const real,
+                                       const real) const;
     //! \brief list of internal variable names, including their suffixes
     std::vector<std::string> ivfullnames;
     //! \brief the mechanical behaviour
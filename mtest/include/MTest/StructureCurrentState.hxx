@@ -71,6 +71,15 @@ namespace mtest {
     void setModellingHypothesis(const Hypothesis);
     //! \return the behaviour workspace associated to the current thread.
     BehaviourWorkSpace &getBehaviourWorkSpace() const;
+    /*!
+     * \return the i-th behaviour workspace. This method is meant to
+     * provide a private workspace to each thread when the integration
+     * points are treated in parallel.
+     * \param[in] i: index of the workspace
+     * \note the workspaces are allocated on demand: this method is not
+     * thread-safe and shall be called before launching the threads.
+     */
+    BehaviourWorkSpace &getBehaviourWorkSpace(const std::size_t) const;
     //! \return the behaviour associated to the structure
     const Behaviour &getBehaviour() const;
     /*!
@@ -16,6 +16,7 @@
 
 #include <map>
 #include <string>
+#include <iosfwd>
 #include <memory>
 
 #include "TFEL/Config/TFELConfig.hxx"
@@ -164,6 +165,31 @@ namespace mtest {
     void setNumberOfFailureCriterionStatus(const std::size_t);
     //! \return the number of failure criterion status
     std::size_t getNumberOfFailureCriterionStatus() const noexcept;
+    /*!
+     * \brief write the state in a checkpoint file
+     * \param[out] os: output stream
+     * \param[in] t: current time
+     *
+     * The evolutions stored in the state are saved through their values
+     * at the current time.
+     *
+     * \note the states of the auxiliary models of the structures are
+     * not written, since the models are only known by the schemes.
+     */
+    void writeCheckpoint(std::ostream&, const real) const;
+    /*!
+     * \brief restore the state from a checkpoint file
+     * \param[in] is: input stream
+     * \param[in] t: current time
+     *
+     * The values of the evolutions stored in the checkpoint file are
+     * either assigned to the constant evolutions or inserted at the
+     * current time in the other evolutions.
+     *
+     * \note the state must have been initialized by the scheme which
+     * wrote the checkpoint file.
+     */
+    void readCheckpoint(std::istream&, const real);
     // vector of unknows at
     // the beginning of the
     // previous time step.
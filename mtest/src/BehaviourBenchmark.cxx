@@ -0,0 +1,413 @@
+/*!
+ * \file   mtest/src/BehaviourBenchmark.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <utility>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Config/GetTFELVersion.h"
+#include "TFEL/System/ThreadPool.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "TFEL/Material/MechanicalBehaviour.hxx"
+#include "TFEL/Material/ModellingHypothesis.hxx"
+#include "MTest/Evolution.hxx"
+#include "MTest/Behaviour.hxx"
+#include "MTest/CurrentState.hxx"
+#include "MTest/BehaviourWorkSpace.hxx"
+#include "MTest/BehaviourBenchmark.hxx"
+
+namespace mtest {
+
+  /*!
+   * \return the amplitude of the increment of the gradients associated
+   * with the given loading
+   * \param[in] l: loading
+   */
+  static real getGradientIncrementAmplitude(
+      const BehaviourBenchmark::LoadingType l) {
+    if (l == BehaviourBenchmark::LoadingType::ELASTIC) {
+      return real(1e-6);
+    } else if (l == BehaviourBenchmark::LoadingType::PLASTIC) {
+      return real(5e-4);
+    }
+    return real(5e-3);
+  }  // end of getGradientIncrementAmplitude
+
+  /*!
+   * \return the direction of the increment of the gradients. The first
+   * component is stretched, the next two components are contracted and
+   * the remaining (shear) components are slightly loaded so that all the
+   * components of the gradients are exercised.
+   * \param[in] b: behaviour
+   */
+  static tfel::math::vector<real> getGradientIncrementDirection(
+      const Behaviour& b) {
+    const auto n = b.getGradientsSize();
+    auto d = tfel::math::vector<real>(n, real(0));
+    for (decltype(d.size()) i = 0; i != d.size(); ++i) {
+      if (i == 0) {
+        d[i] = real(1);
+      } else if (i < 3) {
+        d[i] = real(-0.3);
+      } else {
+        d[i] = real(0.2);
+      }
+    }
+    return d;
+  }  // end of getGradientIncrementDirection
+
+  BehaviourBenchmark::LoadingType BehaviourBenchmark::getLoadingType(
+      const std::string& l) {
+    if ((l == "elastic") || (l == "Elastic")) {
+      return LoadingType::ELASTIC;
+    } else if ((l == "plastic") || (l == "Plastic")) {
+      return LoadingType::PLASTIC;
+    } else if ((l == "large_increments") || (l == "LargeIncrements")) {
+      return LoadingType::LARGEINCREMENTS;
+    }
+    tfel::raise(
+        "BehaviourBenchmark::getLoadingType: "
+        "invalid loading type '" +
+        l + "'");
+  }  // end of getLoadingType
+
+  std::string BehaviourBenchmark::getLoadingTypeName(const LoadingType l) {
+    if (l == LoadingType::ELASTIC) {
+      return "elastic";
+    } else if (l == LoadingType::PLASTIC) {
+      return "plastic";
+    }
+    return "large_increments";
+  }  // end of getLoadingTypeName
+
+  StiffnessMatrixType BehaviourBenchmark::getStiffnessMatrixType(
+      const std::string& t) {
+    if (t == "NoStiffness") {
+      return StiffnessMatrixType::NOSTIFFNESS;
+    } else if (t == "Elastic") {
+      return StiffnessMatrixType::ELASTIC;
+    } else if (t == "SecantOperator") {
+      return StiffnessMatrixType::SECANTOPERATOR;
+    } else if (t == "TangentOperator") {
+      return StiffnessMatrixType::TANGENTOPERATOR;
+    } else if (t == "ConsistentTangentOperator") {
+      return StiffnessMatrixType::CONSISTENTTANGENTOPERATOR;
+    }
+    tfel::raise(
+        "BehaviourBenchmark::getStiffnessMatrixType: "
+        "invalid stiffness matrix type '" +
+        t + "'");
+  }  // end of getStiffnessMatrixType
+
+  std::string BehaviourBenchmark::getStiffnessMatrixTypeName(
+      const StiffnessMatrixType t) {
+    if (t == StiffnessMatrixType::NOSTIFFNESS) {
+      return "NoStiffness";
+    } else if (t == StiffnessMatrixType::ELASTIC) {
+      return "Elastic";
+    } else if (t == StiffnessMatrixType::SECANTOPERATOR) {
+      return "SecantOperator";
+    } else if (t == StiffnessMatrixType::TANGENTOPERATOR) {
+      return "TangentOperator";
+    } else if (t == StiffnessMatrixType::CONSISTENTTANGENTOPERATOR) {
+      return "ConsistentTangentOperator";
+    }
+    tfel::raise(
+        "BehaviourBenchmark::getStiffnessMatrixTypeName: "
+        "unsupported stiffness matrix type");
+  }  // end of getStiffnessMatrixTypeName
+
+  BehaviourBenchmark::BehaviourBenchmark(const std::string& i,
+                                         const std::string& l,
+                                         const std::string& f)
+      : interface(i), library(l), function(f) {
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    this->hypotheses = elm.getSupportedModellingHypotheses(l, f);
+  }  // end of BehaviourBenchmark
+
+  BehaviourBenchmark::BehaviourBenchmark(BehaviourBenchmark&&) = default;
+  BehaviourBenchmark::BehaviourBenchmark(const BehaviourBenchmark&) = default;
+  BehaviourBenchmark& BehaviourBenchmark::operator=(BehaviourBenchmark&&) =
+      default;
+  BehaviourBenchmark& BehaviourBenchmark::operator=(
+      const BehaviourBenchmark&) = default;
+
+  void BehaviourBenchmark::setMaterialProperty(const std::string& n,
+                                               const real v) {
+    this->material_properties[n] = v;
+  }  // end of setMaterialProperty
+
+  void BehaviourBenchmark::setExternalStateVariable(const std::string& n,
+                                                    const real v) {
+    this->external_state_variables[n] = v;
+  }  // end of setExternalStateVariable
+
+  void BehaviourBenchmark::setParameter(const std::string& n, const real v) {
+    this->parameters[n] = v;
+  }  // end of setParameter
+
+  void BehaviourBenchmark::setIntegerParameter(const std::string& n,
+                                               const int v) {
+    this->integer_parameters[n] = v;
+  }  // end of setIntegerParameter
+
+  void BehaviourBenchmark::setUnsignedIntegerParameter(
+      const std::string& n, const unsigned short v) {
+    this->unsigned_short_parameters[n] = v;
+  }  // end of setUnsignedIntegerParameter
+
+  void BehaviourBenchmark::setModellingHypotheses(
+      const std::vector<std::string>& h) {
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    const auto mh =
+        elm.getSupportedModellingHypotheses(this->library, this->function);
+    for (const auto& mhn : h) {
+      if (std::find(mh.begin(), mh.end(), mhn) == mh.end()) {
+        tfel::raise(
+            "BehaviourBenchmark::setModellingHypotheses: "
+            "modelling hypothesis '" +
+            mhn + "' is not supported by the behaviour");
+      }
+    }
+    this->hypotheses = h;
+  }  // end of setModellingHypotheses
+
+  void BehaviourBenchmark::setLoadings(const std::vector<LoadingType>& l) {
+    tfel::raise_if(l.empty(),
+                   "BehaviourBenchmark::setLoadings: "
+                   "empty list of loadings");
+    this->loadings = l;
+  }  // end of setLoadings
+
+  void BehaviourBenchmark::setStiffnessMatrixTypes(
+      const std::vector<StiffnessMatrixType>& k) {
+    tfel::raise_if(k.empty(),
+                   "BehaviourBenchmark::setStiffnessMatrixTypes: "
+                   "empty list of stiffness matrix types");
+    this->stiffness_matrix_types = k;
+  }  // end of setStiffnessMatrixTypes
+
+  void BehaviourBenchmark::setMaximumNumberOfThreads(const std::size_t n) {
+    tfel::raise_if(n == 0,
+                   "BehaviourBenchmark::setMaximumNumberOfThreads: "
+                   "invalid number of threads");
+    this->number_of_threads = n;
+  }  // end of setMaximumNumberOfThreads
+
+  void BehaviourBenchmark::setNumberOfMaterialPoints(const std::size_t n) {
+    tfel::raise_if(n == 0,
+                   "BehaviourBenchmark::setNumberOfMaterialPoints: "
+                   "invalid number of material points");
+    this->number_of_material_points = n;
+  }  // end of setNumberOfMaterialPoints
+
+  void BehaviourBenchmark::setNumberOfTimeSteps(const std::size_t n) {
+    tfel::raise_if(n == 0,
+                   "BehaviourBenchmark::setNumberOfTimeSteps: "
+                   "invalid number of time steps");
+    this->number_of_time_steps = n;
+  }  // end of setNumberOfTimeSteps
+
+  void BehaviourBenchmark::setTimeIncrement(const real v) {
+    tfel::raise_if(!(v > 0),
+                   "BehaviourBenchmark::setTimeIncrement: "
+                   "invalid time increment");
+    this->dt = v;
+  }  // end of setTimeIncrement
+
+  std::vector<BehaviourBenchmark::Result> BehaviourBenchmark::execute() const {
+    tfel::raise_if(this->hypotheses.empty(),
+                   "BehaviourBenchmark::execute: "
+                   "no modelling hypothesis defined");
+    auto threads = std::vector<std::size_t>{};
+    for (std::size_t n = 1; n < this->number_of_threads; n *= 2) {
+      threads.push_back(n);
+    }
+    threads.push_back(this->number_of_threads);
+    auto results = std::vector<Result>{};
+    for (const auto& h : this->hypotheses) {
+      for (const auto& l : this->loadings) {
+        for (const auto& k : this->stiffness_matrix_types) {
+          for (const auto& n : threads) {
+            results.push_back(this->run(h, l, k, n));
+          }
+        }
+      }
+    }
+    return results;
+  }  // end of execute
+
+  BehaviourBenchmark::Result BehaviourBenchmark::run(
+      const std::string& h,
+      const LoadingType l,
+      const StiffnessMatrixType k,
+      const std::size_t nthreads) const {
+    using ModellingHypothesis = tfel::material::ModellingHypothesis;
+    // a per-thread set of material points sharing the same workspace
+    struct MaterialPoints {
+      std::vector<CurrentState> states;
+      BehaviourWorkSpace wk;
+    };
+    auto b = Behaviour::getBehaviour(this->interface, this->library,
+                                     this->function, Behaviour::Parameters{},
+                                     ModellingHypothesis::fromString(h));
+    b->setOutOfBoundsPolicy(tfel::material::None);
+    for (const auto& p : this->parameters) {
+      b->setParameter(p.first, p.second);
+    }
+    for (const auto& p : this->integer_parameters) {
+      b->setIntegerParameter(p.first, p.second);
+    }
+    for (const auto& p : this->unsigned_short_parameters) {
+      b->setUnsignedIntegerParameter(p.first, p.second);
+    }
+    // material properties and external state variables
+    auto evm = EvolutionManager{};
+    for (const auto& mp : this->material_properties) {
+      evm.insert({mp.first, make_evolution(mp.second)});
+    }
+    for (const auto& ev : this->external_state_variables) {
+      evm.insert({ev.first, make_evolution(ev.second)});
+    }
+    if (evm.find("Temperature") == evm.end()) {
+      evm.insert({"Temperature", make_evolution(real(293.15))});
+    }
+    auto dmpv = EvolutionManager{};
+    b->setOptionalMaterialPropertiesDefaultValues(dmpv, evm);
+    const auto mpnames = b->getMaterialPropertiesNames();
+    const auto esvnames = b->expandExternalStateVariablesNames();
+    checkIfDeclared(mpnames, evm, dmpv, "material property");
+    checkIfDeclared(esvnames, evm, "external state variable");
+    // initial state shared by all material points
+    auto s0 = CurrentState{};
+    b->allocateCurrentState(s0);
+    b->getGradientsDefaultInitialValues(s0.e0);
+    s0.e1 = s0.e0;
+    for (unsigned short i = 0; i != 3; ++i) {
+      for (unsigned short j = 0; j != 3; ++j) {
+        s0.r(i, j) = (i == j) ? real(1) : real(0);
+      }
+    }
+    computeMaterialProperties(s0, evm, dmpv, mpnames, real(0), this->dt);
+    computeExternalStateVariables(s0, evm, esvnames, real(0), this->dt);
+    const auto de = getGradientIncrementAmplitude(l);
+    const auto d = getGradientIncrementDirection(*b);
+    // allocation of the per-thread data
+    auto points = std::vector<std::unique_ptr<MaterialPoints>>{};
+    for (std::size_t i = 0; i != nthreads; ++i) {
+      points.push_back(std::make_unique<MaterialPoints>());
+      auto& mps = *(points.back());
+      b->allocateWorkSpace(mps.wk);
+      mps.states.resize(this->number_of_material_points, s0);
+    }
+    // integration of the material points treated by one thread
+    auto integrate = [&b, &d, de, k, this](MaterialPoints& mps) {
+      auto nfailures = std::size_t{};
+      for (std::size_t step = 0; step != this->number_of_time_steps; ++step) {
+        for (std::size_t p = 0; p != mps.states.size(); ++p) {
+          auto& s = mps.states[p];
+          // slightly different loadings for each material point
+          const auto a = de * (1 + real(p % 10) / 10);
+          for (decltype(s.e1.size()) i = 0; i != s.e1.size(); ++i) {
+            s.e1[i] = s.e0[i] + a * d[i];
+          }
+          if (b->integrate(s, mps.wk, this->dt, k).first) {
+            mtest::update(s);
+            s.e0 = s.e1;
+          } else {
+            mtest::revert(s);
+            ++nfailures;
+          }
+        }
+      }
+      return nfailures;
+    };
+    auto r = Result{};
+    r.hypothesis = h;
+    r.loading = getLoadingTypeName(l);
+    r.stiffness_matrix_type = getStiffnessMatrixTypeName(k);
+    r.number_of_threads = nthreads;
+    r.number_of_integrations =
+        nthreads * this->number_of_material_points * this->number_of_time_steps;
+    tfel::system::ThreadPool pool(nthreads);
+    const auto start = std::chrono::steady_clock::now();
+    auto tasks = std::vector<
+        std::future<tfel::system::ThreadedTaskResult<std::size_t>>>{};
+    for (auto& mps : points) {
+      auto* const ptr = mps.get();
+      tasks.push_back(
+          pool.addTask([&integrate, ptr] { return integrate(*ptr); }));
+    }
+    for (auto& t : tasks) {
+      auto tr = t.get();
+      if (!tr) {
+        tr.rethrow();
+      }
+      r.number_of_failures += *tr;
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    r.elapsed_time = std::chrono::duration<double>(stop - start).count();
+    if (r.elapsed_time > 0) {
+      r.integrations_per_second =
+          static_cast<double>(r.number_of_integrations) / r.elapsed_time;
+    }
+    return r;
+  }  // end of run
+
+  void BehaviourBenchmark::writeJSON(std::ostream& os,
+                                     const std::vector<Result>& results) const {
+    auto quote = [](const std::string& s) {
+      auto r = std::string{"\""};
+      for (const auto c : s) {
+        if ((c == '"') || (c == '\\')) {
+          r += '\\';
+        }
+        r += c;
+      }
+      return r + "\"";
+    };
+    os << "{\n"
+       << "  \"tfel_version\": " << quote(::getTFELVersion()) << ",\n"
+       << "  \"interface\": " << quote(this->interface) << ",\n"
+       << "  \"library\": " << quote(this->library) << ",\n"
+       << "  \"behaviour\": " << quote(this->function) << ",\n"
+       << "  \"number_of_material_points_per_thread\": "
+       << this->number_of_material_points << ",\n"
+       << "  \"number_of_time_steps\": " << this->number_of_time_steps
+       << ",\n"
+       << "  \"time_increment\": " << this->dt << ",\n"
+       << "  \"results\": [";
+    for (decltype(results.size()) i = 0; i != results.size(); ++i) {
+      const auto& r = results[i];
+      os << (i == 0 ? "\n" : ",\n")  //
+         << "    {\"hypothesis\": " << quote(r.hypothesis) << ", "
+         << "\"loading\": " << quote(r.loading) << ", "
+         << "\"stiffness_matrix_type\": " << quote(r.stiffness_matrix_type)
+         << ", "
+         << "\"number_of_threads\": " << r.number_of_threads << ", "
+         << "\"number_of_integrations\": " << r.number_of_integrations << ", "
+         << "\"number_of_failures\": " << r.number_of_failures << ", "
+         << "\"elapsed_time\": " << r.elapsed_time << ", "
+         << "\"integrations_per_second\": " << r.integrations_per_second
+         << "}";
+    }
+    os << "\n  ]\n}\n";
+  }  // end of writeJSON
+
+  BehaviourBenchmark::~BehaviourBenchmark() = default;
+
+}  // end of namespace mtest
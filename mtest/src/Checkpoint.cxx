@@ -0,0 +1,254 @@
+/*!
+ * \file   mtest/src/Checkpoint.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include "TFEL/Raise.hxx"
+#include "MTest/CurrentState.hxx"
+#include "MTest/Checkpoint.hxx"
+
+namespace mtest {
+
+  //! \brief magic string at the beginning of checkpoint files
+  static constexpr const char* const MTest_checkpointMagicString =
+      "MTEST-CHECKPOINT";
+  //! \brief version of the checkpoint file format
+  static constexpr std::uint32_t MTest_checkpointFormatVersion = 1;
+
+  template <typename T>
+  static void MTest_writeRaw(std::ostream& os, const T& v) {
+    os.write(reinterpret_cast<const char*>(&v), sizeof(T));
+    tfel::raise_if(!os, "writeCheckpointData: write error");
+  }  // end of MTest_writeRaw
+
+  template <typename T>
+  static void MTest_readRaw(std::istream& is, T& v) {
+    is.read(reinterpret_cast<char*>(&v), sizeof(T));
+    tfel::raise_if(!is,
+                   "readCheckpointData: "
+                   "unexpected end of the checkpoint file");
+  }  // end of MTest_readRaw
+
+  static void MTest_readRealArray(std::istream& is,
+                                  real* const values,
+                                  const std::size_t n) {
+    is.read(reinterpret_cast<char*>(values),
+            static_cast<std::streamsize>(n * sizeof(real)));
+    tfel::raise_if(!is,
+                   "readCheckpointData: "
+                   "unexpected end of the checkpoint file");
+  }  // end of MTest_readRealArray
+
+  void writeCheckpointHeader(std::ostream& os, const real t) {
+    const auto magic = std::string{MTest_checkpointMagicString};
+    os.write(magic.data(), static_cast<std::streamsize>(magic.size()));
+    MTest_writeRaw(os, MTest_checkpointFormatVersion);
+    MTest_writeRaw(os, static_cast<std::uint32_t>(sizeof(real)));
+    MTest_writeRaw(os, static_cast<std::uint32_t>(sizeof(std::size_t)));
+    MTest_writeRaw(os, t);
+  }  // end of writeCheckpointHeader
+
+  real readCheckpointHeader(std::istream& is) {
+    const auto magic = std::string{MTest_checkpointMagicString};
+    auto m = std::string(magic.size(), '\0');
+    is.read(m.data(), static_cast<std::streamsize>(m.size()));
+    tfel::raise_if((!is) || (m != magic),
+                   "readCheckpointHeader: invalid checkpoint file");
+    auto version = std::uint32_t{};
+    auto real_size = std::uint32_t{};
+    auto size_type_size = std::uint32_t{};
+    MTest_readRaw(is, version);
+    MTest_readRaw(is, real_size);
+    MTest_readRaw(is, size_type_size);
+    tfel::raise_if(version != MTest_checkpointFormatVersion,
+                   "readCheckpointHeader: unsupported version of the "
+                   "checkpoint file format");
+    tfel::raise_if((real_size != sizeof(real)) ||
+                       (size_type_size != sizeof(std::size_t)),
+                   "readCheckpointHeader: the checkpoint file was written "
+                   "on an incompatible architecture");
+    auto t = real{};
+    MTest_readRaw(is, t);
+    return t;
+  }  // end of readCheckpointHeader
+
+  void writeCheckpointData(std::ostream& os, const bool b) {
+    MTest_writeRaw(os, static_cast<char>(b ? 1 : 0));
+  }  // end of writeCheckpointData
+
+  void writeCheckpointData(std::ostream& os, const std::size_t v) {
+    MTest_writeRaw(os, v);
+  }  // end of writeCheckpointData
+
+  void writeCheckpointData(std::ostream& os, const real v) {
+    MTest_writeRaw(os, v);
+  }  // end of writeCheckpointData
+
+  void writeCheckpointData(std::ostream& os, const std::string& v) {
+    writeCheckpointData(os, v.size());
+    os.write(v.data(), static_cast<std::streamsize>(v.size()));
+  }  // end of writeCheckpointData
+
+  void writeCheckpointData(std::ostream& os,
+                           const tfel::math::vector<real>& v) {
+    writeCheckpointData(os, static_cast<std::size_t>(v.size()));
+    os.write(reinterpret_cast<const char*>(v.data()),
+             static_cast<std::streamsize>(v.size() * sizeof(real)));
+  }  // end of writeCheckpointData
+
+  void writeCheckpointData(std::ostream& os,
+                           const tfel::math::matrix<real>& m) {
+    const auto nr = m.getNbRows();
+    const auto nc = m.getNbCols();
+    writeCheckpointData(os, static_cast<std::size_t>(nr));
+    writeCheckpointData(os, static_cast<std::size_t>(nc));
+    for (decltype(m.getNbRows()) i = 0; i != nr; ++i) {
+      for (decltype(m.getNbCols()) j = 0; j != nc; ++j) {
+        writeCheckpointData(os, m(i, j));
+      }
+    }
+  }  // end of writeCheckpointData
+
+  void writeCheckpointData(std::ostream& os,
+                           const tfel::math::tmatrix<3u, 3u, real>& m) {
+    for (unsigned short i = 0; i != 3; ++i) {
+      for (unsigned short j = 0; j != 3; ++j) {
+        writeCheckpointData(os, m(i, j));
+      }
+    }
+  }  // end of writeCheckpointData
+
+  void writeCheckpointData(std::ostream& os, const CurrentState& s) {
+    for (const auto* v : {&s.s_1, &s.s0, &s.s1, &s.e0, &s.e1, &s.e_th0,
+                          &s.e_th1, &s.mprops1, &s.iv_1, &s.iv0, &s.iv1,
+                          &s.esv0, &s.desv}) {
+      writeCheckpointData(os, *v);
+    }
+    for (const auto v : {s.se0, s.se1, s.de0, s.de1, s.position, s.Tref}) {
+      writeCheckpointData(os, v);
+    }
+    writeCheckpointData(os, s.isRmDefined);
+    writeCheckpointData(os, s.r);
+    writeCheckpointData(os, s.packaging_info.size());
+    for (const auto& [n, i] : s.packaging_info) {
+      writeCheckpointData(os, n);
+      if (i.is<tfel::math::vector<real>>()) {
+        writeCheckpointData(os, std::size_t{0});
+        writeCheckpointData(os, i.get<tfel::math::vector<real>>());
+      } else if (i.is<tfel::math::matrix<real>>()) {
+        writeCheckpointData(os, std::size_t{1});
+        writeCheckpointData(os, i.get<tfel::math::matrix<real>>());
+      } else {
+        tfel::raise(
+            "writeCheckpointData: "
+            "unsupported packaging information '" +
+            n + "'");
+      }
+    }
+  }  // end of writeCheckpointData
+
+  void readCheckpointData(std::istream& is, bool& b) {
+    auto c = char{};
+    MTest_readRaw(is, c);
+    b = c != 0;
+  }  // end of readCheckpointData
+
+  void readCheckpointData(std::istream& is, std::size_t& v) {
+    MTest_readRaw(is, v);
+  }  // end of readCheckpointData
+
+  void readCheckpointData(std::istream& is, real& v) {
+    MTest_readRaw(is, v);
+  }  // end of readCheckpointData
+
+  void readCheckpointData(std::istream& is, std::string& v) {
+    auto n = std::size_t{};
+    readCheckpointData(is, n);
+    v.resize(n);
+    is.read(v.data(), static_cast<std::streamsize>(n));
+    tfel::raise_if(!is,
+                   "readCheckpointData: "
+                   "unexpected end of the checkpoint file");
+  }  // end of readCheckpointData
+
+  void readCheckpointData(std::istream& is, tfel::math::vector<real>& v) {
+    auto n = std::size_t{};
+    readCheckpointData(is, n);
+    if (v.empty()) {
+      v.resize(n);
+    }
+    tfel::raise_if(v.size() != n,
+                   "readCheckpointData: the checkpoint file is not "
+                   "consistent with the current simulation (array of size " +
+                       std::to_string(n) + " read, expected an array of size " +
+                       std::to_string(v.size()) + ")");
+    MTest_readRealArray(is, v.data(), n);
+  }  // end of readCheckpointData
+
+  void readCheckpointData(std::istream& is, tfel::math::matrix<real>& m) {
+    auto nr = std::size_t{};
+    auto nc = std::size_t{};
+    readCheckpointData(is, nr);
+    readCheckpointData(is, nc);
+    m.resize(nr, nc);
+    for (std::size_t i = 0; i != nr; ++i) {
+      for (std::size_t j = 0; j != nc; ++j) {
+        readCheckpointData(is, m(i, j));
+      }
+    }
+  }  // end of readCheckpointData
+
+  void readCheckpointData(std::istream& is,
+                          tfel::math::tmatrix<3u, 3u, real>& m) {
+    for (unsigned short i = 0; i != 3; ++i) {
+      for (unsigned short j = 0; j != 3; ++j) {
+        readCheckpointData(is, m(i, j));
+      }
+    }
+  }  // end of readCheckpointData
+
+  void readCheckpointData(std::istream& is, CurrentState& s) {
+    for (auto* v : {&s.s_1, &s.s0, &s.s1, &s.e0, &s.e1, &s.e_th0, &s.e_th1,
+                    &s.mprops1, &s.iv_1, &s.iv0, &s.iv1, &s.esv0, &s.desv}) {
+      readCheckpointData(is, *v);
+    }
+    for (auto* v : {&s.se0, &s.se1, &s.de0, &s.de1, &s.position, &s.Tref}) {
+      readCheckpointData(is, *v);
+    }
+    readCheckpointData(is, s.isRmDefined);
+    readCheckpointData(is, s.r);
+    auto n = std::size_t{};
+    readCheckpointData(is, n);
+    s.packaging_info.clear();
+    for (std::size_t i = 0; i != n; ++i) {
+      auto name = std::string{};
+      auto type = std::size_t{};
+      readCheckpointData(is, name);
+      readCheckpointData(is, type);
+      if (type == 0) {
+        auto v = tfel::math::vector<real>{};
+        readCheckpointData(is, v);
+        s.packaging_info.insert({name, std::move(v)});
+      } else if (type == 1) {
+        auto m = tfel::math::matrix<real>{};
+        readCheckpointData(is, m);
+        s.packaging_info.insert({name, std::move(m)});
+      } else {
+        tfel::raise("readCheckpointData: invalid packaging information '" +
+                    name + "'");
+      }
+    }
+  }  // end of readCheckpointData
+
+}  // end of namespace mtest
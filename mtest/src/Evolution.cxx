@@ -12,6 +12,8 @@
  */
 
 #include <string>
+#include <iterator>
+#include <algorithm>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Math/Parser/ExternalFunctionManager.hxx"
@@ -49,13 +51,22 @@ namespace mtest {
                    "LPIEvolution::LPIEvolution : "
                    "the number of values of the times don't match "
                    "the number of values of the evolution");
+    // sorting the values. If a time is given twice, the first value
+    // is retained.
+    auto sorted_values = std::map<real, real>{};
     auto pt = t.begin();
     auto pv = v.begin();
     while (pt != t.end()) {
-      this->values.insert({*pt, *pv});
+      sorted_values.insert({*pt, *pv});
       ++pt;
       ++pv;
     }
+    this->times.reserve(sorted_values.size());
+    this->values.reserve(sorted_values.size());
+    for (const auto& [ti, vi] : sorted_values) {
+      this->times.push_back(ti);
+      this->values.push_back(vi);
+    }
   }
 
   void LPIEvolution::setValue(const real) {
@@ -66,11 +77,49 @@ namespace mtest {
   }
 
   void LPIEvolution::setValue(const real t, const real v) {
-    this->values[t] = v;
+    const auto p = std::lower_bound(this->times.begin(), this->times.end(), t);
+    const auto pos = p - this->times.begin();
+    if ((p != this->times.end()) && (!(t < *p))) {
+      this->values[pos] = v;
+      return;
+    }
+    this->times.insert(p, t);
+    this->values.insert(this->values.begin() + pos, v);
   }
 
   real LPIEvolution::operator()(const real t) const {
-    return LPIEvolution::interpolate(this->values, t);
+    tfel::raise_if(this->times.empty(),
+                   "LPIEvolution::operator(): "
+                   "no values specified");
+    const auto n = this->times.size();
+    if ((n == 1u) || (!(t > this->times.front()))) {
+      return this->values.front();
+    }
+    if (t > this->times.back()) {
+      return this->values.back();
+    }
+    // here, times[0] < t <= times[n-1]: looking for the index i such
+    // that times[i-1] < t <= times[i], starting from the last interval
+    // used
+    const auto is_in_interval = [this, t](const std::size_t i) {
+      return (this->times[i - 1] < t) && (!(t > this->times[i]));
+    };
+    auto i = this->cursor.load(std::memory_order_relaxed);
+    if ((i == 0) || (i >= n) || (!is_in_interval(i))) {
+      if ((i != 0) && (i + 1 < n) && (is_in_interval(i + 1))) {
+        ++i;
+      } else {
+        i = static_cast<std::size_t>(
+            std::lower_bound(this->times.begin(), this->times.end(), t) -
+            this->times.begin());
+      }
+      this->cursor.store(i, std::memory_order_relaxed);
+    }
+    const auto x0 = this->times[i - 1];
+    const auto y0 = this->values[i - 1];
+    const auto x1 = this->times[i];
+    const auto y1 = this->values[i];
+    return (y1 - y0) / (x1 - x0) * (t - x0) + y0;
   }  // end of operator()
 
   real LPIEvolution::interpolate(const std::map<real, real>& values,
@@ -97,7 +146,7 @@ namespace mtest {
   }  // end of interpolate
 
   bool LPIEvolution::isConstant() const {
-    return (this->values.size() == 1);
+    return (this->times.size() == 1);
   }  // end of LPIEvolution::isConstant
 
   LPIEvolution::~LPIEvolution() = default;
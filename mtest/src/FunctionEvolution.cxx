@@ -11,49 +11,79 @@
  * project under specific licensing conditions.
  */
 
+#include <cmath>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
+#include "TFEL/Math/General/IEEE754.hxx"
 #include "MTest/FunctionEvolution.hxx"
 
 namespace mtest {
 
   FunctionEvolution::FunctionEvolution(const std::string& f_,
                                        const EvolutionManager& evm_)
-      : evm(evm_),
-        f(f_, buildExternalFunctionManagerFromConstantEvolutions(evm_)) {
+      : evm(evm_) {
+    const auto efm = buildExternalFunctionManagerFromConstantEvolutions(evm_);
+    // the evaluator is built with an explicit list of variables, so
+    // that the position of each argument is known
+    this->args = tfel::math::Evaluator(f_, efm).getVariablesNames();
+    this->f = tfel::math::Evaluator(this->args, f_, efm);
+    this->arguments_values.resize(this->args.size());
   }  // end of FunctionEvolution::FunctionEvolution
 
-  real FunctionEvolution::operator()(const real t) const {
-    const auto& args = this->f.getVariablesNames();
-    std::vector<std::string>::size_type i;
-    for (i = 0; i != args.size(); ++i) {
-      if (args[i] == "t") {
-        this->f.setVariableValue("t", t);
+  void FunctionEvolution::resolveArguments() const {
+    if (this->resolved) {
+      return;
+    }
+    auto s = std::vector<const std::shared_ptr<Evolution>*>{};
+    s.reserve(this->args.size());
+    for (const auto& a : this->args) {
+      if (a == "t") {
+        s.push_back(nullptr);
       } else {
-        auto pev = evm.find(args[i]);
+        const auto pev = evm.find(a);
         tfel::raise_if(pev == evm.end(),
                        "FunctionEvolution::operator(): "
                        "can't evaluate argument '" +
-                           args[i] + "'");
-        const auto& ev = *(pev->second);
-        this->f.setVariableValue(args[i], ev(t));
+                           a + "'");
+        s.push_back(&(pev->second));
+      }
+    }
+    this->slots = std::move(s);
+    this->resolved = true;
+  }  // end of FunctionEvolution::resolveArguments
+
+  real FunctionEvolution::operator()(const real t) const {
+    using tfel::math::ieee754::fpclassify;
+    this->resolveArguments();
+    auto changed = !this->memoised;
+    for (std::vector<real>::size_type i = 0; i != this->slots.size(); ++i) {
+      const auto* const ev = this->slots[i];
+      const auto v = (ev == nullptr) ? t : (**ev)(t);
+      if (fpclassify(v - this->arguments_values[i]) != FP_ZERO) {
+        this->arguments_values[i] = v;
+        changed = true;
+      }
+    }
+    if (changed) {
+      for (std::vector<real>::size_type i = 0; i != this->slots.size(); ++i) {
+        this->f.setVariableValue(i, this->arguments_values[i]);
       }
+      this->value = this->f.getValue();
+      this->memoised = true;
     }
-    return this->f.getValue();
+    return this->value;
   }  // end of FunctionEvolution::operator()
 
   bool FunctionEvolution::isConstant() const {
-    const auto& args = this->f.getVariablesNames();
-    std::vector<std::string>::size_type i;
-    for (i = 0; i != args.size(); ++i) {
-      if (args[i] == "t") {
+    for (const auto& a : this->args) {
+      if (a == "t") {
         return false;
       } else {
-        auto pev = evm.find(args[i]);
+        auto pev = evm.find(a);
         tfel::raise_if(pev == evm.end(),
                        "FunctionEvolution::operator(): "
                        "can't evaluate argument '" +
-                           args[i] + "'");
+                           a + "'");
         const auto& ev = *(pev->second);
         if (!ev.isConstant()) {
           return false;
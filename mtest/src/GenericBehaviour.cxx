@@ -475,6 +475,7 @@ namespace mtest {
     std::fill(wk.D.begin(), wk.D.end(), 0.);
     mfront::gb::BehaviourData d;
     d.error_message = error_message;
+    d.statistics = nullptr;
     if (this->stype == 1u) {
       // orthotropic behaviour
       std::copy(s.e0.begin(), s.e0.end(), wk.e0.begin());
@@ -18,6 +18,8 @@
 #include <memory>
 #include <sstream>
 #include <cstdlib>
+#include <limits>
+#include <future>
 #include <iterator>
 #include <algorithm>
 #include <stdexcept>
@@ -32,6 +34,7 @@
 #include "TFEL/Math/tvector.hxx"
 #include "TFEL/Math/stensor.hxx"
 #include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/RoundingMode.hxx"
 #include "MTest/Behaviour.hxx"
@@ -94,6 +97,168 @@ namespace mtest {
     }
   }  // end of updateStiffnessAndResidual
 
+  //! \brief name of the structure holding the states of the material points
+  static const char* const MTest_MaterialPointsStructureName = "MaterialPoints";
+
+  /*!
+   * \brief check that the given matrix is a rotation matrix
+   * \param[in] m: calling method
+   * \param[in] r: matrix
+   */
+  static void MTest_checkRotationMatrix(
+      const std::string& m, const tfel::math::tmatrix<3u, 3u, real>& r) {
+    using namespace tfel::math;
+    constexpr auto eps = 100 * std::numeric_limits<real>::epsilon();
+    const tvector<3u, real> c0 = r.column_view<0>();
+    const tvector<3u, real> c1 = r.column_view<1>();
+    const tvector<3u, real> c2 = r.column_view<2>();
+    tfel::raise_if((std::abs(norm(c0) - real(1)) > eps) ||
+                       (std::abs(norm(c1) - real(1)) > eps) ||
+                       (std::abs(norm(c2) - real(1)) > eps),
+                   m + ": at least one column is not normalised");
+    tfel::raise_if((std::abs(c0 | c1) > eps) || (std::abs(c0 | c2) > eps) ||
+                       (std::abs(c1 | c2) > eps),
+                   m + ": at least two columns are not orthogonals");
+  }  // end of MTest_checkRotationMatrix
+
+  /*!
+   * \brief result of the treatment of a chunk of material points: the
+   * first member is the result of the integrations (status and time
+   * step scaling factor), the second member is the weighted sum of the
+   * stiffness matrices
+   */
+  using MTest_ChunkResult =
+      std::pair<std::pair<bool, real>, tfel::math::matrix<real>>;
+
+  /*!
+   * \brief split the material points in contiguous chunks and call the
+   * given function on each chunk, in parallel if a thread pool is
+   * given.
+   * \return the result of the integrations (status and time step
+   * scaling factor)
+   * \param[out] k: sum of the stiffness matrices returned by each chunk
+   * \param[in] p: thread pool (may be null)
+   * \param[in] n: number of material points
+   * \param[in] f: function called with the chunk index and the range
+   * of material points treated
+   */
+  template <typename Function>
+  static std::pair<bool, real> MTest_forEachChunk(
+      tfel::math::matrix<real>& k,
+      tfel::system::ThreadPool* const p,
+      const std::size_t n,
+      const Function& f) {
+    const auto nchunks =
+        (p == nullptr) ? std::size_t{1} : std::min(p->getNumberOfThreads(), n);
+    auto results = std::vector<MTest_ChunkResult>{};
+    if (nchunks == 1) {
+      results.push_back(f(0, 0, n));
+    } else {
+      using TaskResult = tfel::system::ThreadedTaskResult<MTest_ChunkResult>;
+      auto tasks = std::vector<std::future<TaskResult>>{};
+      for (std::size_t c = 0; c != nchunks; ++c) {
+        const auto b = c * n / nchunks;
+        const auto e = (c + 1) * n / nchunks;
+        tasks.push_back(p->addTask([&f, c, b, e] { return f(c, b, e); }));
+      }
+      // all the tasks must be finished before rethrowing any exception
+      for (auto& t : tasks) {
+        t.wait();
+      }
+      for (auto& t : tasks) {
+        auto r = t.get();
+        if (!r) {
+          r.rethrow();
+        }
+        results.push_back(std::move(*r));
+      }
+    }
+    auto r = std::pair<bool, real>{true, std::numeric_limits<real>::max()};
+    std::fill(k.begin(), k.end(), real(0));
+    for (const auto& cr : results) {
+      r.first = r.first && cr.first.first;
+      r.second = std::min(r.second, cr.first.second);
+      if (cr.second.size() == k.size()) {
+        std::transform(k.begin(), k.end(), cr.second.begin(), k.begin(),
+                       std::plus<real>());
+      }
+    }
+    return r;
+  }  // end of MTest_forEachChunk
+
+  /*!
+   * \brief display a matrix in the log stream, the given component
+   * being highlighted
+   * \param[in] m: matrix
+   * \param[in] mi: row of the highlighted component
+   * \param[in] mj: column of the highlighted component
+   */
+  static void MTest_displayMatrix(const tfel::math::matrix<real>& m,
+                                  const std::size_t mi,
+                                  const std::size_t mj) {
+    using tfel::utilities::TerminalColors;
+    auto& os = mfront::getLogStream();
+    for (std::size_t i = 0; i != m.getNbRows(); ++i) {
+      for (std::size_t j = 0; j != m.getNbCols();) {
+        if ((i == mi) && (j == mj)) {
+          os.write(TerminalColors::Red, sizeof(TerminalColors::Red));
+          os << m(i, j);
+          os.write(TerminalColors::Reset, sizeof(TerminalColors::Reset));
+        } else {
+          os << m(i, j);
+        }
+        if (++j != m.getNbCols()) {
+          os << " ";
+        }
+      }
+      os << "\n";
+    }
+  }  // end of MTest_displayMatrix
+
+  /*!
+   * \brief compare the tangent operator returned by the behaviour to
+   * the numerical tangent operator and report the differences
+   * \param[in] bwk: behaviour workspace
+   * \param[in] ok: true if the numerical tangent operator was computed
+   * \param[in] toeps: comparison criterion
+   * \param[in] pv: perturbation value
+   */
+  static void MTest_compareToNumericalTangentOperator(
+      const BehaviourWorkSpace& bwk,
+      const bool ok,
+      const real toeps,
+      const real pv) {
+    if (!ok) {
+      auto& log = mfront::getLogStream();
+      log << "Numerical evalution of tangent operator failed.\n\n";
+      return;
+    }
+    real merr(0);
+    std::size_t mi = 0;
+    std::size_t mj = 0;
+    for (std::size_t i = 0; i != bwk.nk.getNbRows(); ++i) {
+      for (std::size_t j = 0; j != bwk.nk.getNbCols(); ++j) {
+        const auto err = std::abs(bwk.k(i, j) - bwk.nk(i, j));
+        if (err > merr) {
+          merr = err;
+          mi = i;
+          mj = j;
+        }
+      }
+    }
+    if (merr > toeps) {
+      auto& log = mfront::getLogStream();
+      log << "Comparison to numerical jacobian failed "
+          << "(error : " << merr << " for (" << mi << "," << mj
+          << "), criterium " << toeps << ").\n"
+          << "Tangent operator returned by the behaviour : \n";
+      MTest_displayMatrix(bwk.k, mi, mj);
+      log << "Numerical tangent operator (perturbation value : " << pv
+          << ") : \n";
+      MTest_displayMatrix(bwk.nk, mi, mj);
+    }
+  }  // end of MTest_compareToNumericalTangentOperator
+
   MTest::UTest::~UTest() = default;
 
   MTest::MTest() : rm(real(0)) {}
@@ -146,8 +311,6 @@ namespace mtest {
 
   void MTest::setRotationMatrix(const tfel::math::tmatrix<3u, 3u, real>& r,
                                 const bool bo) {
-    using namespace tfel::math;
-    constexpr auto eps = 100 * std::numeric_limits<real>::epsilon();
     tfel::raise_if(this->b == nullptr,
                    "MTest::setRotationMatrix: "
                    "no behaviour defined");
@@ -159,22 +322,60 @@ namespace mtest {
                    "MTest::setRotationMatrix: "
                    "rotation matrix already defined");
     this->isRmDefined = true;
-    // checking that the given matrix is a rotation one
-    const tvector<3u, real> c0 = r.column_view<0>();
-    const tvector<3u, real> c1 = r.column_view<1>();
-    const tvector<3u, real> c2 = r.column_view<2>();
-    tfel::raise_if((std::abs(norm(c0) - real(1)) > eps) ||
-                       (std::abs(norm(c1) - real(1)) > eps) ||
-                       (std::abs(norm(c2) - real(1)) > eps),
-                   "MTest::setRotationMatrix: "
-                   "at least one column is not normalised");
-    tfel::raise_if((std::abs(c0 | c1) > eps) || (std::abs(c0 | c2) > eps) ||
-                       (std::abs(c1 | c2) > eps),
-                   "MTest::setRotationMatrix : "
-                   "at least two columns are not orthogonals");
+    MTest_checkRotationMatrix("MTest::setRotationMatrix", r);
     this->rm = r;
   }
 
+  void MTest::addMaterialPoint(const MaterialPoint& p) {
+    tfel::raise_if(this->initialisationFinished,
+                   "MTest::addMaterialPoint: "
+                   "material points can't be added after that "
+                   "the `completeInitialisation` method has been called");
+    tfel::raise_if(this->b == nullptr,
+                   "MTest::addMaterialPoint: "
+                   "no behaviour defined");
+    tfel::raise_if(!(p.weight > 0),
+                   "MTest::addMaterialPoint: "
+                   "invalid weight");
+    if (p.isRotationMatrixDefined) {
+      tfel::raise_if(this->b->getSymmetryType() != 1,
+                     "MTest::addMaterialPoint: "
+                     "rotation matrix may only be defined "
+                     "for orthotropic behaviours");
+      MTest_checkRotationMatrix("MTest::addMaterialPoint", p.r);
+    }
+    this->material_points.push_back(p);
+  }  // end of addMaterialPoint
+
+  std::size_t MTest::getNumberOfMaterialPoints() const {
+    return this->material_points.size();
+  }  // end of getNumberOfMaterialPoints
+
+  void MTest::setMaterialPointsOutputFile(const std::string& f) {
+    tfel::raise_if(!this->material_points_output.empty(),
+                   "MTest::setMaterialPointsOutputFile: "
+                   "output file already defined");
+    this->material_points_output = f;
+  }  // end of setMaterialPointsOutputFile
+
+  void MTest::setMaterialPointsPhasesOutputFile(const std::string& f) {
+    tfel::raise_if(!this->material_points_phases_output.empty(),
+                   "MTest::setMaterialPointsPhasesOutputFile: "
+                   "output file already defined");
+    this->material_points_phases_output = f;
+  }  // end of setMaterialPointsPhasesOutputFile
+
+  void MTest::setNumberOfThreads(const std::size_t n) {
+    tfel::raise_if(n == 0,
+                   "MTest::setNumberOfThreads: "
+                   "invalid number of threads");
+    tfel::raise_if(this->initialisationFinished,
+                   "MTest::setNumberOfThreads: "
+                   "the number of threads can't be changed after that "
+                   "the `completeInitialisation` method has been called");
+    this->number_of_threads = n;
+  }  // end of setNumberOfThreads
+
   void MTest::setDefaultModellingHypothesis() {
     using tfel::material::ModellingHypothesis;
     tfel::raise_if(this->b != nullptr,
@@ -294,11 +495,9 @@ namespace mtest {
     }
     SingleStructureScheme::completeInitialisation();
     // post-processing
-    unsigned short cnbr = 2;
-    const char* dvn;
-    const char* thn;
-    if (this->out) {
-      this->out << "# first column: time\n";
+    if (!this->output.empty()) {
+      const char* dvn;
+      const char* thn;
       if (this->b->getBehaviourType() ==
           MechanicalBehaviourBase::STANDARDSTRAINBASEDBEHAVIOUR) {
         dvn = "strain";
@@ -315,33 +514,45 @@ namespace mtest {
         dvn = "gradients";
         thn = "thermodynamic forces";
       }
+      auto descriptions = std::vector<std::string>{"first column: time"};
+      auto legends = std::vector<std::string>{"t"};
+      unsigned short cnbr = 2;
       const auto ndv = this->b->getGradientsSize();
       const auto gc = this->b->getGradientsComponents();
       const auto nth = this->b->getThermodynamicForcesSize();
       const auto thc = this->b->getThermodynamicForcesComponents();
       for (unsigned short i = 0; i != ndv; ++i) {
-        this->out << "# " << cnbr << " column: " << i + 1
-                  << "th component of the " << dvn << " (" << gc[i] << ")\n";
+        descriptions.push_back(std::to_string(cnbr) + " column: " +
+                               std::to_string(i + 1) + "th component of the " +
+                               dvn + " (" + gc[i] + ")");
+        legends.push_back(gc[i]);
         ++cnbr;
       }
       for (unsigned short i = 0; i != nth; ++i) {
-        this->out << "# " << cnbr << " column: " << i + 1
-                  << "th component of the " << thn << " (" << thc[i] << ")\n";
+        descriptions.push_back(std::to_string(cnbr) + " column: " +
+                               std::to_string(i + 1) + "th component of the " +
+                               thn + " (" + thc[i] + ")");
+        legends.push_back(thc[i]);
         ++cnbr;
       }
       const auto& ivdes = this->b->getInternalStateVariablesDescriptions();
+      const auto ivn = this->b->expandInternalStateVariablesNames();
       tfel::raise_if(ivdes.size() != this->b->getInternalStateVariablesSize(),
                      "MTest::completeInitialisation : internal error "
                      "(the number of descriptions given by "
                      "the mechanical behaviour don't match "
                      "the number of internal state variables)");
       for (std::vector<std::string>::size_type i = 0; i != ivdes.size(); ++i) {
-        this->out << "# " << cnbr << " column: " << ivdes[i] << '\n';
+        descriptions.push_back(std::to_string(cnbr) + " column: " + ivdes[i]);
+        legends.push_back(i < ivn.size() ? ivn[i] : ivdes[i]);
         ++cnbr;
       }
-      this->out << "# " << cnbr << " column: stored energy\n";
-      this->out << "# " << cnbr + 1 << " column: disspated energy\n";
-      ++cnbr;
+      descriptions.push_back(std::to_string(cnbr) + " column: stored energy");
+      descriptions.push_back(std::to_string(cnbr + 1) +
+                             " column: disspated energy");
+      legends.push_back("StoredEnergy");
+      legends.push_back("DissipatedEnergy");
+      this->writeOutputFileHeader(descriptions, legends);
     }
     // convergence criterion value for driving variables
     if (this->options.eeps < 0) {
@@ -373,6 +584,110 @@ namespace mtest {
                      "'ThermalExpansionReferenceTemperature' "
                      "must be a constant evolution");
     }
+    // thread pool used to integrate the behaviour on the material
+    // points or to compute the numerical tangent operator
+    if (this->number_of_threads > 1) {
+      this->thread_pool =
+          std::make_shared<tfel::system::ThreadPool>(this->number_of_threads);
+    }
+    // material points
+    if (!this->material_points.empty()) {
+      const auto& mpnames = this->b->getMaterialPropertiesNames();
+      auto wt = real(0);
+      for (const auto& mp : this->material_points) {
+        wt += mp.weight;
+      }
+      this->material_points_data.clear();
+      for (const auto& mp : this->material_points) {
+        auto mps = std::vector<std::pair<std::size_t, real>>{};
+        for (const auto& [n, v] : mp.material_properties) {
+          const auto pn = std::find(mpnames.begin(), mpnames.end(), n);
+          tfel::raise_if(pn == mpnames.end(),
+                         "MTest::completeInitialisation: "
+                         "no material property named '" +
+                             n + "'");
+          mps.push_back({static_cast<std::size_t>(pn - mpnames.begin()), v});
+        }
+        this->material_points_data.push_back({mp.weight / wt, std::move(mps)});
+      }
+      if (!this->material_points_output.empty()) {
+        this->material_points_out.open(this->material_points_output);
+        tfel::raise_if(!this->material_points_out,
+                       "MTest::completeInitialisation: "
+                       "can't open file '" +
+                           this->material_points_output + "'");
+        this->material_points_out.exceptions(std::ofstream::failbit |
+                                             std::ofstream::badbit);
+        if (this->oprec != -1) {
+          this->material_points_out.precision(
+              static_cast<std::streamsize>(this->oprec));
+        }
+        const auto nth = this->b->getThermodynamicForcesSize();
+        const auto niv = this->b->getInternalStateVariablesSize();
+        this->material_points_out
+            << "# first column: time\n"
+            << "# the following columns are, for each material point, the "
+            << nth << " components of the thermodynamic forces followed by the "
+            << niv << " internal state variables\n";
+      }
+      if (!this->material_points_phases_output.empty()) {
+        this->phases.clear();
+        for (std::size_t i = 0; i != this->material_points.size(); ++i) {
+          const auto& pn = this->material_points[i].phase;
+          tfel::raise_if(pn.empty(),
+                         "MTest::completeInitialisation: "
+                         "no phase defined for material point '" +
+                             std::to_string(i) + "'");
+          auto ph = std::find_if(
+              this->phases.begin(), this->phases.end(),
+              [&pn](const auto& v) { return v.first == pn; });
+          if (ph == this->phases.end()) {
+            this->phases.push_back({pn, {}});
+            ph = std::prev(this->phases.end());
+          }
+          ph->second.push_back({i, this->material_points_data[i].first});
+        }
+        for (auto& ph : this->phases) {
+          auto wp = real(0);
+          for (const auto& pw : ph.second) {
+            wp += pw.second;
+          }
+          for (auto& pw : ph.second) {
+            pw.second /= wp;
+          }
+        }
+        auto& out = this->material_points_phases_out;
+        out.open(this->material_points_phases_output);
+        tfel::raise_if(!out,
+                       "MTest::completeInitialisation: "
+                       "can't open file '" +
+                           this->material_points_phases_output + "'");
+        out.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+        if (this->oprec != -1) {
+          out.precision(static_cast<std::streamsize>(this->oprec));
+        }
+        const auto nth = this->b->getThermodynamicForcesSize();
+        const auto niv = this->b->getInternalStateVariablesSize();
+        out << "# first column: time\n"
+            << "# the following columns are, for each phase, the " << nth
+            << " components of the averaged thermodynamic forces followed "
+            << "by the " << niv << " averaged internal state variables\n"
+            << "# phases:";
+        for (const auto& ph : this->phases) {
+          out << " " << ph.first;
+        }
+        out << '\n';
+      }
+    } else {
+      tfel::raise_if(!this->material_points_output.empty(),
+                     "MTest::completeInitialisation: "
+                     "an output file for the material points has been "
+                     "defined but no material point has been declared");
+      tfel::raise_if(!this->material_points_phases_output.empty(),
+                     "MTest::completeInitialisation: "
+                     "an output file for the phases has been "
+                     "defined but no material point has been declared");
+    }
     // residual file
     if (this->residual) {
       this->residual << "#first  column: iteration number\n"
@@ -431,6 +746,24 @@ namespace mtest {
                "must be a constant evolution");
       cs.Tref = ev(0);
     }
+    // states of the material points
+    if (!this->material_points.empty()) {
+      auto& pss = s.getStructureCurrentState(MTest_MaterialPointsStructureName);
+      pss.setBehaviour(this->b);
+      pss.setModellingHypothesis(this->hypothesis);
+      pss.istates.resize(this->material_points.size());
+      for (std::size_t i = 0; i != this->material_points.size(); ++i) {
+        const auto& mp = this->material_points[i];
+        auto& ps = pss.istates[i];
+        this->b->allocateCurrentState(ps);
+        std::copy(this->s_t0.begin(), this->s_t0.end(), ps.s0.begin());
+        std::copy(this->iv_t0.begin(), this->iv_t0.end(), ps.iv_1.begin());
+        std::copy(this->iv_t0.begin(), this->iv_t0.end(), ps.iv0.begin());
+        ps.r = mp.isRotationMatrixDefined ? mp.r : this->rm;
+        ps.Tref = cs.Tref;
+      }
+      mtest::revert(pss);
+    }
   }  // end of initializeCurrentState
 
   void MTest::initializeWorkSpace(SolverWorkSpace& wk) const {
@@ -508,7 +841,8 @@ namespace mtest {
       this->initializeCurrentState(state);
       this->initializeWorkSpace(wk);
       // integrating over the loading path
-      auto pt = this->times.begin();
+      const auto i0 = this->restart(state);
+      auto pt = this->times.begin() + static_cast<std::ptrdiff_t>(i0);
       auto pt2 = pt + 1;
       this->printOutput(*pt, state, true);
       // real work begins here
@@ -516,19 +850,28 @@ namespace mtest {
         // allowing subdivisions of the time step
         this->execute(state, wk, *pt, *pt2);
         this->printOutput(*pt2, state, true);
+        const auto i = static_cast<std::vector<real>::size_type>(
+            pt2 - this->times.begin());
+        this->writeCheckpoint(state, i);
         ++pt;
         ++pt2;
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFile();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFile();
       report(nullptr, state, false);
       throw;
     }
-    this->out.flush();
+    this->flushOutputFile();
+    if (this->material_points_out.is_open()) {
+      this->material_points_out.flush();
+    }
+    if (this->material_points_phases_out.is_open()) {
+      this->material_points_phases_out.flush();
+    }
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
@@ -567,7 +910,28 @@ namespace mtest {
         s.e0[i] = state.u0[i];
       }
     }
-    return SingleStructureScheme::prepare(state, t, dt);
+    const auto r = SingleStructureScheme::prepare(state, t, dt);
+    if (this->material_points.empty()) {
+      return r;
+    }
+    // the material points share the gradients, the material properties
+    // and the external state variables of the aggregate, except for the
+    // material properties specific to each material point
+    const auto& s = scs.istates[0];
+    auto& pss =
+        state.getStructureCurrentState(MTest_MaterialPointsStructureName);
+    for (std::size_t i = 0; i != pss.istates.size(); ++i) {
+      auto& ps = pss.istates[i];
+      ps.e0 = s.e0;
+      ps.mprops1 = s.mprops1;
+      for (const auto& [pos, v] : this->material_points_data[i].second) {
+        ps.mprops1[pos] = v;
+      }
+      ps.esv0 = s.esv0;
+      ps.desv = s.desv;
+      this->computeThermalStrains(ps, t, dt);
+    }
+    return r;
   }  // end of prepare
 
   void MTest::makeLinearPrediction(StudyCurrentState& state,
@@ -580,6 +944,14 @@ namespace mtest {
       state.u1 = state.u0 + (state.u0 - state.u_1) * r;
       s.iv1 = s.iv0 + (s.iv0 - s.iv_1) * r;
       s.s1 = s.s0 + (s.s0 - s.s_1) * r;
+      if (!this->material_points.empty()) {
+        auto& pss =
+            state.getStructureCurrentState(MTest_MaterialPointsStructureName);
+        for (auto& ps : pss.istates) {
+          ps.iv1 = ps.iv0 + (ps.iv0 - ps.iv_1) * r;
+          ps.s1 = ps.s0 + (ps.s0 - ps.s_1) * r;
+        }
+      }
     }
   }  // end of makeLinearPrediction
 
@@ -596,7 +968,7 @@ namespace mtest {
     auto& bwk = scs.getBehaviourWorkSpace();
     tfel::raise_if(scs.istates.size() != 1u, "MTest::prepare: invalid state");
     auto& s = scs.istates[0];
-    auto res = this->b->computePredictionOperator(bwk, s, smt);
+    auto res = this->computePredictionOperator(state, s, bwk, smt);
     if (!res.first) {
       return res;
     }
@@ -642,26 +1014,6 @@ namespace mtest {
       const real dt,
       const StiffnessMatrixType mt) const {
     using namespace tfel::material;
-    auto display = [](const tfel::math::matrix<real>& m, const size_type mi,
-                      const size_type mj) {
-      using tfel::utilities::TerminalColors;
-      auto& os = mfront::getLogStream();
-      for (size_type i = 0; i != m.getNbRows(); ++i) {
-        for (size_type j = 0; j != m.getNbCols();) {
-          if ((i == mi) && (j == mj)) {
-            os.write(TerminalColors::Red, sizeof(TerminalColors::Red));
-            os << m(i, j);
-            os.write(TerminalColors::Reset, sizeof(TerminalColors::Reset));
-          } else {
-            os << m(i, j);
-          }
-          if (++j != m.getNbCols()) {
-            os << " ";
-          }
-        }
-        os << "\n";
-      }
-    };
     auto& scs = state.getStructureCurrentState("");
     auto& bwk = scs.getBehaviourWorkSpace();
     tfel::raise_if(scs.istates.size() != 1u, "MTest::prepare: invalid state");
@@ -673,7 +1025,7 @@ namespace mtest {
     }
     // behaviour integration
     setRoundingMode();
-    const auto rb = this->b->integrate(s, bwk, dt, mt);
+    const auto rb = this->integrateBehaviour(state, s, bwk, dt, mt);
     setRoundingMode();
     if (!rb.first) {
       if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
@@ -683,8 +1035,23 @@ namespace mtest {
       }
       return rb;
     }
-    if ((this->cto) && (mt == StiffnessMatrixType::CONSISTENTTANGENTOPERATOR)) {
+    if ((this->cto) && (mt == StiffnessMatrixType::CONSISTENTTANGENTOPERATOR) &&
+        (this->thread_pool != nullptr) && (this->material_points.empty())) {
+      const auto ok =
+          this->computeNumericalTangentOperatorInParallel(scs, s, bwk, dt, mt);
+      MTest_compareToNumericalTangentOperator(bwk, ok, this->toeps,
+                                              this->pv);
+    } else if ((this->cto) &&
+               (mt == StiffnessMatrixType::CONSISTENTTANGENTOPERATOR)) {
       bool ok = true;
+      // the states of the material points are modified by the
+      // perturbations and must be restored
+      auto pstates = tfel::math::vector<CurrentState>{};
+      if (!this->material_points.empty()) {
+        pstates =
+            state.getStructureCurrentState(MTest_MaterialPointsStructureName)
+                .istates;
+      }
       bwk.ne.swap(s.e1);
       bwk.ns.swap(s.s1);
       bwk.nivs.swap(s.iv1);
@@ -694,7 +1061,7 @@ namespace mtest {
         s.e1[i] += this->pv;
         try {
           setRoundingMode();
-          ok = this->b->integrate(s, bwk, dt, mt).first;
+          ok = this->integrateBehaviour(state, s, bwk, dt, mt).first;
           setRoundingMode();
         } catch (...) {
           ok = false;
@@ -710,7 +1077,7 @@ namespace mtest {
         s.e1[i] -= this->pv;
         try {
           setRoundingMode();
-          ok = this->b->integrate(s, bwk, dt, mt).first;
+          ok = this->integrateBehaviour(state, s, bwk, dt, mt).first;
           setRoundingMode();
         } catch (...) {
           ok = false;
@@ -726,35 +1093,12 @@ namespace mtest {
       bwk.ne.swap(s.e1);
       bwk.ns.swap(s.s1);
       bwk.nivs.swap(s.iv1);
-      if (ok) {
-        real merr(0);
-        size_type mi = 0;
-        size_type mj = 0;
-        for (size_type i = 0; i != nth; ++i) {
-          for (size_type j = 0; j != ndv; ++j) {
-            const auto err = std::abs(bwk.k(i, j) - bwk.nk(i, j));
-            if (err > merr) {
-              merr = err;
-              mi = i;
-              mj = j;
-            }
-          }
-        }
-        if (merr > this->toeps) {
-          auto& log = mfront::getLogStream();
-          log << "Comparison to numerical jacobian failed "
-              << "(error : " << merr << " for (" << mi << "," << mj
-              << "), criterium " << this->toeps << ").\n"
-              << "Tangent operator returned by the behaviour : \n";
-          display(bwk.k, mi, mj);
-          log << "Numerical tangent operator (perturbation value : " << this->pv
-              << ") : \n";
-          display(bwk.nk, mi, mj);
-        }
-      } else {
-        auto& log = mfront::getLogStream();
-        log << "Numerical evalution of tangent operator failed.\n\n";
+      if (!this->material_points.empty()) {
+        state.getStructureCurrentState(MTest_MaterialPointsStructureName)
+            .istates.swap(pstates);
       }
+      MTest_compareToNumericalTangentOperator(bwk, ok, this->toeps,
+                                              this->pv);
     }
     //! update the stiffness matrix and the residual
     std::fill(k.begin(), k.end(), real(0));
@@ -942,24 +1286,58 @@ namespace mtest {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
-    if (this->out) {
+    if (!this->output.empty()) {
       auto& cs = s.getStructureCurrentState("").istates[0];
       // number of components of the driving variables and the thermodynamic
       // forces
       const auto ndv = this->b->getGradientsSize();
       const auto nth = this->b->getThermodynamicForcesSize();
-      unsigned short i;
-      this->out << t << " ";
-      for (i = 0; i != ndv; ++i) {
-        this->out << s.u0[i] << " ";
+      auto row = std::vector<real>{};
+      row.reserve(ndv + nth + cs.iv0.size() + 3);
+      row.push_back(t);
+      row.insert(row.end(), s.u0.begin(), s.u0.begin() + ndv);
+      row.insert(row.end(), cs.s0.begin(), cs.s0.begin() + nth);
+      row.insert(row.end(), cs.iv0.begin(), cs.iv0.end());
+      // stored and dissipated energies
+      row.push_back(cs.se0);
+      row.push_back(cs.de0);
+      this->writeOutputFileRow(row);
+    }
+    if (this->material_points_out.is_open()) {
+      const auto& pss =
+          s.getStructureCurrentState(MTest_MaterialPointsStructureName);
+      this->material_points_out << t;
+      for (const auto& ps : pss.istates) {
+        for (const auto& v : ps.s0) {
+          this->material_points_out << " " << v;
+        }
+        for (const auto& v : ps.iv0) {
+          this->material_points_out << " " << v;
+        }
       }
-      for (i = 0; i != nth; ++i) {
-        this->out << cs.s0[i] << " ";
+      this->material_points_out << '\n';
+    }
+    if (this->material_points_phases_out.is_open()) {
+      const auto& pss =
+          s.getStructureCurrentState(MTest_MaterialPointsStructureName);
+      auto& out = this->material_points_phases_out;
+      out << t;
+      for (const auto& ph : this->phases) {
+        const auto& ps0 = pss.istates[ph.second.front().first];
+        auto sm = tfel::math::vector<real>(ps0.s0.size(), real(0));
+        auto ivm = tfel::math::vector<real>(ps0.iv0.size(), real(0));
+        for (const auto& [i, w] : ph.second) {
+          sm += w * pss.istates[i].s0;
+          ivm += w * pss.istates[i].iv0;
+        }
+        for (const auto& v : sm) {
+          out << " " << v;
+        }
+        for (const auto& v : ivm) {
+          out << " " << v;
+        }
       }
-      std::copy(cs.iv0.begin(), cs.iv0.end(),
-                std::ostream_iterator<real>(this->out, " "));
-      // stored and dissipated energies
-      this->out << cs.se0 << " " << cs.de0 << '\n';
+      out << '\n';
     }
   }  // end of printOutput
 
@@ -977,6 +1355,185 @@ namespace mtest {
             *(this->getBehaviour()), this->getEvolutions(), f, p));
   }  // end of addUserDefinedPostProcessing
 
+  bool MTest::doPackagingStep(StudyCurrentState& state) const {
+    if (!SingleStructureScheme::doPackagingStep(state)) {
+      return false;
+    }
+    if (this->material_points.empty()) {
+      return true;
+    }
+    auto& pss =
+        state.getStructureCurrentState(MTest_MaterialPointsStructureName);
+    auto& bwk = pss.getBehaviourWorkSpace();
+    for (auto& ps : pss.istates) {
+      if (!this->b->doPackagingStep(ps, bwk)) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of doPackagingStep
+
+  std::pair<bool, real> MTest::integrateBehaviour(
+      StudyCurrentState& state,
+      CurrentState& s,
+      BehaviourWorkSpace& bwk,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    if (this->material_points.empty()) {
+      return this->b->integrate(s, bwk, dt, mt);
+    }
+    auto& pss =
+        state.getStructureCurrentState(MTest_MaterialPointsStructureName);
+    const auto n = pss.istates.size();
+    const auto ndv = this->b->getGradientsSize();
+    // allocation of the workspaces before launching the threads
+    const auto nthreads = (this->thread_pool == nullptr)
+                              ? std::size_t{1}
+                              : this->thread_pool->getNumberOfThreads();
+    for (std::size_t i = 0; i != std::min(nthreads, n); ++i) {
+      static_cast<void>(pss.getBehaviourWorkSpace(i));
+    }
+    auto integrate = [this, &pss, &s, ndv, dt, mt](
+                         const std::size_t c, const std::size_t pb,
+                         const std::size_t pe) -> MTest_ChunkResult {
+      auto& wk = pss.getBehaviourWorkSpace(c);
+      auto k = tfel::math::matrix<real>(wk.k.getNbRows(), wk.k.getNbCols(),
+                                        real(0));
+      auto r = std::pair<bool, real>{true, std::numeric_limits<real>::max()};
+      setRoundingMode();
+      for (auto i = pb; i != pe; ++i) {
+        auto& ps = pss.istates[i];
+        std::copy(s.e1.begin(), s.e1.begin() + ndv, ps.e1.begin());
+        const auto ri = this->b->integrate(ps, wk, dt, mt);
+        r.second = std::min(r.second, ri.second);
+        if (!ri.first) {
+          r.first = false;
+          break;
+        }
+        const auto w = this->material_points_data[i].first;
+        std::transform(k.begin(), k.end(), wk.k.begin(), k.begin(),
+                       [w](const real v, const real dv) { return v + w * dv; });
+      }
+      setRoundingMode();
+      return {r, k};
+    };
+    const auto r =
+        MTest_forEachChunk(bwk.k, this->thread_pool.get(), n, integrate);
+    if (!r.first) {
+      return r;
+    }
+    // averaged thermodynamic forces, internal state variables and energies
+    std::fill(s.s1.begin(), s.s1.end(), real(0));
+    std::fill(s.iv1.begin(), s.iv1.end(), real(0));
+    s.se1 = real(0);
+    s.de1 = real(0);
+    for (std::size_t i = 0; i != n; ++i) {
+      const auto& ps = pss.istates[i];
+      const auto w = this->material_points_data[i].first;
+      s.s1 += w * ps.s1;
+      s.iv1 += w * ps.iv1;
+      s.se1 += w * ps.se1;
+      s.de1 += w * ps.de1;
+    }
+    return r;
+  }  // end of integrateBehaviour
+
+  std::pair<bool, real> MTest::computePredictionOperator(
+      StudyCurrentState& state,
+      const CurrentState& s,
+      BehaviourWorkSpace& bwk,
+      const StiffnessMatrixType mt) const {
+    if (this->material_points.empty()) {
+      return this->b->computePredictionOperator(bwk, s, mt);
+    }
+    auto& pss =
+        state.getStructureCurrentState(MTest_MaterialPointsStructureName);
+    const auto n = pss.istates.size();
+    const auto nthreads = (this->thread_pool == nullptr)
+                              ? std::size_t{1}
+                              : this->thread_pool->getNumberOfThreads();
+    for (std::size_t i = 0; i != std::min(nthreads, n); ++i) {
+      static_cast<void>(pss.getBehaviourWorkSpace(i));
+    }
+    auto compute = [this, &pss, mt](const std::size_t c, const std::size_t pb,
+                                    const std::size_t pe) -> MTest_ChunkResult {
+      auto& wk = pss.getBehaviourWorkSpace(c);
+      auto k = tfel::math::matrix<real>(wk.kt.getNbRows(), wk.kt.getNbCols(),
+                                        real(0));
+      auto r = std::pair<bool, real>{true, std::numeric_limits<real>::max()};
+      for (auto i = pb; i != pe; ++i) {
+        const auto ri =
+            this->b->computePredictionOperator(wk, pss.istates[i], mt);
+        r.second = std::min(r.second, ri.second);
+        if (!ri.first) {
+          r.first = false;
+          break;
+        }
+        const auto w = this->material_points_data[i].first;
+        std::transform(k.begin(), k.end(), wk.kt.begin(), k.begin(),
+                       [w](const real v, const real dv) { return v + w * dv; });
+      }
+      return {r, k};
+    };
+    return MTest_forEachChunk(bwk.kt, this->thread_pool.get(), n, compute);
+  }  // end of computePredictionOperator
+
+  bool MTest::computeNumericalTangentOperatorInParallel(
+      StructureCurrentState& scs,
+      const CurrentState& s,
+      BehaviourWorkSpace& bwk,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    const auto ndv = this->b->getGradientsSize();
+    const auto nth = this->b->getThermodynamicForcesSize();
+    // two perturbations per component of the gradients
+    const auto n = std::size_t{2} * ndv;
+    const auto nthreads =
+        std::min(this->thread_pool->getNumberOfThreads(), n);
+    // private workspaces, allocated before launching the threads. The
+    // first workspace is the one of the main integration.
+    for (std::size_t i = 0; i != nthreads; ++i) {
+      static_cast<void>(scs.getBehaviourWorkSpace(i + 1));
+    }
+    // state at the beginning of the time step with the gradients at
+    // the end of the time step
+    auto s0 = s;
+    revert(s0);
+    std::copy(s.e1.begin(), s.e1.end(), s0.e1.begin());
+    // each chunk returns the contributions of its perturbations to the
+    // numerical tangent operator
+    auto perturb = [this, &scs, &s0, ndv, nth, dt, mt](
+                       const std::size_t c, const std::size_t pb,
+                       const std::size_t pe) -> MTest_ChunkResult {
+      auto& wk = scs.getBehaviourWorkSpace(c + 1);
+      auto nk = tfel::math::matrix<real>(nth, ndv, real(0));
+      auto r = std::pair<bool, real>{true, std::numeric_limits<real>::max()};
+      auto ps = s0;
+      setRoundingMode();
+      for (auto p = pb; p != pe; ++p) {
+        const auto i = p / 2;
+        const auto sign = (p % 2 == 0) ? real(1) : real(-1);
+        ps = s0;
+        ps.e1[i] += sign * (this->pv);
+        try {
+          r.first = this->b->integrate(ps, wk, dt, mt).first;
+        } catch (...) {
+          r.first = false;
+        }
+        if (!r.first) {
+          break;
+        }
+        for (std::size_t j = 0; j != nth; ++j) {
+          nk(j, i) += sign * ps.s1(j) / (2 * (this->pv));
+        }
+      }
+      setRoundingMode();
+      return {r, nk};
+    };
+    return MTest_forEachChunk(bwk.nk, this->thread_pool.get(), n, perturb)
+        .first;
+  }  // end of computeNumericalTangentOperatorInParallel
+
   MTest::~MTest() = default;
 
 }  // end namespace mtest
@@ -0,0 +1,362 @@
+/*!
+ * \file   mtest/src/MTestBenchmarkMain.cxx
+ * \brief  This file implements the `mtest-bench` executable which
+ * measures the throughput of the integration of a behaviour.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/StringAlgorithms.hxx"
+#include "TFEL/Utilities/ArgumentParserBase.hxx"
+#include "MTest/BehaviourBenchmark.hxx"
+
+namespace mtest {
+
+  struct MTestBenchmarkMain
+      : tfel::utilities::ArgumentParserBase<MTestBenchmarkMain> {
+    MTestBenchmarkMain(const int, const char* const* const);
+    /*!
+     * \brief main entry point
+     * \return EXIT_SUCESS on success
+     */
+    int execute();
+    //! destructor
+    ~MTestBenchmarkMain() override;
+
+   protected:
+    friend struct tfel::utilities::ArgumentParserBase<MTestBenchmarkMain>;
+    std::string getVersionDescription() const override;
+    std::string getUsageDescription() const override;
+    void registerArgumentCallBacks();
+    /*!
+     * \return the current option, checking that it is not empty
+     * \param[in] n: name of the command line argument
+     */
+    const std::string& getCurrentOption(const std::string&) const;
+    /*!
+     * \return the current option splitted as a pair name/value
+     * \param[in] n: name of the command line argument
+     */
+    std::pair<std::string, std::string> getNameValueOption(
+        const std::string&) const;
+    //! \brief interface
+    std::string interface = "generic";
+    //! \brief library
+    std::string library;
+    //! \brief behaviour
+    std::string behaviour;
+    //! \brief output file
+    std::string output;
+    //! \brief material properties
+    std::vector<std::pair<std::string, real>> material_properties;
+    //! \brief external state variables
+    std::vector<std::pair<std::string, real>> external_state_variables;
+    //! \brief parameters
+    std::vector<std::pair<std::string, real>> parameters;
+    //! \brief integer parameters
+    std::vector<std::pair<std::string, int>> integer_parameters;
+    //! \brief unsigned short parameters
+    std::vector<std::pair<std::string, unsigned short>>
+        unsigned_short_parameters;
+    //! \brief modelling hypotheses
+    std::vector<std::string> hypotheses;
+    //! \brief loadings
+    std::vector<BehaviourBenchmark::LoadingType> loadings;
+    //! \brief stiffness matrix types
+    std::vector<StiffnessMatrixType> stiffness_matrix_types;
+    //! \brief maximum number of threads
+    std::size_t number_of_threads = 1;
+    //! \brief number of material points per thread
+    std::size_t number_of_material_points = 0;
+    //! \brief number of time steps
+    std::size_t number_of_time_steps = 0;
+    //! \brief time increment
+    real dt = 0;
+  };  // end of struct MTestBenchmarkMain
+
+  MTestBenchmarkMain::MTestBenchmarkMain(const int argc,
+                                         const char* const* const argv)
+      : tfel::utilities::ArgumentParserBase<MTestBenchmarkMain>(argc, argv) {
+    this->registerArgumentCallBacks();
+    this->parseArguments();
+    tfel::raise_if(this->library.empty(),
+                   "MTestBenchmarkMain::MTestBenchmarkMain: "
+                   "no library defined");
+    tfel::raise_if(this->behaviour.empty(),
+                   "MTestBenchmarkMain::MTestBenchmarkMain: "
+                   "no behaviour defined");
+  }  // end of MTestBenchmarkMain
+
+  const std::string& MTestBenchmarkMain::getCurrentOption(
+      const std::string& n) const {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(),
+                   "MTestBenchmarkMain::getCurrentOption: "
+                   "no option given to the '" +
+                       n + "' command line argument");
+    return o;
+  }  // end of getCurrentOption
+
+  std::pair<std::string, std::string> MTestBenchmarkMain::getNameValueOption(
+      const std::string& n) const {
+    const auto& o = this->getCurrentOption(n);
+    const auto pos = o.find('=');
+    tfel::raise_if((pos == std::string::npos) || (pos == 0) ||
+                       (pos + 1 == o.size()),
+                   "MTestBenchmarkMain::getNameValueOption: "
+                   "invalid option '" +
+                       o + "' given to the '" + n +
+                       "' command line argument (expected "
+                       "'name=value')");
+    return {o.substr(0, pos), o.substr(pos + 1)};
+  }  // end of getNameValueOption
+
+  void MTestBenchmarkMain::registerArgumentCallBacks() {
+    using tfel::utilities::convert;
+    using tfel::utilities::tokenize;
+    this->registerCallBack(
+        "--interface", "-i",
+        CallBack("set the interface of the behaviour (default: generic)",
+                 [this] {
+                   this->interface = this->getCurrentOption("--interface");
+                 },
+                 true));
+    this->registerCallBack(
+        "--library", "-l",
+        CallBack("set the library",
+                 [this] {
+                   this->library = this->getCurrentOption("--library");
+                 },
+                 true));
+    this->registerCallBack(
+        "--behaviour", "-b",
+        CallBack("set the behaviour",
+                 [this] {
+                   this->behaviour = this->getCurrentOption("--behaviour");
+                 },
+                 true));
+    this->registerCallBack(
+        "--material-property",
+        CallBack("set the value of a material property (name=value)",
+                 [this] {
+                   const auto [n, v] =
+                       this->getNameValueOption("--material-property");
+                   this->material_properties.push_back({n, convert<real>(v)});
+                 },
+                 true));
+    this->registerCallBack(
+        "--external-state-variable",
+        CallBack("set the value of an external state variable (name=value). "
+                 "By default, the temperature is set to 293.15",
+                 [this] {
+                   const auto [n, v] =
+                       this->getNameValueOption("--external-state-variable");
+                   this->external_state_variables.push_back(
+                       {n, convert<real>(v)});
+                 },
+                 true));
+    this->registerCallBack(
+        "--parameter",
+        CallBack("set the value of a parameter (name=value)",
+                 [this] {
+                   const auto [n, v] = this->getNameValueOption("--parameter");
+                   this->parameters.push_back({n, convert<real>(v)});
+                 },
+                 true));
+    this->registerCallBack(
+        "--integer-parameter",
+        CallBack("set the value of an integer parameter (name=value)",
+                 [this] {
+                   const auto [n, v] =
+                       this->getNameValueOption("--integer-parameter");
+                   this->integer_parameters.push_back({n, std::stoi(v)});
+                 },
+                 true));
+    this->registerCallBack(
+        "--unsigned-short-parameter",
+        CallBack(
+            "set the value of an unsigned short parameter (name=value)",
+            [this] {
+              const auto [n, v] =
+                  this->getNameValueOption("--unsigned-short-parameter");
+              this->unsigned_short_parameters.push_back(
+                  {n, static_cast<unsigned short>(std::stoul(v))});
+            },
+            true));
+    this->registerCallBack(
+        "--modelling-hypotheses",
+        CallBack("comma separated list of modelling hypotheses to be tested "
+                 "(default: all the modelling hypotheses supported by the "
+                 "behaviour)",
+                 [this] {
+                   this->hypotheses = tokenize(
+                       this->getCurrentOption("--modelling-hypotheses"), ',');
+                 },
+                 true));
+    this->registerCallBack(
+        "--loadings",
+        CallBack("comma separated list of loadings to be tested. Valid "
+                 "loadings are 'elastic', 'plastic' and 'large_increments' "
+                 "(default: all)",
+                 [this] {
+                   this->loadings.clear();
+                   for (const auto& l :
+                        tokenize(this->getCurrentOption("--loadings"), ',')) {
+                     this->loadings.push_back(
+                         BehaviourBenchmark::getLoadingType(l));
+                   }
+                 },
+                 true));
+    this->registerCallBack(
+        "--stiffness-matrix-types",
+        CallBack("comma separated list of stiffness matrix types to be "
+                 "tested. Valid types are 'NoStiffness', 'Elastic', "
+                 "'SecantOperator', 'TangentOperator' and "
+                 "'ConsistentTangentOperator' "
+                 "(default: ConsistentTangentOperator)",
+                 [this] {
+                   this->stiffness_matrix_types.clear();
+                   const auto& o =
+                       this->getCurrentOption("--stiffness-matrix-types");
+                   for (const auto& t : tokenize(o, ',')) {
+                     this->stiffness_matrix_types.push_back(
+                         BehaviourBenchmark::getStiffnessMatrixType(t));
+                   }
+                 },
+                 true));
+    this->registerCallBack(
+        "--threads", "-j",
+        CallBack("set the maximum number of threads. The benchmarks are run "
+                 "with 1, 2, 4, ... threads up to the given number",
+                 [this] {
+                   this->number_of_threads =
+                       std::stoul(this->getCurrentOption("--threads"));
+                 },
+                 true));
+    this->registerCallBack(
+        "--material-points",
+        CallBack("set the number of material points treated by each thread "
+                 "(default: 1000)",
+                 [this] {
+                   this->number_of_material_points =
+                       std::stoul(this->getCurrentOption("--material-points"));
+                 },
+                 true));
+    this->registerCallBack(
+        "--time-steps",
+        CallBack("set the number of time steps (default: 20)",
+                 [this] {
+                   this->number_of_time_steps =
+                       std::stoul(this->getCurrentOption("--time-steps"));
+                 },
+                 true));
+    this->registerCallBack(
+        "--time-increment",
+        CallBack("set the time increment (default: 1)",
+                 [this] {
+                   const auto& o = this->getCurrentOption("--time-increment");
+                   this->dt = convert<real>(o);
+                   tfel::raise_if(!(this->dt > 0),
+                                  "MTestBenchmarkMain::"
+                                  "registerArgumentCallBacks: "
+                                  "invalid time increment '" +
+                                      o + "' (must be strictly positive)");
+                 },
+                 true));
+    this->registerCallBack(
+        "--output", "-o",
+        CallBack("set the output file. By default, results are written on "
+                 "the standard output",
+                 [this] { this->output = this->getCurrentOption("--output"); },
+                 true));
+  }  // end of registerArgumentCallBacks
+
+  std::string MTestBenchmarkMain::getVersionDescription() const {
+    return "mtest-bench measures the throughput of the integration of a "
+           "behaviour";
+  }  // end of getVersionDescription
+
+  std::string MTestBenchmarkMain::getUsageDescription() const {
+    return "Usage : mtest-bench [options] --library=<library> "
+           "--behaviour=<behaviour>";
+  }  // end of getUsageDescription
+
+  int MTestBenchmarkMain::execute() {
+    auto b = BehaviourBenchmark(this->interface, this->library,
+                                this->behaviour);
+    for (const auto& [n, v] : this->material_properties) {
+      b.setMaterialProperty(n, v);
+    }
+    for (const auto& [n, v] : this->external_state_variables) {
+      b.setExternalStateVariable(n, v);
+    }
+    for (const auto& [n, v] : this->parameters) {
+      b.setParameter(n, v);
+    }
+    for (const auto& [n, v] : this->integer_parameters) {
+      b.setIntegerParameter(n, v);
+    }
+    for (const auto& [n, v] : this->unsigned_short_parameters) {
+      b.setUnsignedIntegerParameter(n, v);
+    }
+    if (!this->hypotheses.empty()) {
+      b.setModellingHypotheses(this->hypotheses);
+    }
+    if (!this->loadings.empty()) {
+      b.setLoadings(this->loadings);
+    }
+    if (!this->stiffness_matrix_types.empty()) {
+      b.setStiffnessMatrixTypes(this->stiffness_matrix_types);
+    }
+    b.setMaximumNumberOfThreads(this->number_of_threads);
+    if (this->number_of_material_points != 0) {
+      b.setNumberOfMaterialPoints(this->number_of_material_points);
+    }
+    if (this->number_of_time_steps != 0) {
+      b.setNumberOfTimeSteps(this->number_of_time_steps);
+    }
+    if (this->dt > 0) {
+      b.setTimeIncrement(this->dt);
+    }
+    const auto results = b.execute();
+    if (this->output.empty()) {
+      b.writeJSON(std::cout, results);
+    } else {
+      std::ofstream out(this->output);
+      tfel::raise_if(!out,
+                     "MTestBenchmarkMain::execute: "
+                     "can't open file '" +
+                         this->output + "'");
+      out.exceptions(std::ios::badbit | std::ios::failbit);
+      b.writeJSON(out, results);
+    }
+    return EXIT_SUCCESS;
+  }  // end of execute
+
+  MTestBenchmarkMain::~MTestBenchmarkMain() = default;
+
+}  // end of namespace mtest
+
+int main(const int argc, const char* const* const argv) {
+  try {
+    mtest::MTestBenchmarkMain m(argc, argv);
+    return m.execute();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}  // end of main
@@ -0,0 +1,41 @@
+/*!
+ * \file   mtest/src/MTestBinaryToTextMain.cxx
+ * \brief  This file implements the `mtest-bin2txt` executable which
+ * converts the results written in the binary format by `mtest` and
+ * `ptest` to the text format.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Utilities/BinaryData.hxx"
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if ((argc != 2) && (argc != 3)) {
+    std::cerr << "Usage: " << argv[0] << " input [output]\n"
+              << "Convert a result file written in the binary format to the "
+                 "text format.\n"
+              << "If the output file is not given, the extension '.txt' is "
+                 "appended to the name of the input file.\n";
+    return EXIT_FAILURE;
+  }
+  const auto i = std::string{argv[1]};
+  const auto o = (argc == 3) ? std::string{argv[2]} : i + ".txt";
+  try {
+    tfel::utilities::convertBinaryDataFileToText(i, o);
+  } catch (std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}  // end of main
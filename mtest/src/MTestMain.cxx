@@ -78,6 +78,8 @@ namespace mtest {
     void treatXMLOutput();
     void treatResultFileOutput();
     void treatResidualFileOutput();
+    //! \brief treat the `--restart` option
+    void treatRestart();
     [[noreturn]] void treatHelpCommandsList();
     [[noreturn]] void treatHelpCommands();
     [[noreturn]] void treatHelpCommand();
@@ -136,6 +138,8 @@ namespace mtest {
     bool result_file_output = true;
     // generate residual file
     bool residual_file_output = false;
+    //! \brief checkpoint file used to restart the computation
+    std::string restart_file;
   };
 
   MTestMain::MTestMain(const int argc, const char* const* const argv)
@@ -160,6 +164,10 @@ namespace mtest {
     this->registerNewCallBack("--residual-file-output",
                               &MTestMain::treatResidualFileOutput,
                               "control residual output (default no)", true);
+    this->registerNewCallBack("--restart", &MTestMain::treatRestart,
+                              "restart the computation from a checkpoint "
+                              "file (see the @Checkpoint keyword)",
+                              true);
     this->registerNewCallBack(
         "--help-keywords", &MTestMain::treatHelpCommands,
         "display the help of all available commands and exit.");
@@ -388,6 +396,16 @@ namespace mtest {
     }
   }  // end of MTestMain::treatResidualFileOutput
 
+  void MTestMain::treatRestart() {
+    tfel::raise_if(!this->restart_file.empty(),
+                   "MTestMain::treatRestart: "
+                   "restart file already specified");
+    this->restart_file = this->currentArgument->getOption();
+    tfel::raise_if(this->restart_file.empty(),
+                   "MTestMain::treatRestart: "
+                   "no restart file specified");
+  }  // end of MTestMain::treatRestart
+
   void MTestMain::treatHelpCommandsList() {
     if ((this->scheme == MTEST) || (this->scheme == DEFAULT)) {
       MTestParser().displayKeyWordsList();
@@ -698,6 +716,12 @@ namespace mtest {
         t->setResidualFileName(n + "-residual.res");
       }
     }
+    if (!this->restart_file.empty()) {
+      tfel::raise_if(this->inputs.size() != 1,
+                     "MTestMain::addTest: restarting a computation is only "
+                     "allowed when a single input file is given");
+      t->setRestartFileName(this->restart_file);
+    }
     tm.addTest("MTest/" + n, t);
     if (this->xml_output) {
       std::shared_ptr<tfel::tests::TestOutput> o;
@@ -44,6 +44,8 @@
 #include "TFEL/Math/General/IEEE754.hxx"
 #include "TFEL/Utilities/TerminalColors.hxx"
 #include "TFEL/Utilities/GenTypeBase.hxx"
+#include "TFEL/Utilities/Data.hxx"
+#include "TFEL/Utilities/TextData.hxx"
 #include "MFront/MFrontLogStream.hxx"
 
 #include "MTest/AnalyticalTest.hxx"
@@ -58,6 +60,33 @@
 
 namespace mtest {
 
+  /*!
+   * \return the rotation matrix associated with the given Euler angles
+   * \param[in] psi: first angle
+   * \param[in] the: second angle
+   * \param[in] phi: third angle
+   */
+  static tfel::math::tmatrix<3u, 3u, real> MTestParser_fromEuler(
+      const real psi, const real the, const real phi) {
+    const real cospsi = std::cos(psi);
+    const real costhe = std::cos(the);
+    const real cosphi = std::cos(phi);
+    const real sinpsi = std::sin(psi);
+    const real sinthe = std::sin(the);
+    const real sinphi = std::sin(phi);
+    auto r = tfel::math::tmatrix<3u, 3u, real>{};
+    r(0, 0) = cosphi * cospsi - sinphi * costhe * sinpsi;
+    r(0, 1) = cosphi * sinpsi + sinphi * costhe * cospsi;
+    r(0, 2) = sinphi * sinthe;
+    r(1, 0) = -sinphi * cospsi - cosphi * costhe * sinpsi;
+    r(1, 1) = -sinphi * sinpsi + cosphi * costhe * cospsi;
+    r(1, 2) = cosphi * sinthe;
+    r(2, 0) = sinthe * sinpsi;
+    r(2, 1) = -sinthe * cospsi;
+    r(2, 2) = costhe;
+    return r;
+  }  // end of MTestParser_fromEuler
+
   MTestParser::MTestParser() { this->registerCallBacks(); }
 
   void MTestParser::parseString(MTest& t, const std::string& f) {
@@ -83,6 +112,15 @@ namespace mtest {
         if (((p->second.front() == '\'') && (p->second.back() == '\'')) ||
             ((p->second.front() == '"') && (p->second.back() == '"'))) {
           token.flag = tfel::utilities::Token::String;
+        } else {
+          // numerical values must be flagged as such to be read by
+          // `readDouble`, `readInt`, etc.
+          auto is = std::istringstream{p->second};
+          auto v = double{};
+          is >> v;
+          if ((!is.fail()) && (is.eof())) {
+            token.flag = tfel::utilities::Token::Number;
+          }
         }
       }
     }
@@ -273,6 +311,13 @@ namespace mtest {
         &MTestParser::handleNumericalTangentOperatorPerturbationValue);
     add("@UserDefinedPostProcessing",
         &MTestParser::handleUserDefinedPostProcessing);
+    add("@MaterialPoint", &MTestParser::handleMaterialPoint);
+    add("@MaterialPoints", &MTestParser::handleMaterialPoints);
+    add("@MaterialPointsOutputFile",
+        &MTestParser::handleMaterialPointsOutputFile);
+    add("@MaterialPointsPhasesOutputFile",
+        &MTestParser::handleMaterialPointsPhasesOutputFile);
+    add("@NumberOfThreads", &MTestParser::handleNumberOfThreads);
   }
 
   void MTestParser::registerCallBack(const std::string& k,
@@ -455,24 +500,6 @@ namespace mtest {
   }  // end of MTestParser::handleTest
 
   void MTestParser::handleRotationMatrix(MTest& t, tokens_iterator& p) {
-    auto from_euler = [](tfel::math::tmatrix<3, 3, real>& r, const real psi,
-                         const real the, const real phi) {
-      const real cospsi = std::cos(psi);
-      const real costhe = std::cos(the);
-      const real cosphi = std::cos(phi);
-      const real sinpsi = std::sin(psi);
-      const real sinthe = std::sin(the);
-      const real sinphi = std::sin(phi);
-      r(0, 0) = cosphi * cospsi - sinphi * costhe * sinpsi;
-      r(0, 1) = cosphi * sinpsi + sinphi * costhe * cospsi;
-      r(0, 2) = sinphi * sinthe;
-      r(1, 0) = -sinphi * cospsi - cosphi * costhe * sinpsi;
-      r(1, 1) = -sinphi * sinpsi + cosphi * costhe * cospsi;
-      r(1, 2) = cosphi * sinthe;
-      r(2, 0) = sinthe * sinpsi;
-      r(2, 1) = -sinthe * cospsi;
-      r(2, 2) = costhe;
-    };
     enum { STANDARD, EULER, MILLER, DIRECTION } choice = STANDARD;
     this->checkNotEndOfLine("MTestParser::handleRotationMatrix", p,
                             this->tokens.end());
@@ -553,7 +580,7 @@ namespace mtest {
         this->readSpecifiedToken("MTestParser::handleRotationMatrix", "}", p,
                                  this->tokens.end());
       }
-      from_euler(rm, v[0], v[1], v[2]);
+      rm = MTestParser_fromEuler(v[0], v[1], v[2]);
     } else if (choice == DIRECTION) {
       const auto n = t.getDimension();
       if (n == 2) {
@@ -971,6 +998,175 @@ namespace mtest {
     t.addUserDefinedPostProcessing(f, v);
   }  // end of MTestParser::handleUserDefinedPostProcessing
 
+  void MTestParser::handleMaterialPoint(MTest& t, tokens_iterator& p) {
+    const std::string m = "MTestParser::handleMaterialPoint";
+    auto throw_if = [&m](const bool b, const std::string& msg) {
+      tfel::raise_if(b, m + ": " + msg);
+    };
+    this->checkNotEndOfLine(m, p, this->tokens.end());
+    const auto d = tfel::utilities::Data::read_map(p, this->tokens.end())
+                       .get<tfel::utilities::DataMap>();
+    auto mp = MTest::MaterialPoint{};
+    for (const auto& [k, v] : d) {
+      if (k == "weight") {
+        throw_if(!tfel::utilities::is_convertible<double>(v),
+                 "invalid type for option 'weight'");
+        mp.weight = tfel::utilities::convert<double>(v);
+      } else if (k == "euler_angles") {
+        throw_if(mp.isRotationMatrixDefined,
+                 "rotation matrix already defined");
+        throw_if(!tfel::utilities::is_convertible<std::vector<double>>(v),
+                 "invalid type for option 'euler_angles'");
+        const auto a = tfel::utilities::convert<std::vector<double>>(v);
+        throw_if(a.size() != 3u, "invalid number of Euler angles");
+        mp.r = MTestParser_fromEuler(a[0], a[1], a[2]);
+        mp.isRotationMatrixDefined = true;
+      } else if (k == "rotation_matrix") {
+        throw_if(mp.isRotationMatrixDefined,
+                 "rotation matrix already defined");
+        throw_if(
+            !tfel::utilities::is_convertible<std::vector<std::vector<double>>>(
+                v),
+            "invalid type for option 'rotation_matrix'");
+        const auto r =
+            tfel::utilities::convert<std::vector<std::vector<double>>>(v);
+        throw_if(r.size() != 3u, "invalid rotation matrix");
+        for (unsigned short i = 0; i != 3; ++i) {
+          throw_if(r[i].size() != 3u, "invalid rotation matrix");
+          for (unsigned short j = 0; j != 3; ++j) {
+            mp.r(i, j) = r[i][j];
+          }
+        }
+        mp.isRotationMatrixDefined = true;
+      } else if (k == "material_properties") {
+        throw_if(
+            !tfel::utilities::is_convertible<std::map<std::string, double>>(v),
+            "invalid type for option 'material_properties'");
+        for (const auto& [n, mpv] :
+             tfel::utilities::convert<std::map<std::string, double>>(v)) {
+          mp.material_properties[n] = mpv;
+        }
+      } else if (k == "phase") {
+        throw_if(!v.is<std::string>(), "invalid type for option 'phase'");
+        mp.phase = v.get<std::string>();
+      } else {
+        throw_if(true, "unsupported option '" + k +
+                           "' (valid options are 'weight', "
+                           "'euler_angles', 'rotation_matrix', "
+                           "'material_properties' and 'phase')");
+      }
+    }
+    this->readSpecifiedToken(m, ";", p, this->tokens.end());
+    t.addMaterialPoint(mp);
+  }  // end of MTestParser::handleMaterialPoint
+
+  void MTestParser::handleMaterialPoints(MTest& t, tokens_iterator& p) {
+    const std::string m = "MTestParser::handleMaterialPoints";
+    auto throw_if = [&m](const bool b, const std::string& msg) {
+      tfel::raise_if(b, m + ": " + msg);
+    };
+    auto get_column = [&throw_if](const tfel::utilities::Data& c,
+                                  const std::string& n) {
+      throw_if(!c.is<int>(), "invalid column number for '" + n + "'");
+      const auto i = c.get<int>();
+      throw_if(i <= 0, "invalid column number for '" + n + "'");
+      return static_cast<size_type>(i);
+    };
+    const auto f = this->readString(p, this->tokens.end());
+    this->checkNotEndOfLine(m, p, this->tokens.end());
+    const auto d = tfel::utilities::Data::read_map(p, this->tokens.end())
+                       .get<tfel::utilities::DataMap>();
+    this->readSpecifiedToken(m, ";", p, this->tokens.end());
+    // reading the columns
+    const tfel::utilities::TextData data(f);
+    auto weights = std::vector<double>{};
+    auto angles = std::vector<std::vector<double>>{};
+    auto mps = std::map<std::string, std::vector<double>>{};
+    auto phases = std::vector<double>{};
+    for (const auto& [k, v] : d) {
+      if (k == "weight") {
+        weights = data.getColumn(get_column(v, k));
+      } else if (k == "euler_angles") {
+        throw_if(!v.is<std::vector<tfel::utilities::Data>>(),
+                 "invalid type for option 'euler_angles'");
+        const auto& c = v.get<std::vector<tfel::utilities::Data>>();
+        throw_if(c.size() != 3u, "invalid number of Euler angles");
+        for (const auto& ci : c) {
+          angles.push_back(data.getColumn(get_column(ci, k)));
+        }
+      } else if (k == "material_properties") {
+        throw_if(!v.is<tfel::utilities::DataMap>(),
+                 "invalid type for option 'material_properties'");
+        for (const auto& [n, c] : v.get<tfel::utilities::DataMap>()) {
+          mps[n] = data.getColumn(get_column(c, n));
+        }
+      } else if (k == "phase") {
+        phases = data.getColumn(get_column(v, k));
+      } else {
+        throw_if(true, "unsupported option '" + k +
+                           "' (valid options are 'weight', "
+                           "'euler_angles', 'material_properties' and "
+                           "'phase')");
+      }
+    }
+    // number of material points
+    const auto n = [&weights, &angles, &mps, &phases]() -> std::size_t {
+      if (!weights.empty()) {
+        return weights.size();
+      }
+      if (!phases.empty()) {
+        return phases.size();
+      }
+      if (!angles.empty()) {
+        return angles[0].size();
+      }
+      if (!mps.empty()) {
+        return mps.begin()->second.size();
+      }
+      return 0;
+    }();
+    throw_if(n == 0, "no material point defined in file '" + f + "'");
+    for (std::size_t i = 0; i != n; ++i) {
+      auto mp = MTest::MaterialPoint{};
+      if (!weights.empty()) {
+        mp.weight = weights[i];
+      }
+      if (!angles.empty()) {
+        mp.r = MTestParser_fromEuler(angles[0][i], angles[1][i], angles[2][i]);
+        mp.isRotationMatrixDefined = true;
+      }
+      for (const auto& [mpn, values] : mps) {
+        mp.material_properties[mpn] = values[i];
+      }
+      if (!phases.empty()) {
+        mp.phase = std::to_string(static_cast<int>(phases[i]));
+      }
+      t.addMaterialPoint(mp);
+    }
+  }  // end of MTestParser::handleMaterialPoints
+
+  void MTestParser::handleMaterialPointsOutputFile(MTest& t,
+                                                   tokens_iterator& p) {
+    t.setMaterialPointsOutputFile(this->readString(p, this->tokens.end()));
+    this->readSpecifiedToken("MTestParser::handleMaterialPointsOutputFile",
+                             ";", p, this->tokens.end());
+  }  // end of MTestParser::handleMaterialPointsOutputFile
+
+  void MTestParser::handleMaterialPointsPhasesOutputFile(MTest& t,
+                                                         tokens_iterator& p) {
+    t.setMaterialPointsPhasesOutputFile(
+        this->readString(p, this->tokens.end()));
+    this->readSpecifiedToken(
+        "MTestParser::handleMaterialPointsPhasesOutputFile", ";", p,
+        this->tokens.end());
+  }  // end of MTestParser::handleMaterialPointsPhasesOutputFile
+
+  void MTestParser::handleNumberOfThreads(MTest& t, tokens_iterator& p) {
+    t.setNumberOfThreads(this->readUnsignedInt(p, this->tokens.end()));
+    this->readSpecifiedToken("MTestParser::handleNumberOfThreads", ";", p,
+                             this->tokens.end());
+  }  // end of MTestParser::handleNumberOfThreads
+
   ConstraintOptions MTestParser::readConstraintOptions(const std::string& m,
                                                        tokens_iterator& p) {
     auto throw_if = [&m](const bool b, const char* msg) {
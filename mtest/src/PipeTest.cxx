@@ -26,6 +26,7 @@
 #include "MTest/SolverWorkSpace.hxx"
 #include "MTest/Behaviour.hxx"
 #include "MTest/CurrentState.hxx"
+#include "MTest/Checkpoint.hxx"
 #include "MTest/StudyCurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
 #include "MTest/GenericSolver.hxx"
@@ -584,51 +585,51 @@ namespace mtest {
                      "PipeTest::completeInitialisation: "
                      "filling temperature not set");
     }
-    if (this->out) {
+    if (!this->output.empty()) {
+      auto descriptions = std::vector<std::string>{
+          "first  column : time", "second column : inner radius",
+          "third  column : outer radius",
+          "fourth column : inner radius displacement",
+          "fifth  column : outer radius displacement",
+          "sixth  column : axial displacement"};
+      auto legends =
+          std::vector<std::string>{"t", "Ri", "Re", "URi", "URe", "Uz"};
       auto c = 7u;
-      this->out << "# first  column : time\n"
-                   "# second column : inner radius\n"
-                   "# third  column : outer radius\n"
-                   "# fourth column : inner radius displacement\n"
-                   "# fifth  column : outer radius displacement\n"
-                   "# sixth  column : axial displacement\n";
+      auto add_column = [&descriptions, &legends, &c](const std::string& d,
+                                                      const std::string& l) {
+        descriptions.push_back(std::to_string(c) + "th column : " + d);
+        legends.push_back(l);
+        ++c;
+      };
       if ((this->rl == IMPOSEDINNERRADIUS) ||
           (this->rl == IMPOSEDOUTERRADIUS) || (this->rl == TIGHTPIPE)) {
-        this->out << "# " << c << "th column : inner pressure\n";
-        ++c;
-      }
-      if (this->mandrel_radius_evolution != nullptr) {
-        this->out << "# " << c << "th column : contact pressure\n";
-        ++c;
+        add_column("inner pressure", "InnerPressure");
+      } else if (this->mandrel_radius_evolution != nullptr) {
+        add_column("contact pressure", "ContactPressure");
       }
       if ((this->al == IMPOSEDAXIALGROWTH) ||
           (this->mandrel_axial_growth_evolution != nullptr)) {
-        this->out << "# " << c << "th column : axial force\n";
-        ++c;
+        add_column("axial force", "AxialForce");
       }
       if (this->mandrel_radius_evolution != nullptr) {
-        this->out << "# " << c << "th column : mandel contact indicator\n";
-        ++c;
+        add_column("mandel contact indicator", "MandrelContact");
       }
       for (const auto& ao : this->aoutputs) {
-        this->out << "# " << c << "th column : " << ao.d << '\n';
-        ++c;
+        add_column(ao.d, ao.d);
       }
       if (this->inner_boundary_oxidation_model.model != nullptr) {
-        this->out << "# " << c
-                  << "th column : oxidation length at the inner boundary\n";
-        ++c;
+        add_column("oxidation length at the inner boundary",
+                   "InnerBoundaryOxidationLength");
       }
       if (this->outer_boundary_oxidation_model.model != nullptr) {
-        this->out << "# " << c
-                  << "th column : oxidation length at the outer boundary\n";
-        ++c;
+        add_column("oxidation length at the outer boundary",
+                   "OuterBoundaryOxidationLength");
       }
       for (const auto& fc : this->failure_criteria) {
-        this->out << "# " << c << "th column : status of the " << fc->getName()
-                  << " criterion\n";
-        ++c;
+        add_column("status of the " + fc->getName() + " criterion",
+                   fc->getName());
       }
+      this->writeOutputFileHeader(descriptions, legends);
     }
     if (this->rl == TIGHTPIPE) {
       if (this->gseq != nullptr) {
@@ -865,24 +866,31 @@ namespace mtest {
                            std::shared_ptr<Evolution>(new LPIEvolution(
                                {*pt, *pt2}, {real(0), real(0)})));
       }
+      const auto i0 = this->restart(state);
+      pt += static_cast<std::ptrdiff_t>(i0);
+      pt2 += static_cast<std::ptrdiff_t>(i0);
       this->printOutput(*pt, state, true);
       // real work begins here
       while (pt2 != this->times.end()) {
         // allowing subdivisions of the time step
         this->execute(state, wk, *pt, *pt2);
         this->printOutput(*pt2, state, true);
+        const auto i = static_cast<std::vector<real>::size_type>(
+            pt2 - this->times.begin());
+        this->writeCheckpoint(state, i);
         ++pt;
         ++pt2;
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFile();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFile();
       report(nullptr, state, false);
       throw;
     }
+    this->flushOutputFile();
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
@@ -1689,40 +1697,40 @@ namespace mtest {
     if (t == "minimum_value") {
       this->aoutputs.push_back(
           {"minimum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMinimumValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMinimumValue(s, n);
            }});
     } else if (t == "maximum_value") {
       this->aoutputs.push_back(
           {"maximum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMaximumValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMaximumValue(s, n);
            }});
     } else if (t == "integral_value_initial_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(s, n);
            }});
     } else if (t == "integral_value_current_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(
                  s, n, Configuration::CURRENT_CONFIGURATION);
            }});
     } else if (t == "mean_value_initial_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(s, n);
            }});
     } else if (t == "mean_value_current_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n,
-                                          Configuration::CURRENT_CONFIGURATION);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(
+                 s, n, Configuration::CURRENT_CONFIGURATION);
            }});
     } else {
       tfel::raise(
@@ -2141,7 +2149,7 @@ namespace mtest {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
-    if (!this->out) {
+    if (this->output.empty()) {
       return;
     }
     const auto& u1 = state.u1;
@@ -2150,46 +2158,64 @@ namespace mtest {
     const auto Ri = this->mesh.inner_radius;
     // outer radius
     const auto Re = this->mesh.outer_radius;
-    this->out << t << " " << Ri + u1[0] << " " << Re + u1[n - 1] << " " << u1[0]
-              << " " << u1[n - 1] << " " << u1[n];
+    auto row = std::vector<real>{t,     Ri + u1[0], Re + u1[n - 1],
+                                 u1[0], u1[n - 1],  u1[n]};
     if ((this->rl == IMPOSEDOUTERRADIUS) || (this->rl == IMPOSEDINNERRADIUS) ||
         (this->rl == TIGHTPIPE) ||
         (this->mandrel_radius_evolution != nullptr)) {
-      this->out << " " << state.getEvolution("InnerPressure")(t);
+      row.push_back(state.getEvolution("InnerPressure")(t));
     }
     if ((this->al == IMPOSEDAXIALGROWTH) ||
         (this->mandrel_axial_growth_evolution != nullptr)) {
-      this->out << " " << state.getEvolution("AxialForce")(t);
+      row.push_back(state.getEvolution("AxialForce")(t));
     }
     if (this->mandrel_radius_evolution != nullptr) {
-      if (state.containsParameter("MandrelContactStateAtEndOfTimeStep")) {
-        if (state.getParameter<bool>("MandrelContactStateAtEndOfTimeStep")) {
-          this->out << " " << 1;
-        } else {
-          this->out << " " << 0;
-        }
+      if ((state.containsParameter("MandrelContactStateAtEndOfTimeStep")) &&
+          (state.getParameter<bool>("MandrelContactStateAtEndOfTimeStep"))) {
+        row.push_back(1);
       } else {
-        this->out << " " << 0;
+        row.push_back(0);
       }
     }
     for (const auto& ao : this->aoutputs) {
-      this->out << " ";
-      ao.f(out, state);
+      row.push_back(ao.f(state));
     }
     if (this->inner_boundary_oxidation_model.model != nullptr) {
-      this->out << getOxidationLength(state,
-                                      this->inner_boundary_oxidation_model);
+      row.push_back(
+          getOxidationLength(state, this->inner_boundary_oxidation_model));
     }
     if (this->outer_boundary_oxidation_model.model != nullptr) {
-      this->out << getOxidationLength(state,
-                                      this->outer_boundary_oxidation_model);
+      row.push_back(
+          getOxidationLength(state, this->outer_boundary_oxidation_model));
     }
     for (std::size_t i = 0; i != this->failure_criteria.size(); ++i) {
-      this->out << " " << (state.getFailureCriterionStatus(i) ? 1 : 0);
+      row.push_back(state.getFailureCriterionStatus(i) ? 1 : 0);
     }
-    this->out << '\n';
+    this->writeOutputFileRow(row);
   }  // end of printOutput
 
+  void PipeTest::writeAdditionalCheckpointData(
+      std::ostream& os, const StudyCurrentState& state) const {
+    const auto& ss = state.getStructureCurrentState("");
+    for (const auto* m : {&(this->inner_boundary_oxidation_model),
+                          &(this->outer_boundary_oxidation_model)}) {
+      if (m->model != nullptr) {
+        writeCheckpointData(os, ss.getModelCurrentState(*(m->model)));
+      }
+    }
+  }  // end of writeAdditionalCheckpointData
+
+  void PipeTest::readAdditionalCheckpointData(std::istream& is,
+                                              StudyCurrentState& state) const {
+    auto& ss = state.getStructureCurrentState("");
+    for (const auto* m : {&(this->inner_boundary_oxidation_model),
+                          &(this->outer_boundary_oxidation_model)}) {
+      if (m->model != nullptr) {
+        readCheckpointData(is, ss.getModelCurrentState(*(m->model)));
+      }
+    }
+  }  // end of readAdditionalCheckpointData
+
   PipeTest::~PipeTest() = default;
 
 }  // end of namespace mtest
@@ -76,6 +76,15 @@ namespace mtest {
         if (((p->second.front() == '\'') && (p->second.back() == '\'')) ||
             ((p->second.front() == '"') && (p->second.back() == '"'))) {
           token.flag = tfel::utilities::Token::String;
+        } else {
+          // numerical values must be flagged as such to be read by
+          // `readDouble`, `readInt`, etc.
+          auto is = std::istringstream{p->second};
+          auto v = double{};
+          is >> v;
+          if ((!is.fail()) && (is.eof())) {
+            token.flag = tfel::utilities::Token::Number;
+          }
         }
       }
     }
@@ -11,6 +11,9 @@
  * project under specific licensing conditions.
  */
 
+#include <cmath>
+#include <cstdio>
+#include <limits>
 #include <sstream>
 #include <algorithm>
 
@@ -19,6 +22,8 @@
 #include "MTest/AccelerationAlgorithmFactory.hxx"
 #include "MTest/CastemAccelerationAlgorithm.hxx"
 #include "MTest/Evolution.hxx"
+#include "MTest/Checkpoint.hxx"
+#include "MTest/StudyCurrentState.hxx"
 #include "MTest/SchemeBase.hxx"
 
 namespace mtest {
@@ -312,7 +317,9 @@ namespace mtest {
 
   void SchemeBase::resetOutputFile() {
     // output file
-    if (!this->output.empty()) {
+    this->binary_out.reset();
+    if ((!this->output.empty()) &&
+        (this->output_file_format == TEXTFORMAT)) {
       this->out.close();
       this->out.open(this->output.c_str());
       tfel::raise_if(!this->out,
@@ -434,6 +441,113 @@ namespace mtest {
     this->output = o;
   }
 
+  void SchemeBase::setCheckpointFileName(const std::string& f,
+                                         const std::size_t n) {
+    tfel::raise_if(!this->checkpoint_file.empty(),
+                   "SchemeBase::setCheckpointFileName: "
+                   "checkpoint file name already defined");
+    tfel::raise_if(f.empty(),
+                   "SchemeBase::setCheckpointFileName: "
+                   "empty checkpoint file name");
+    tfel::raise_if(n == 0,
+                   "SchemeBase::setCheckpointFileName: "
+                   "invalid number of time steps between two checkpoints");
+    this->checkpoint_file = f;
+    this->checkpoint_frequency = n;
+  }  // end of setCheckpointFileName
+
+  void SchemeBase::setRestartFileName(const std::string& f) {
+    tfel::raise_if(!this->restart_file.empty(),
+                   "SchemeBase::setRestartFileName: "
+                   "restart file name already defined");
+    this->restart_file = f;
+  }  // end of setRestartFileName
+
+  std::vector<real>::size_type SchemeBase::restart(
+      StudyCurrentState& s) const {
+    if (this->restart_file.empty()) {
+      return 0;
+    }
+    std::ifstream f(this->restart_file, std::ios::binary);
+    tfel::raise_if(!f,
+                   "SchemeBase::restart: "
+                   "can't open file '" +
+                       this->restart_file + "'");
+    const auto t = readCheckpointHeader(f);
+    // tolerance used to find the restart time in the list of times
+    const auto eps = [this] {
+      auto m = real(1);
+      for (const auto ti : this->times) {
+        m = std::max(m, std::abs(ti));
+      }
+      return 100 * m * std::numeric_limits<real>::epsilon();
+    }();
+    const auto p = std::find_if(
+        this->times.begin(), this->times.end(),
+        [t, eps](const real ti) { return std::abs(ti - t) < eps; });
+    tfel::raise_if(p == this->times.end(),
+                   "SchemeBase::restart: the time of the checkpoint "
+                   "stored in file '" +
+                       this->restart_file +
+                       "' does not match any of the times of the simulation");
+    const auto i = static_cast<std::vector<real>::size_type>(
+        p - this->times.begin());
+    s.readCheckpoint(f, this->times[i]);
+    this->readAdditionalCheckpointData(f, s);
+    if (mfront::getVerboseMode() >= mfront::VERBOSE_LEVEL1) {
+      auto& log = mfront::getLogStream();
+      log << "** restarting from file '" << this->restart_file
+          << "' at time " << this->times[i] << '\n';
+    }
+    return i;
+  }  // end of restart
+
+  void SchemeBase::writeCheckpoint(
+      const StudyCurrentState& s, const std::vector<real>::size_type i) const {
+    if (this->checkpoint_file.empty()) {
+      return;
+    }
+    const auto last = i + 1 == this->times.size();
+    if ((i % this->checkpoint_frequency != 0) && (!last)) {
+      return;
+    }
+    // the checkpoint is first written in a temporary file, so that
+    // the previous checkpoint is preserved if the computation is
+    // interrupted during the writing
+    const auto tmp = this->checkpoint_file + ".tmp";
+    {
+      std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+      tfel::raise_if(!f,
+                     "SchemeBase::writeCheckpoint: "
+                     "can't open file '" +
+                         tmp + "'");
+      writeCheckpointHeader(f, this->times[i]);
+      s.writeCheckpoint(f, this->times[i]);
+      this->writeAdditionalCheckpointData(f, s);
+      f.close();
+      tfel::raise_if(!f,
+                     "SchemeBase::writeCheckpoint: "
+                     "error while writing file '" +
+                         tmp + "'");
+    }
+#if defined _WIN32 || defined _WIN64
+    std::remove(this->checkpoint_file.c_str());
+#endif /* defined _WIN32 || defined _WIN64 */
+    tfel::raise_if(
+        std::rename(tmp.c_str(), this->checkpoint_file.c_str()) != 0,
+        "SchemeBase::writeCheckpoint: "
+        "can't rename file '" +
+            tmp + "' to '" + this->checkpoint_file + "'");
+  }  // end of writeCheckpoint
+
+  void SchemeBase::writeAdditionalCheckpointData(
+      std::ostream&, const StudyCurrentState&) const {
+  }  // end of writeAdditionalCheckpointData
+
+  void SchemeBase::readAdditionalCheckpointData(std::istream&,
+                                                StudyCurrentState&) const {
+  }  // end of readAdditionalCheckpointData
+
   bool SchemeBase::isOutputFileNameDefined() const {
     return !this->output.empty();
   }
@@ -445,6 +559,58 @@ namespace mtest {
     this->oprec = static_cast<int>(p);
   }
 
+  void SchemeBase::setOutputFileFormat(const OutputFileFormat f) {
+    this->output_file_format = f;
+  }  // end of setOutputFileFormat
+
+  void SchemeBase::writeOutputFileHeader(
+      const std::vector<std::string>& d,
+      const std::vector<std::string>& l) const {
+    if (this->output.empty()) {
+      return;
+    }
+    if (this->output_file_format == BINARYFORMAT) {
+      auto h = tfel::utilities::BinaryDataHeader{};
+      h.legends = l;
+      h.preamble = d;
+      h.precision = this->oprec;
+      this->binary_out =
+          std::make_unique<tfel::utilities::BinaryDataWriter>(this->output, h);
+      return;
+    }
+    for (const auto& line : d) {
+      this->out << "# " << line << '\n';
+    }
+  }  // end of writeOutputFileHeader
+
+  void SchemeBase::writeOutputFileRow(const std::vector<real>& v) const {
+    if (this->output.empty()) {
+      return;
+    }
+    if (this->output_file_format == BINARYFORMAT) {
+      tfel::raise_if(this->binary_out == nullptr,
+                     "SchemeBase::writeOutputFileRow: "
+                     "the header of the output file has not been written");
+      this->binary_out->write(v);
+      return;
+    }
+    for (decltype(v.size()) i = 0; i != v.size(); ++i) {
+      if (i != 0) {
+        this->out << ' ';
+      }
+      this->out << v[i];
+    }
+    this->out << '\n';
+  }  // end of writeOutputFileRow
+
+  void SchemeBase::flushOutputFile() const {
+    if (this->binary_out != nullptr) {
+      this->binary_out->flush();
+    } else if (this->out.is_open()) {
+      this->out.flush();
+    }
+  }  // end of flushOutputFile
+
   void SchemeBase::setResidualFileName(const std::string& o) {
     tfel::raise_if(!this->residualFileName.empty(),
                    "SchemeBase::setResidualFileName : "
@@ -190,6 +190,23 @@ namespace mtest {
                              ";", p, this->tokens.end());
   }  // end of SchemeParserBase::handleOutputFilePrecision
 
+  void SchemeParserBase::handleOutputFileFormat(SchemeBase& t,
+                                                tokens_iterator& p) {
+    const auto f = this->readString(p, this->tokens.end());
+    if (f == "text") {
+      t.setOutputFileFormat(SchemeBase::TEXTFORMAT);
+    } else if (f == "binary") {
+      t.setOutputFileFormat(SchemeBase::BINARYFORMAT);
+    } else {
+      tfel::raise(
+          "SchemeParserBase::handleOutputFileFormat: "
+          "invalid format '" +
+          f + "'. Expected 'text' or 'binary'");
+    }
+    this->readSpecifiedToken("SchemeParserBase::handleOutputFileFormat", ";",
+                             p, this->tokens.end());
+  }  // end of SchemeParserBase::handleOutputFileFormat
+
   void SchemeParserBase::handleResidualFile(SchemeBase& t, tokens_iterator& p) {
     t.setResidualFileName(this->readString(p, this->tokens.end()));
     this->readSpecifiedToken("SchemeParserBase::handleResidualFiles", ";", p,
@@ -389,6 +406,19 @@ namespace mtest {
                              this->tokens.end());
   }  // end of SchemeParserBase::handleOutputFrequency
 
+  void SchemeParserBase::handleCheckpoint(SchemeBase& t, tokens_iterator& p) {
+    const auto f = this->readString(p, this->tokens.end());
+    this->checkNotEndOfLine("SchemeParserBase::handleCheckpoint", p,
+                            this->tokens.end());
+    if (p->value == ";") {
+      t.setCheckpointFileName(f);
+    } else {
+      t.setCheckpointFileName(f, this->readUnsignedInt(p, this->tokens.end()));
+    }
+    this->readSpecifiedToken("SchemeParserBase::handleCheckpoint", ";", p,
+                             this->tokens.end());
+  }  // end of SchemeParserBase::handleCheckpoint
+
   void SchemeParserBase::handleDynamicTimeStepScaling(SchemeBase& t,
                                                       tokens_iterator& p) {
     this->checkNotEndOfLine("SchemeParserBase::handleDynamicTimeStepScaling", p,
@@ -746,7 +776,9 @@ namespace mtest {
     add("@OutputFile", &SchemeParserBase::handleOutputFile);
     add("@XMLOutputFile", &SchemeParserBase::handleXMLOutputFile);
     add("@OutputFrequency", &SchemeParserBase::handleOutputFrequency);
+    add("@Checkpoint", &SchemeParserBase::handleCheckpoint);
     add("@OutputFilePrecision", &SchemeParserBase::handleOutputFilePrecision);
+    add("@OutputFileFormat", &SchemeParserBase::handleOutputFileFormat);
     add("@ResidualFile", &SchemeParserBase::handleResidualFile);
     add("@ResidualFilePrecision",
         &SchemeParserBase::handleResidualFilePrecision);
@@ -328,26 +328,7 @@ namespace mtest {
       computeExternalStateVariables(
           s, *(this->evm), this->b->expandExternalStateVariablesNames(), t, dt);
       // thermal expansion
-      if ((this->handleThermalExpansion) &&
-          ((this->b->getBehaviourType() ==
-            MechanicalBehaviourBase::STANDARDSTRAINBASEDBEHAVIOUR) ||
-           ((this->b->getBehaviourType() ==
-             MechanicalBehaviourBase::STANDARDFINITESTRAINBEHAVIOUR) &&
-            (this->b->getBehaviourKinematic() ==
-             MechanicalBehaviourBase::FINITESTRAINKINEMATIC_ETO_PK1)))) {
-        if (this->b->getSymmetryType() == 0) {
-          // isotropic case
-          computeThermalExpansion(s, *(this->evm), t, dt);
-        } else if (this->b->getSymmetryType() == 1) {
-          // orthotropic case
-          computeThermalExpansion(s, *(this->evm), t, dt,
-                                  getSpaceDimension(this->hypothesis));
-        } else {
-          tfel::raise(
-              "SingleStructureScheme::prepare: "
-              "unsupported behaviour symmetry");
-        }
-      }
+      this->computeThermalStrains(s, t, dt);
     }
     if (mfront::getVerboseMode() >= mfront::VERBOSE_LEVEL1) {
       auto& log = mfront::getLogStream();
@@ -360,6 +341,32 @@ namespace mtest {
     return {true, 1};
   }  // end of prepare
 
+  void SingleStructureScheme::computeThermalStrains(CurrentState& s,
+                                                    const real t,
+                                                    const real dt) const {
+    using namespace tfel::material;
+    if ((this->handleThermalExpansion) &&
+        ((this->b->getBehaviourType() ==
+          MechanicalBehaviourBase::STANDARDSTRAINBASEDBEHAVIOUR) ||
+         ((this->b->getBehaviourType() ==
+           MechanicalBehaviourBase::STANDARDFINITESTRAINBEHAVIOUR) &&
+          (this->b->getBehaviourKinematic() ==
+           MechanicalBehaviourBase::FINITESTRAINKINEMATIC_ETO_PK1)))) {
+      if (this->b->getSymmetryType() == 0) {
+        // isotropic case
+        computeThermalExpansion(s, *(this->evm), t, dt);
+      } else if (this->b->getSymmetryType() == 1) {
+        // orthotropic case
+        computeThermalExpansion(s, *(this->evm), t, dt,
+                                getSpaceDimension(this->hypothesis));
+      } else {
+        tfel::raise(
+            "SingleStructureScheme::computeThermalStrains: "
+            "unsupported behaviour symmetry");
+      }
+    }
+  }  // end of computeThermalStrains
+
   void SingleStructureScheme::setHandleThermalExpansion(const bool b1) {
     tfel::raise_if(!this->handleThermalExpansion,
                    "SingleStructureScheme::setHandleThermalExpansion: "
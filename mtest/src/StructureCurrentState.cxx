@@ -61,18 +61,24 @@ namespace mtest {
   }
 
   BehaviourWorkSpace& StructureCurrentState::getBehaviourWorkSpace() const {
+    return this->getBehaviourWorkSpace(0);
+  }  // end of StructureCurrentState::getBehaviourWorkSpace
+
+  BehaviourWorkSpace& StructureCurrentState::getBehaviourWorkSpace(
+      const std::size_t i) const {
     using tfel::material::ModellingHypothesis;
-    if (this->bwks.empty()) {
+    while (this->bwks.size() <= i) {
       tfel::raise_if(this->b == nullptr,
                      "StructureCurrentState::getBehaviourWorkSpace: "
                      "behaviour not set");
       tfel::raise_if(this->h == ModellingHypothesis::UNDEFINEDHYPOTHESIS,
                      "StructureCurrentState::getBehaviourWorkSpace: "
                      "modelling hypothesis not set");
-      this->bwks.push_back(std::make_shared<BehaviourWorkSpace>());
-      this->b->allocateWorkSpace(*(this->bwks[0]));
+      auto wk = std::make_shared<BehaviourWorkSpace>();
+      this->b->allocateWorkSpace(*wk);
+      this->bwks.push_back(std::move(wk));
     }
-    return *(this->bwks[0]);
+    return *(this->bwks[i]);
   }  // end of StructureCurrentState::getBehaviourWorkSpace
 
   CurrentState& StructureCurrentState::getModelCurrentState(const Model& m) {
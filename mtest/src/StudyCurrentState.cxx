@@ -11,7 +11,12 @@
  * project under specific licensing conditions.
  */
 
+#include <istream>
+#include <ostream>
 #include "TFEL/Raise.hxx"
+#include "MTest/Evolution.hxx"
+#include "MTest/CurrentState.hxx"
+#include "MTest/Checkpoint.hxx"
 #include "MTest/StudyCurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
 
@@ -184,6 +189,132 @@ namespace mtest {
     return *(p->second);
   }
 
+  void StudyCurrentState::writeCheckpoint(std::ostream& os,
+                                          const real t) const {
+    for (const auto* v : {&(this->u_1), &(this->u0), &(this->u1),
+                          &(this->u10)}) {
+      writeCheckpointData(os, *v);
+    }
+    writeCheckpointData(os, static_cast<std::size_t>(this->period));
+    writeCheckpointData(os, static_cast<std::size_t>(this->iterations));
+    writeCheckpointData(os, static_cast<std::size_t>(this->subSteps));
+    writeCheckpointData(os, this->dt_1);
+    writeCheckpointData(os, this->failure_criterion_status.size());
+    for (const auto status : this->failure_criterion_status) {
+      writeCheckpointData(os, static_cast<bool>(status));
+    }
+    writeCheckpointData(os, this->parameters.size());
+    for (const auto& [n, p] : this->parameters) {
+      writeCheckpointData(os, n);
+      if (p.is<bool>()) {
+        writeCheckpointData(os, std::size_t{0});
+        writeCheckpointData(os, p.get<bool>());
+      } else if (p.is<real>()) {
+        writeCheckpointData(os, std::size_t{1});
+        writeCheckpointData(os, p.get<real>());
+      } else {
+        writeCheckpointData(os, std::size_t{2});
+        writeCheckpointData(os, p.get<std::string>());
+      }
+    }
+    writeCheckpointData(os, this->evs.size());
+    for (const auto& [n, ev] : this->evs) {
+      writeCheckpointData(os, n);
+      writeCheckpointData(os, (*ev)(t));
+    }
+    writeCheckpointData(os, this->s.size());
+    for (const auto& [n, ss] : this->s) {
+      writeCheckpointData(os, n);
+      writeCheckpointData(os, static_cast<std::size_t>(ss->istates.size()));
+      for (const auto& cs : ss->istates) {
+        writeCheckpointData(os, cs);
+      }
+    }
+  }  // end of writeCheckpoint
+
+  void StudyCurrentState::readCheckpoint(std::istream& is, const real t) {
+    auto read_size = [&is] {
+      auto n = std::size_t{};
+      readCheckpointData(is, n);
+      return n;
+    };
+    for (auto* v : {&(this->u_1), &(this->u0), &(this->u1), &(this->u10)}) {
+      readCheckpointData(is, *v);
+    }
+    this->period = static_cast<unsigned int>(read_size());
+    this->iterations = static_cast<unsigned int>(read_size());
+    this->subSteps = static_cast<unsigned int>(read_size());
+    readCheckpointData(is, this->dt_1);
+    const auto nstatus = read_size();
+    tfel::raise_if(nstatus != this->failure_criterion_status.size(),
+                   "StudyCurrentState::readCheckpoint: "
+                   "inconsistent number of failure criteria");
+    for (std::size_t i = 0; i != nstatus; ++i) {
+      auto status = false;
+      readCheckpointData(is, status);
+      this->failure_criterion_status[i] = status;
+    }
+    const auto nparameters = read_size();
+    for (std::size_t i = 0; i != nparameters; ++i) {
+      auto n = std::string{};
+      readCheckpointData(is, n);
+      const auto type = read_size();
+      auto& p = this->parameters[n];
+      if (type == 0) {
+        auto v = false;
+        readCheckpointData(is, v);
+        p = v;
+      } else if (type == 1) {
+        auto v = real{};
+        readCheckpointData(is, v);
+        p = v;
+      } else if (type == 2) {
+        auto v = std::string{};
+        readCheckpointData(is, v);
+        p = std::move(v);
+      } else {
+        tfel::raise(
+            "StudyCurrentState::readCheckpoint: "
+            "invalid type for parameter '" +
+            n + "'");
+      }
+    }
+    const auto nevolutions = read_size();
+    for (std::size_t i = 0; i != nevolutions; ++i) {
+      auto n = std::string{};
+      auto v = real{};
+      readCheckpointData(is, n);
+      readCheckpointData(is, v);
+      const auto p = this->evs.find(n);
+      if (p == this->evs.end()) {
+        this->evs[n] = make_evolution({{t, v}});
+      } else if (p->second->isConstant()) {
+        p->second->setValue(v);
+      } else {
+        p->second->setValue(t, v);
+      }
+    }
+    const auto nstructures = read_size();
+    for (std::size_t i = 0; i != nstructures; ++i) {
+      auto n = std::string{};
+      readCheckpointData(is, n);
+      const auto p = this->s.find(n);
+      tfel::raise_if(p == this->s.end(),
+                     "StudyCurrentState::readCheckpoint: "
+                     "no state associated to structure '" +
+                         n + "'");
+      auto& istates = p->second->istates;
+      tfel::raise_if(read_size() != istates.size(),
+                     "StudyCurrentState::readCheckpoint: "
+                     "inconsistent number of integration points for "
+                     "structure '" +
+                         n + "'");
+      for (auto& cs : istates) {
+        readCheckpointData(is, cs);
+      }
+    }
+  }  // end of readCheckpoint
+
   StudyCurrentState::~StudyCurrentState() = default;
 
 }  // end of namespace mtest
@@ -48,6 +48,14 @@ struct EvolutionTestUnitTest final : public tfel::tests::TestCase {
     TFEL_TESTS_ASSERT(std::abs(lev2->operator()(0.) - 1.) < 1.e-14);
     TFEL_TESTS_ASSERT(std::abs(lev2->operator()(0.5) - 1.) < 1.e-14);
     TFEL_TESTS_ASSERT(std::abs(lev2->operator()(1.) - 1.) < 1.e-14);
+    // evaluations in decreasing order of time
+    TFEL_TESTS_ASSERT(std::abs(lev->operator()(1.75) - 3.75) < 1.e-14);
+    TFEL_TESTS_ASSERT(std::abs(lev->operator()(0.25) - 2.25) < 1.e-14);
+    // insertion of a new value
+    lev->setValue(1.5, 5.);
+    TFEL_TESTS_ASSERT(std::abs(lev->operator()(1.5) - 5.) < 1.e-14);
+    TFEL_TESTS_ASSERT(std::abs(lev->operator()(1.25) - 4.) < 1.e-14);
+    TFEL_TESTS_ASSERT(std::abs(lev->operator()(1.75) - 4.5) < 1.e-14);
     TFEL_TESTS_CHECK_THROW(lev->setValue(4.), std::runtime_error);
     TFEL_TESTS_CHECK_THROW(cev->setValue(2., 4.), std::runtime_error);
     TFEL_TESTS_CHECK_THROW(mtest::LPIEvolution({}, {})(2.), std::runtime_error);
@@ -0,0 +1,73 @@
+/*!
+ * \file   StudyCurrentStateTest.cxx
+ * \brief  This file tests the checkpoint of the StudyCurrentState class.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "MTest/Evolution.hxx"
+#include "MTest/StudyCurrentState.hxx"
+
+struct StudyCurrentStateTest final : public tfel::tests::TestCase {
+  StudyCurrentStateTest()
+      : tfel::tests::TestCase("MTest", "StudyCurrentStateTest") {
+  }  // end of StudyCurrentStateTest
+
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    return this->result;
+  }  // end of execute()
+
+ private:
+  //! \brief checkpoint of a state containing constant evolutions
+  void test1() {
+    auto s = mtest::StudyCurrentState{};
+    s.addEvolution("Pressure", mtest::make_evolution(12.));
+    s.addEvolution("Force", mtest::make_evolution({{0., 1.}, {2., 3.}}));
+    s.setParameter("p", 3.);
+    auto os = std::ostringstream{};
+    s.writeCheckpoint(os, 1.);
+    // restart from a state initialized by the scheme
+    auto s2 = mtest::StudyCurrentState{};
+    s2.addEvolution("Pressure", mtest::make_evolution(0.));
+    s2.addEvolution("Force", mtest::make_evolution({{0., 0.}, {2., 0.}}));
+    auto is = std::istringstream{os.str()};
+    s2.readCheckpoint(is, 1.);
+    const auto& p = s2.getEvolution("Pressure");
+    const auto& f = s2.getEvolution("Force");
+    TFEL_TESTS_ASSERT(p.isConstant());
+    TFEL_TESTS_ASSERT(std::abs(p(0.) - 12.) < 1.e-14);
+    TFEL_TESTS_ASSERT(std::abs(f(1.) - 2.) < 1.e-14);
+    TFEL_TESTS_ASSERT(std::abs(s2.getParameter<double>("p") - 3.) < 1.e-14);
+  }  // end of test1
+};
+
+TFEL_TESTS_GENERATE_PROXY(StudyCurrentStateTest, "StudyCurrentStateTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("StudyCurrentStateTest.xml");
+  const auto r = m.execute();
+  return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,266 @@
+/*!
+ * \file   src/System/EntryPointsIndex.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <map>
+#include <atomic>
+#include <thread>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+#if defined _WIN32 || defined _WIN64
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+#include "TFEL/Raise.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "TFEL/System/EntryPointsIndex.hxx"
+
+namespace tfel::system {
+
+  const char* const EntryPointsIndexFileName = ".tfel-entry-points-index";
+
+  //! \brief header of the index files
+  static constexpr const char* EntryPointsIndexHeader =
+      "TFEL-ENTRY-POINTS-INDEX 1";
+
+  //! \brief description of an indexed library
+  struct IndexedLibrary {
+    //! \brief file name, relative to the indexed directory
+    std::string file;
+    //! \brief size of the file
+    std::uintmax_t size = 0;
+    //! \brief modification time of the file
+    long long mtime = 0;
+    //! \brief entry points
+    std::vector<EntryPointDescription> entry_points;
+  };  // end of struct IndexedLibrary
+
+  static void EntryPointsIndexWriteString(std::ostream& os,
+                                          const std::string& s) {
+    os << s.size() << ' ' << s << '\n';
+  }  // end of EntryPointsIndexWriteString
+
+  static std::string EntryPointsIndexReadString(std::istream& is) {
+    auto n = std::string::size_type{};
+    is >> n;
+    is.get();
+    auto s = std::string(n, '\0');
+    is.read(s.data(), static_cast<std::streamsize>(n));
+    is.get();
+    raise_if(!is, "getIndexedEntryPointsDescriptions: invalid index");
+    return s;
+  }  // end of EntryPointsIndexReadString
+
+  static bool isSharedLibrary(const std::string& f) {
+    auto ends_with = [&f](const std::string& s) {
+      return (f.size() >= s.size()) &&
+             (std::equal(s.rbegin(), s.rend(), f.rbegin()));
+    };
+    return ends_with(".so") || ends_with(".dylib") || ends_with(".dll") ||
+           (f.find(".so.") != std::string::npos);
+  }  // end of isSharedLibrary
+
+  static std::map<std::string, IndexedLibrary> readEntryPointsIndex(
+      const std::string& f) {
+    auto libraries = std::map<std::string, IndexedLibrary>{};
+    std::ifstream in(f);
+    if (!in) {
+      return libraries;
+    }
+    try {
+      auto header = std::string{};
+      std::getline(in, header);
+      if (header != EntryPointsIndexHeader) {
+        return libraries;
+      }
+      auto nlibraries = std::size_t{};
+      in >> nlibraries;
+      for (std::size_t i = 0; i != nlibraries; ++i) {
+        auto l = IndexedLibrary{};
+        auto nentries = std::size_t{};
+        in >> l.size >> l.mtime >> nentries;
+        l.file = EntryPointsIndexReadString(in);
+        for (std::size_t j = 0; j != nentries; ++j) {
+          auto e = EntryPointDescription{};
+          auto nhypotheses = std::size_t{};
+          in >> e.type >> nhypotheses;
+          e.name = EntryPointsIndexReadString(in);
+          e.material = EntryPointsIndexReadString(in);
+          e.interface = EntryPointsIndexReadString(in);
+          e.source = EntryPointsIndexReadString(in);
+          for (std::size_t k = 0; k != nhypotheses; ++k) {
+            e.hypotheses.push_back(EntryPointsIndexReadString(in));
+          }
+          l.entry_points.push_back(std::move(e));
+        }
+        raise_if(!in, "getIndexedEntryPointsDescriptions: invalid index");
+        libraries[l.file] = std::move(l);
+      }
+    } catch (...) {
+      // an invalid index is rebuilt
+      libraries.clear();
+    }
+    return libraries;
+  }  // end of readEntryPointsIndex
+
+  static void writeEntryPointsIndex(
+      const std::string& f,
+      const std::map<std::string, IndexedLibrary>& libraries) {
+    // the index is written in a temporary file which is then renamed, so
+    // that concurrent readers always see a complete index
+#if defined _WIN32 || defined _WIN64
+    const auto tmp = f + ".tmp-" + std::to_string(::_getpid());
+#else
+    const auto tmp = f + ".tmp-" + std::to_string(::getpid());
+#endif
+    {
+      std::ofstream out(tmp);
+      if (!out) {
+        return;
+      }
+      out << EntryPointsIndexHeader << '\n' << libraries.size() << '\n';
+      for (const auto& [name, l] : libraries) {
+        out << l.size << ' ' << l.mtime << ' ' << l.entry_points.size()
+            << '\n';
+        EntryPointsIndexWriteString(out, l.file);
+        for (const auto& e : l.entry_points) {
+          out << e.type << ' ' << e.hypotheses.size() << '\n';
+          for (const auto* s :
+               {&e.name, &e.material, &e.interface, &e.source}) {
+            EntryPointsIndexWriteString(out, *s);
+          }
+          for (const auto& h : e.hypotheses) {
+            EntryPointsIndexWriteString(out, h);
+          }
+        }
+      }
+      if (!out) {
+        out.close();
+        std::remove(tmp.c_str());
+        return;
+      }
+    }
+    if (std::rename(tmp.c_str(), f.c_str()) != 0) {
+      std::remove(tmp.c_str());
+    }
+  }  // end of writeEntryPointsIndex
+
+  std::vector<EntryPointDescription> getEntryPointsDescriptions(
+      const std::string& l) {
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    auto descriptions = std::vector<EntryPointDescription>{};
+    for (const auto& n : elm.getEntryPoints(l)) {
+      auto d = EntryPointDescription{};
+      d.library = l;
+      d.name = n;
+      d.type = elm.getMaterialKnowledgeType(l, n);
+      d.material = elm.getMaterial(l, n);
+      try {
+        d.interface = elm.getInterface(l, n);
+      } catch (std::exception&) {
+        // entry points without interface are reported with an empty
+        // interface
+      }
+      d.source = elm.getSource(l, n);
+      if (elm.contains(l, n + "_nModellingHypotheses")) {
+        d.hypotheses = elm.getSupportedModellingHypotheses(l, n);
+      }
+      descriptions.push_back(std::move(d));
+    }
+    return descriptions;
+  }  // end of getEntryPointsDescriptions
+
+  std::vector<EntryPointDescription> getIndexedEntryPointsDescriptions(
+      const std::string& d, const std::size_t n) {
+    namespace fs = std::filesystem;
+    raise_if(!fs::is_directory(d),
+             "getIndexedEntryPointsDescriptions: '" + d +
+                 "' is not a directory");
+    const auto index_file =
+        (fs::path(d) / EntryPointsIndexFileName).string();
+    const auto indexed_libraries = readEntryPointsIndex(index_file);
+    // list of the libraries of the directory
+    auto libraries = std::map<std::string, IndexedLibrary>{};
+    auto outdated = std::vector<IndexedLibrary*>{};
+    for (const auto& e : fs::directory_iterator(d)) {
+      auto ec = std::error_code{};
+      const auto f = e.path().filename().string();
+      if ((!isSharedLibrary(f)) || (!e.is_regular_file(ec))) {
+        continue;
+      }
+      auto l = IndexedLibrary{};
+      l.file = f;
+      l.size = e.file_size(ec);
+      l.mtime = static_cast<long long>(
+          e.last_write_time(ec).time_since_epoch().count());
+      if (ec) {
+        continue;
+      }
+      const auto p = indexed_libraries.find(f);
+      if ((p != indexed_libraries.end()) && (p->second.size == l.size) &&
+          (p->second.mtime == l.mtime)) {
+        libraries[f] = p->second;
+      } else {
+        libraries[f] = std::move(l);
+        outdated.push_back(&libraries[f]);
+      }
+    }
+    // scanning the outdated libraries
+    if (!outdated.empty()) {
+      auto next = std::atomic<std::size_t>{0};
+      auto scan = [&d, &outdated, &next] {
+        for (auto i = next++; i < outdated.size(); i = next++) {
+          auto& l = *(outdated[i]);
+          try {
+            l.entry_points =
+                getEntryPointsDescriptions((fs::path(d) / l.file).string());
+          } catch (...) {
+            // libraries which can't be loaded are indexed without entry
+            // points
+            l.entry_points.clear();
+          }
+        }
+      };
+      const auto nthreads = std::min(
+          outdated.size(),
+          n != 0 ? n
+                 : std::max(std::size_t{std::thread::hardware_concurrency()},
+                            std::size_t{1}));
+      auto threads = std::vector<std::thread>{};
+      for (std::size_t i = 1; i < nthreads; ++i) {
+        threads.emplace_back(scan);
+      }
+      scan();
+      for (auto& t : threads) {
+        t.join();
+      }
+    }
+    if ((!outdated.empty()) ||
+        (libraries.size() != indexed_libraries.size())) {
+      writeEntryPointsIndex(index_file, libraries);
+    }
+    auto descriptions = std::vector<EntryPointDescription>{};
+    for (const auto& [f, l] : libraries) {
+      const auto path = (fs::path(d) / f).string();
+      for (auto e : l.entry_points) {
+        e.library = path;
+        descriptions.push_back(std::move(e));
+      }
+    }
+    return descriptions;
+  }  // end of getIndexedEntryPointsDescriptions
+
+}  // end of namespace tfel::system
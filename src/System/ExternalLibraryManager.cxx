@@ -11,10 +11,13 @@
  * project under specific licensing conditions.
  */
 
+#include <mutex>
 #include <cctype>
 #include <cstring>
 #include <fstream>
 #include <stdexcept>
+#include <string_view>
+#include <shared_mutex>
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
 #ifndef NOMINMAX
 #define NOMINMAX
@@ -116,6 +119,111 @@ namespace tfel::system {
     return r;
   }  // end of decomposeVariableName
 
+  /*!
+   * \return the key used to cache information about an entry point
+   * \param[in] l: library
+   * \param[in] f: entry point
+   * \param[in] h: modelling hypothesis
+   * \param[in] n: name of the information
+   */
+  static std::string ExternalLibraryManagerCacheKey(const std::string& l,
+                                                    const std::string& f,
+                                                    const std::string& h,
+                                                    const std::string& n) {
+    return l + '\n' + f + '\n' + h + '\n' + n;
+  }  // end of ExternalLibraryManagerCacheKey
+
+  /*!
+   * \brief remove all the entries associated with a library from a cache
+   * \param[in,out] c: cache
+   * \param[in] l: library
+   */
+  template <typename Cache>
+  static void ExternalLibraryManagerClearCache(Cache& c, const std::string& l) {
+    const auto prefix = l + '\n';
+    auto p = c.lower_bound(prefix);
+    while (p != c.end()) {
+      if (p->first.compare(0, prefix.size(), prefix) != 0) {
+        break;
+      }
+      p = c.erase(p);
+    }
+  }  // end of ExternalLibraryManagerClearCache
+
+  /*!
+   * \brief decode the metadata exported by `MFront` for an entry point.
+   *
+   * The metadata are stored in a single string made of lines separated
+   * by `\n`. The first line gives the version of the format. Each of
+   * the following lines describes an array of names (starting with `n`)
+   * or an array of types (starting with `t`), followed by the name of the
+   * array, the number of values and the values, all separated by spaces.
+   *
+   * \return false if the version of the format is not supported
+   * \param[out] names: arrays of names
+   * \param[out] types: arrays of types
+   * \param[in] m: metadata
+   */
+  static bool ExternalLibraryManagerDecodeMetadata(
+      std::map<std::string, std::vector<std::string>>& names,
+      std::map<std::string, std::vector<int>>& types,
+      const std::string_view m) {
+    auto throw_if = [](const bool c, const std::string& msg) {
+      raise_if(c, "ExternalLibraryManagerDecodeMetadata: " + msg);
+    };
+    auto p = std::string_view::size_type{};
+    auto next = [&m, &p]() -> std::string_view {
+      while ((p != m.size()) && ((m[p] == ' ') || (m[p] == '\n'))) {
+        ++p;
+      }
+      const auto b = p;
+      while ((p != m.size()) && (m[p] != ' ') && (m[p] != '\n')) {
+        ++p;
+      }
+      return m.substr(b, p - b);
+    };
+    auto read_size = [&next, &throw_if] {
+      const auto t = next();
+      throw_if(t.empty(), "unexpected end of metadata");
+      auto n = std::size_t{};
+      for (const auto c : t) {
+        throw_if(!std::isdigit(c), "invalid size '" + std::string{t} + "'");
+        n = 10 * n + static_cast<std::size_t>(c - '0');
+      }
+      return n;
+    };
+    if ((next() != "mfront-metadata") || (next() != "1")) {
+      return false;
+    }
+    while (true) {
+      const auto k = next();
+      if (k.empty()) {
+        break;
+      }
+      throw_if((k != "n") && (k != "t"),
+               "invalid record type '" + std::string{k} + "'");
+      const auto a = std::string{next()};
+      throw_if(a.empty(), "unexpected end of metadata");
+      const auto n = read_size();
+      if (k == "n") {
+        auto& values = names[a];
+        values.reserve(n);
+        for (std::size_t i = 0; i != n; ++i) {
+          const auto v = next();
+          throw_if(v.empty(), "unexpected end of metadata");
+          values.emplace_back(v);
+        }
+      } else {
+        auto& values = types[a];
+        values.reserve(n);
+        for (std::size_t i = 0; i != n; ++i) {
+          values.push_back(static_cast<int>(read_size()));
+        }
+      }
+    }
+    return true;
+  }  // end of ExternalLibraryManagerDecodeMetadata
+
   ExternalLibraryManager& ExternalLibraryManager::getExternalLibraryManager() {
     static ExternalLibraryManager elm;
     return elm;
@@ -257,27 +365,70 @@ namespace tfel::system {
   void*
 #endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
   ExternalLibraryManager::loadLibrary(const std::string& name, const bool b) {
-    auto p = this->librairies.find(name);
-    if (p == librairies.end()) {
-      // this library has not been
-      auto r = try_open(name);
-      auto lib = r.first;
-      raise_if((lib == nullptr) && (!b),
-               "ExternalLibraryManager::loadLibrary:"
-               " library '" +
-                   name +
-                   "' could not be loaded, "
-                   "(" +
-                   getErrorMessage() + ")");
-      if ((lib == nullptr) && (b)) {
-        return lib;
+    {
+      // fast path: the library has already been loaded
+      std::shared_lock<std::shared_mutex> lock(this->mutex);
+      const auto p = this->librairies.find(name);
+      if (p != this->librairies.end()) {
+        return p->second;
       }
-      this->librairies.insert({name, lib});
+    }
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+    // the library may have been loaded by another thread in the meantime
+    const auto p = this->librairies.find(name);
+    if (p != this->librairies.end()) {
+      return p->second;
+    }
+    auto r = try_open(name);
+    auto lib = r.first;
+    raise_if((lib == nullptr) && (!b),
+             "ExternalLibraryManager::loadLibrary:"
+             " library '" +
+                 name +
+                 "' could not be loaded, "
+                 "(" +
+                 getErrorMessage() + ")");
+    if ((lib == nullptr) && (b)) {
       return lib;
     }
-    return p->second;
+    this->librairies.insert({name, lib});
+    return lib;
   }  // end of loadLibrary
 
+  void ExternalLibraryManager::unloadLibrary(const std::string& name) {
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+    const auto p = this->librairies.find(name);
+    if (p == this->librairies.end()) {
+      return;
+    }
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    const auto s = ::FreeLibrary(p->second) != 0;
+#else
+    const auto s = ::dlclose(p->second) == 0;
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    this->librairies.erase(p);
+    ExternalLibraryManagerClearCache(this->cached_names, name);
+    ExternalLibraryManagerClearCache(this->cached_types, name);
+    ExternalLibraryManagerClearCache(this->decoded_metadata, name);
+    raise_if(!s,
+             "ExternalLibraryManager::unloadLibrary: "
+             "library '" +
+                 name +
+                 "' could not be unloaded "
+                 "(" +
+                 getErrorMessage() + ")");
+  }  // end of unloadLibrary
+
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+  HINSTANCE__*
+#else
+  void*
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+  ExternalLibraryManager::reloadLibrary(const std::string& name) {
+    this->unloadLibrary(name);
+    return this->loadLibrary(name);
+  }  // end of reloadLibrary
+
   std::vector<std::string> ExternalLibraryManager::getEntryPoints(
       const std::string& l) {
     auto ends_with = [](const std::string& s1, const std::string& s2) {
@@ -1070,6 +1221,20 @@ namespace tfel::system {
     return fct;
   }
 
+  GenericMaterialPropertyArrayPtr
+  ExternalLibraryManager::getGenericMaterialPropertyArrayFunction(
+      const std::string& l, const std::string& f) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::tfel_getGenericMaterialPropertyArrayFunction(
+        lib, (f + "_array").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::getGenericMaterialPropertyArrayFunction: "
+             "could not load the array entry point of the generic material "
+             "property '" +
+                 f + "' (" + getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericMaterialPropertyArrayFunction
+
   GenericBehaviourFctPtr ExternalLibraryManager::getGenericBehaviourFunction(
       const std::string& l, const std::string& f) {
     const auto lib = this->loadLibrary(l);
@@ -1528,6 +1693,14 @@ namespace tfel::system {
 
   std::vector<std::string> ExternalLibraryManager::getArrayOfStrings(
       const std::string& l, const std::string& e, const std::string& n) {
+    const auto key = ExternalLibraryManagerCacheKey(l, e, "", "array:" + n);
+    {
+      std::shared_lock<std::shared_mutex> lock(this->mutex);
+      const auto p = this->cached_names.find(key);
+      if (p != this->cached_names.end()) {
+        return p->second;
+      }
+    }
     const auto lib = this->loadLibrary(l);
     auto nb = -1;
     nb = ::tfel_getUnsignedShort(lib, (e + "_n" + n).c_str());
@@ -1542,7 +1715,10 @@ namespace tfel::system {
              "variables names could not be read "
              "(" +
                  getErrorMessage() + ")");
-    return std::vector<std::string>(res, res + nb);
+    auto names = std::vector<std::string>(res, res + nb);
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+    this->cached_names.insert({key, names});
+    return names;
   }  // end of getArrayOfStrings
 
   void ExternalLibraryManager::getUMATNames(std::vector<std::string>& vars,
@@ -1553,6 +1729,23 @@ namespace tfel::system {
     if (!h.empty()) {
       ExternalLibraryManagerCheckModellingHypothesisName(h);
     }
+    const auto key = ExternalLibraryManagerCacheKey(l, f, h, n);
+    {
+      std::shared_lock<std::shared_mutex> lock(this->mutex);
+      const auto p = this->cached_names.find(key);
+      if (p != this->cached_names.end()) {
+        vars.insert(vars.end(), p->second.begin(), p->second.end());
+        return;
+      }
+    }
+    if (this->decodeMetadata(l, f, h)) {
+      std::shared_lock<std::shared_mutex> lock(this->mutex);
+      const auto p = this->cached_names.find(key);
+      if (p != this->cached_names.end()) {
+        vars.insert(vars.end(), p->second.begin(), p->second.end());
+        return;
+      }
+    }
     const auto lib = this->loadLibrary(l);
     auto nb = -1;
     if (!h.empty()) {
@@ -1578,7 +1771,10 @@ namespace tfel::system {
              "variables names could not be read "
              "(" +
                  getErrorMessage() + ")");
-    std::copy(res, res + nb, std::back_inserter(vars));
+    const auto names = std::vector<std::string>(res, res + nb);
+    vars.insert(vars.end(), names.begin(), names.end());
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+    this->cached_names.insert({key, names});
   }  // end of getUMATNames
 
   void ExternalLibraryManager::getUMATTypes(std::vector<int>& types,
@@ -1589,6 +1785,23 @@ namespace tfel::system {
     if (!h.empty()) {
       ExternalLibraryManagerCheckModellingHypothesisName(h);
     }
+    const auto key = ExternalLibraryManagerCacheKey(l, f, h, n);
+    {
+      std::shared_lock<std::shared_mutex> lock(this->mutex);
+      const auto p = this->cached_types.find(key);
+      if (p != this->cached_types.end()) {
+        types.insert(types.end(), p->second.begin(), p->second.end());
+        return;
+      }
+    }
+    if (this->decodeMetadata(l, f, h)) {
+      std::shared_lock<std::shared_mutex> lock(this->mutex);
+      const auto p = this->cached_types.find(key);
+      if (p != this->cached_types.end()) {
+        types.insert(types.end(), p->second.begin(), p->second.end());
+        return;
+      }
+    }
     const auto lib = this->loadLibrary(l);
     auto nb = -1;
     if (!h.empty()) {
@@ -1615,9 +1828,49 @@ namespace tfel::system {
              "variables names could not be read "
              "(" +
                  getErrorMessage() + ")");
-    std::copy(res, res + nb, std::back_inserter(types));
+    const auto values = std::vector<int>(res, res + nb);
+    types.insert(types.end(), values.begin(), values.end());
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+    this->cached_types.insert({key, values});
   }  // end of getUMATTypes
 
+  bool ExternalLibraryManager::decodeMetadata(const std::string& l,
+                                              const std::string& f,
+                                              const std::string& h) {
+    const auto key = ExternalLibraryManagerCacheKey(l, f, h, "");
+    {
+      std::shared_lock<std::shared_mutex> lock(this->mutex);
+      const auto p = this->decoded_metadata.find(key);
+      if (p != this->decoded_metadata.end()) {
+        return p->second;
+      }
+    }
+    auto m = std::string{};
+    if (!h.empty()) {
+      m = this->getStringIfDefined(l, f + "_" + h + "_mfront_metadata");
+    }
+    if (m.empty()) {
+      m = this->getStringIfDefined(l, f + "_mfront_metadata");
+    }
+    auto names = std::map<std::string, std::vector<std::string>>{};
+    auto types = std::map<std::string, std::vector<int>>{};
+    const auto found =
+        (!m.empty()) && (ExternalLibraryManagerDecodeMetadata(names, types, m));
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+    if (found) {
+      for (auto& [n, v] : names) {
+        this->cached_names.insert(
+            {ExternalLibraryManagerCacheKey(l, f, h, n), std::move(v)});
+      }
+      for (auto& [n, v] : types) {
+        this->cached_types.insert(
+            {ExternalLibraryManagerCacheKey(l, f, h, n), std::move(v)});
+      }
+    }
+    this->decoded_metadata.insert({key, found});
+    return found;
+  }  // end of decodeMetadata
+
   bool ExternalLibraryManager::isUMATBehaviourUsableInPurelyImplicitResolution(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
@@ -17,6 +17,10 @@
 #endif
 #endif /* __CYGWIN__ */
 
+#include <set>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <iostream>
 #include <cstdlib>
 #include <stdexcept>
@@ -31,6 +35,17 @@
 #include <unistd.h>
 #include <sys/wait.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <pthread.h>
+#include <condition_variable>
+
+#ifdef __APPLE__
+#include <crt_externs.h>
+#define environ (*_NSGetEnviron())
+#else
+extern char** environ;
+#endif
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/System/System.hxx"
@@ -572,6 +587,8 @@ namespace tfel::system {
 
   ProcessManager::~ProcessManager() {
     using namespace std;
+    // cancelling the asynchronous commands
+    this->asynchronous_commands.reset();
     auto& signalManager = SignalManager::getSignalManager();
     vector<Process>::iterator p;
     map<ProcessId, StreamId>::iterator p2;
@@ -710,6 +727,455 @@ namespace tfel::system {
     }
   }  // end of ProcessManager::execute
 
+  bool ProcessManager::AsynchronousCommandResult::succeeded() const {
+    return (this->exitStatus) && (this->exitValue == EXIT_SUCCESS) &&
+           (!this->timedOut) && (!this->cancelled);
+  }  // end of succeeded
+
+  /*!
+   * \brief structure handling the asynchronous commands.
+   *
+   * The processes are launched by a dedicated thread using `posix_spawnp`,
+   * which, contrary to `fork`, can safely be called in a multi-threaded
+   * program. This thread waits for the outputs of the processes using
+   * `poll` on non-blocking pipes and periodically checks if the processes
+   * exited using `waitpid` with the `WNOHANG` option. All signals are
+   * blocked in this thread, so that the signal handlers of the
+   * `ProcessManager` class are always called in the other threads.
+   */
+  struct ProcessManager::AsynchronousCommandsHandler {
+    //! \brief a simple alias
+    using clock = std::chrono::steady_clock;
+    //! \brief a command waiting to be launched
+    struct PendingCommand {
+      //! \brief identifier
+      AsynchronousCommandId id;
+      //! \brief arguments
+      std::vector<std::string> arguments;
+      //! \brief environment of the process
+      std::vector<std::string> environment;
+      //! \brief description of the command
+      AsynchronousCommand command;
+      //! \brief result
+      std::promise<AsynchronousCommandResult> result;
+    };
+    //! \brief a running command
+    struct RunningCommand {
+      //! \brief identifier
+      AsynchronousCommandId id;
+      //! \brief process id
+      pid_t pid = -1;
+      //! \brief file descriptor associated with the standard output
+      int out = -1;
+      //! \brief file descriptor associated with the standard error
+      int err = -1;
+      //! \brief true if a deadline is defined
+      bool has_deadline = false;
+      //! \brief deadline
+      clock::time_point deadline;
+      //! \brief result, updated during the execution
+      AsynchronousCommandResult r;
+      //! \brief result
+      std::promise<AsynchronousCommandResult> result;
+    };
+    AsynchronousCommandsHandler();
+    ~AsynchronousCommandsHandler();
+    //! \brief wake up the worker thread
+    void wakeUp();
+    //! \brief main loop of the worker thread
+    void run();
+    /*!
+     * \brief launch a pending command
+     * \param[in] c: command
+     */
+    void launch(PendingCommand&);
+    /*!
+     * \brief read the available data of an output of a command. The
+     * file descriptor is closed and set to -1 at the end of the file.
+     * \param[in,out] fd: file descriptor
+     * \param[out] o: output
+     */
+    static void readOutput(int&, std::string&);
+    //! \brief mutex protecting the following members
+    std::mutex m;
+    //! \brief condition variable used to signal the end of a command
+    std::condition_variable finished;
+    //! \brief pending commands
+    std::deque<PendingCommand> pending;
+    //! \brief commands to be cancelled
+    std::set<AsynchronousCommandId> cancellations;
+    //! \brief number of commands which are either pending or running
+    std::size_t nactive = 0;
+    //! \brief identifier of the next command
+    AsynchronousCommandId next_id = 0;
+    //! \brief maximum number of running commands
+    std::size_t max_running_commands;
+    //! \brief boolean stating if the worker thread shall stop
+    bool stop = false;
+    //! \brief running commands (only accessed by the worker thread)
+    std::vector<RunningCommand> running;
+    //! \brief pipe used to wake up the worker thread
+    int wakeup[2] = {-1, -1};
+    //! \brief worker thread
+    std::thread worker;
+  };  // end of struct AsynchronousCommandsHandler
+
+  static void ProcessManager_setFileDescriptorFlags(const int fd,
+                                                    const bool nonblocking) {
+    ::fcntl(fd, F_SETFD, ::fcntl(fd, F_GETFD) | FD_CLOEXEC);
+    if (nonblocking) {
+      ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+    }
+  }  // end of ProcessManager_setFileDescriptorFlags
+
+  ProcessManager::AsynchronousCommandsHandler::AsynchronousCommandsHandler()
+      : max_running_commands(
+            std::max(std::thread::hardware_concurrency(), 1u)) {
+    if (::pipe(this->wakeup) == -1) {
+      systemCall::throwSystemError(
+          "ProcessManager::AsynchronousCommandsHandler: "
+          "pipe creation failed",
+          errno);
+    }
+    ProcessManager_setFileDescriptorFlags(this->wakeup[0], true);
+    ProcessManager_setFileDescriptorFlags(this->wakeup[1], true);
+    this->worker = std::thread([this] { this->run(); });
+  }  // end of AsynchronousCommandsHandler
+
+  void ProcessManager::AsynchronousCommandsHandler::wakeUp() {
+    const char c = 'w';
+    // the pipe may be full, which is harmless
+    static_cast<void>(::write(this->wakeup[1], &c, 1u));
+  }  // end of wakeUp
+
+  void ProcessManager::AsynchronousCommandsHandler::readOutput(
+      int& fd, std::string& o) {
+    if (fd == -1) {
+      return;
+    }
+    char buffer[4096];
+    while (true) {
+      const auto n = ::read(fd, buffer, sizeof(buffer));
+      if (n > 0) {
+        o.append(buffer, static_cast<std::string::size_type>(n));
+        continue;
+      }
+      if ((n == -1) && (errno == EINTR)) {
+        continue;
+      }
+      if ((n == -1) && (errno == EAGAIN)) {
+        return;
+      }
+      // end of file or error
+      ::close(fd);
+      fd = -1;
+      return;
+    }
+  }  // end of readOutput
+
+  void ProcessManager::AsynchronousCommandsHandler::launch(
+      PendingCommand& c) {
+    auto throw_error = [](const std::string& msg, const int e) {
+      systemCall::throwSystemError(
+          "ProcessManager::executeAsynchronously: " + msg, e);
+    };
+    int out[2];
+    int err[2];
+    if (::pipe(out) == -1) {
+      throw_error("pipe creation failed", errno);
+    }
+    if (::pipe(err) == -1) {
+      const auto e = errno;
+      ::close(out[0]);
+      ::close(out[1]);
+      throw_error("pipe creation failed", e);
+    }
+    for (const auto fd : {out[0], out[1], err[0], err[1]}) {
+      ProcessManager_setFileDescriptorFlags(fd, false);
+    }
+    ProcessManager_setFileDescriptorFlags(out[0], true);
+    ProcessManager_setFileDescriptorFlags(err[0], true);
+    auto argv = std::vector<char*>{};
+    for (auto& a : c.arguments) {
+      argv.push_back(a.data());
+    }
+    argv.push_back(nullptr);
+    auto envp = std::vector<char*>{};
+    for (auto& e : c.environment) {
+      envp.push_back(e.data());
+    }
+    envp.push_back(nullptr);
+    const auto& in = c.command.input_file.empty() ? std::string{"/dev/null"}
+                                                  : c.command.input_file;
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, in.c_str(),
+                                     O_RDONLY, 0);
+    posix_spawn_file_actions_adddup2(&actions, out[1], STDOUT_FILENO);
+    posix_spawn_file_actions_adddup2(&actions, err[1], STDERR_FILENO);
+    // restoring a default signal mask in the child
+    posix_spawnattr_t attributes;
+    posix_spawnattr_init(&attributes);
+    sigset_t mask;
+    sigemptyset(&mask);
+    posix_spawnattr_setsigmask(&attributes, &mask);
+    posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETSIGMASK);
+    pid_t pid;
+    const auto status = ::posix_spawnp(&pid, argv[0], &actions, &attributes,
+                                       argv.data(), envp.data());
+    posix_spawn_file_actions_destroy(&actions);
+    posix_spawnattr_destroy(&attributes);
+    ::close(out[1]);
+    ::close(err[1]);
+    if (status != 0) {
+      ::close(out[0]);
+      ::close(err[0]);
+      throw_error("can't execute command '" + c.command.command + "'",
+                  status);
+    }
+    auto r = RunningCommand{};
+    r.id = c.id;
+    r.pid = pid;
+    r.out = out[0];
+    r.err = err[0];
+    r.r.command = c.command.command;
+    if (c.command.timeout.count() > 0) {
+      r.has_deadline = true;
+      r.deadline = clock::now() + c.command.timeout;
+    }
+    r.result = std::move(c.result);
+    this->running.push_back(std::move(r));
+  }  // end of launch
+
+  void ProcessManager::AsynchronousCommandsHandler::run() {
+    // signals are treated by the other threads
+    sigset_t mask;
+    sigfillset(&mask);
+    pthread_sigmask(SIG_BLOCK, &mask, nullptr);
+    auto finalize = [this](RunningCommand& r) {
+      r.result.set_value(std::move(r.r));
+      std::lock_guard<std::mutex> lock(this->m);
+      --(this->nactive);
+      this->finished.notify_all();
+    };
+    while (true) {
+      auto launched = std::vector<PendingCommand>{};
+      auto cancelled = std::vector<PendingCommand>{};
+      {
+        std::lock_guard<std::mutex> lock(this->m);
+        if (this->stop) {
+          if ((this->pending.empty()) && (this->running.empty())) {
+            break;
+          }
+          for (const auto& c : this->pending) {
+            this->cancellations.insert(c.id);
+          }
+          for (const auto& r : this->running) {
+            this->cancellations.insert(r.id);
+          }
+        }
+        for (const auto id : this->cancellations) {
+          const auto p = std::find_if(
+              this->pending.begin(), this->pending.end(),
+              [id](const PendingCommand& c) { return c.id == id; });
+          if (p != this->pending.end()) {
+            cancelled.push_back(std::move(*p));
+            this->pending.erase(p);
+            continue;
+          }
+          for (auto& r : this->running) {
+            if ((r.id == id) && (!r.r.cancelled)) {
+              r.r.cancelled = true;
+              ::kill(r.pid, SIGKILL);
+            }
+          }
+        }
+        this->cancellations.clear();
+        while ((!this->pending.empty()) &&
+               (this->running.size() + launched.size() <
+                this->max_running_commands)) {
+          launched.push_back(std::move(this->pending.front()));
+          this->pending.pop_front();
+        }
+      }
+      for (auto& c : cancelled) {
+        auto r = RunningCommand{};
+        r.r.command = c.command.command;
+        r.r.cancelled = true;
+        r.result = std::move(c.result);
+        finalize(r);
+      }
+      for (auto& c : launched) {
+        try {
+          this->launch(c);
+        } catch (...) {
+          c.result.set_exception(std::current_exception());
+          std::lock_guard<std::mutex> lock(this->m);
+          --(this->nactive);
+          this->finished.notify_all();
+        }
+      }
+      // waiting for the outputs of the processes
+      auto fds = std::vector<pollfd>{};
+      fds.push_back({this->wakeup[0], POLLIN, 0});
+      // the processes which closed their outputs are checked frequently
+      auto timeout = this->running.empty() ? -1 : 100;
+      const auto now = clock::now();
+      for (const auto& r : this->running) {
+        if (r.out != -1) {
+          fds.push_back({r.out, POLLIN, 0});
+        }
+        if (r.err != -1) {
+          fds.push_back({r.err, POLLIN, 0});
+        }
+        if ((r.out == -1) && (r.err == -1)) {
+          timeout = std::min(timeout, 10);
+        }
+        if (r.has_deadline) {
+          const auto d = std::chrono::duration_cast<std::chrono::milliseconds>(
+                             r.deadline - now)
+                             .count();
+          timeout = std::min(
+              timeout, static_cast<int>(std::max(d, decltype(d){0}) + 1));
+        }
+      }
+      if (::poll(fds.data(), static_cast<nfds_t>(fds.size()), timeout) ==
+          -1) {
+        if (errno != EINTR) {
+          systemCall::throwSystemError(
+              "ProcessManager::AsynchronousCommandsHandler: poll failed",
+              errno);
+        }
+      }
+      char buffer[64];
+      while (::read(this->wakeup[0], buffer, sizeof(buffer)) > 0) {
+      }
+      // reading outputs and checking the state of the processes
+      for (auto p = this->running.begin(); p != this->running.end();) {
+        readOutput(p->out, p->r.output);
+        readOutput(p->err, p->r.error);
+        int status;
+        if (::waitpid(p->pid, &status, WNOHANG) == p->pid) {
+          if (::processManager_wifexited(status)) {
+            p->r.exitStatus = true;
+            p->r.exitValue = ::processManager_wexitstatus(status);
+          }
+          // the outputs of processes launched by the command may still be
+          // opened: they are not waited for
+          for (auto* fd : {&(p->out), &(p->err)}) {
+            if (*fd != -1) {
+              ::close(*fd);
+              *fd = -1;
+            }
+          }
+          finalize(*p);
+          p = this->running.erase(p);
+          continue;
+        }
+        if ((p->has_deadline) && (!p->r.timedOut) &&
+            (clock::now() >= p->deadline)) {
+          p->r.timedOut = true;
+          ::kill(p->pid, SIGKILL);
+        }
+        ++p;
+      }
+    }
+  }  // end of run
+
+  ProcessManager::AsynchronousCommandsHandler::~AsynchronousCommandsHandler() {
+    // the pending and running commands are cancelled by the worker thread
+    {
+      std::lock_guard<std::mutex> lock(this->m);
+      this->stop = true;
+    }
+    this->wakeUp();
+    this->worker.join();
+    ::close(this->wakeup[0]);
+    ::close(this->wakeup[1]);
+  }  // end of ~AsynchronousCommandsHandler
+
+  ProcessManager::AsynchronousCommandsHandler&
+  ProcessManager::getAsynchronousCommandsHandler() {
+    if (this->asynchronous_commands == nullptr) {
+      this->asynchronous_commands =
+          std::make_unique<AsynchronousCommandsHandler>();
+    }
+    return *(this->asynchronous_commands);
+  }  // end of getAsynchronousCommandsHandler
+
+  ProcessManager::AsynchronousCommandHandle
+  ProcessManager::executeAsynchronously(const AsynchronousCommand& c) {
+    raise_if<SystemError>(c.command.empty(),
+                          "ProcessManager::executeAsynchronously: "
+                          "empty command");
+    auto& h = this->getAsynchronousCommandsHandler();
+    auto pc = AsynchronousCommandsHandler::PendingCommand{};
+    std::istringstream args(c.command);
+    std::copy(std::istream_iterator<std::string>(args),
+              std::istream_iterator<std::string>(),
+              std::back_inserter(pc.arguments));
+    // the environment is built here since the environment of the
+    // process can't be safely accessed in the worker thread
+    for (auto e = environ; *e != nullptr; ++e) {
+      const auto v = std::string{*e};
+      const auto name = v.substr(0, v.find('='));
+      if (c.environment.find(name) == c.environment.end()) {
+        pc.environment.push_back(v);
+      }
+    }
+    for (const auto& [name, value] : c.environment) {
+      pc.environment.push_back(name + '=' + value);
+    }
+    pc.command = c;
+    auto r = AsynchronousCommandHandle{};
+    r.result = pc.result.get_future();
+    {
+      std::lock_guard<std::mutex> lock(h.m);
+      pc.id = h.next_id;
+      r.id = h.next_id;
+      ++(h.next_id);
+      ++(h.nactive);
+      h.pending.push_back(std::move(pc));
+    }
+    h.wakeUp();
+    return r;
+  }  // end of executeAsynchronously
+
+  void ProcessManager::setMaximumNumberOfConcurrentCommands(
+      const std::size_t n) {
+    raise_if<SystemError>(n == 0,
+                          "ProcessManager::"
+                          "setMaximumNumberOfConcurrentCommands: "
+                          "invalid number of commands");
+    auto& h = this->getAsynchronousCommandsHandler();
+    {
+      std::lock_guard<std::mutex> lock(h.m);
+      h.max_running_commands = n;
+    }
+    h.wakeUp();
+  }  // end of setMaximumNumberOfConcurrentCommands
+
+  void ProcessManager::cancel(const AsynchronousCommandId id) {
+    if (this->asynchronous_commands == nullptr) {
+      return;
+    }
+    auto& h = *(this->asynchronous_commands);
+    {
+      std::lock_guard<std::mutex> lock(h.m);
+      h.cancellations.insert(id);
+    }
+    h.wakeUp();
+  }  // end of cancel
+
+  void ProcessManager::waitAsynchronousCommands() {
+    if (this->asynchronous_commands == nullptr) {
+      return;
+    }
+    auto& h = *(this->asynchronous_commands);
+    std::unique_lock<std::mutex> lock(h.m);
+    h.finished.wait(lock, [&h] { return h.nactive == 0; });
+  }  // end of waitAsynchronousCommands
+
   std::vector<ProcessManager::Process>::reverse_iterator
   ProcessManager::findProcess(const ProcessId pid) {
     auto p = this->processes.rbegin();
@@ -738,6 +1204,9 @@ namespace tfel::system {
 
   void ProcessManager::cleanUp() {
     // clean up
+    // the worker thread handling the asynchronous commands does not exist
+    // in a child process: the handler is thus deliberately leaked
+    static_cast<void>(this->asynchronous_commands.release());
     this->processes.clear();
     this->inputs.clear();
     this->outputs.clear();
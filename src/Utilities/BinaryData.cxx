@@ -0,0 +1,216 @@
+/*!
+ * \file   src/Utilities/BinaryData.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/BinaryData.hxx"
+
+namespace tfel::utilities {
+
+  //! \brief string at the beginning of binary data files
+  static constexpr std::string_view BinaryDataMagicString = "TFEL-BINARY-DATA";
+  //! \brief version of the binary data format
+  static constexpr std::uint32_t BinaryDataFormatVersion = 1;
+  //! \brief marker used to detect the endianness
+  static constexpr std::uint32_t BinaryDataEndiannessMarker = 0x01020304;
+
+  template <typename T>
+  static void BinaryDataWriteRaw(std::ostream& os, const T& v) {
+    os.write(reinterpret_cast<const char*>(&v), sizeof(T));
+  }  // end of BinaryDataWriteRaw
+
+  static void BinaryDataWriteString(std::ostream& os, const std::string& s) {
+    BinaryDataWriteRaw(os, static_cast<std::uint32_t>(s.size()));
+    os.write(s.data(), static_cast<std::streamsize>(s.size()));
+  }  // end of BinaryDataWriteString
+
+  BinaryDataWriter::BinaryDataWriter(const std::string& f,
+                                     const BinaryDataHeader& h,
+                                     const std::size_t n)
+      : out(f, std::ios::binary),
+        ncolumns(h.legends.size()),
+        chunk_size(n) {
+    auto throw_if = [](const bool b, const std::string& m) {
+      raise_if(b, "BinaryDataWriter::BinaryDataWriter: " + m);
+    };
+    throw_if(!this->out, "can't open file '" + f + "'");
+    throw_if(this->chunk_size == 0, "invalid chunk size");
+    throw_if((!h.units.empty()) && (h.units.size() != h.legends.size()),
+             "the number of units does not match the number of legends");
+    this->out.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    this->out.write(BinaryDataMagicString.data(),
+                    static_cast<std::streamsize>(BinaryDataMagicString.size()));
+    BinaryDataWriteRaw(this->out, BinaryDataFormatVersion);
+    BinaryDataWriteRaw(this->out, BinaryDataEndiannessMarker);
+    BinaryDataWriteRaw(this->out, static_cast<std::int32_t>(h.precision));
+    BinaryDataWriteRaw(this->out, static_cast<std::uint32_t>(this->ncolumns));
+    for (std::size_t i = 0; i != this->ncolumns; ++i) {
+      BinaryDataWriteString(this->out, h.legends[i]);
+      BinaryDataWriteString(this->out, h.units.empty() ? "" : h.units[i]);
+    }
+    BinaryDataWriteRaw(this->out,
+                       static_cast<std::uint32_t>(h.preamble.size()));
+    for (const auto& l : h.preamble) {
+      BinaryDataWriteString(this->out, l);
+    }
+    this->buffer.resize(this->ncolumns * this->chunk_size);
+  }  // end of BinaryDataWriter
+
+  void BinaryDataWriter::write(const std::vector<double>& r) {
+    raise_if(r.size() != this->ncolumns,
+             "BinaryDataWriter::write: invalid number of values (" +
+                 std::to_string(r.size()) + " given, " +
+                 std::to_string(this->ncolumns) + " expected)");
+    for (std::size_t c = 0; c != this->ncolumns; ++c) {
+      this->buffer[c * this->chunk_size + this->nrows] = r[c];
+    }
+    if (++(this->nrows) == this->chunk_size) {
+      this->writeChunk();
+    }
+  }  // end of write
+
+  void BinaryDataWriter::writeChunk() {
+    if (this->nrows == 0) {
+      return;
+    }
+    BinaryDataWriteRaw(this->out, static_cast<std::uint64_t>(this->nrows));
+    for (std::size_t c = 0; c != this->ncolumns; ++c) {
+      this->out.write(
+          reinterpret_cast<const char*>(this->buffer.data() +
+                                        c * this->chunk_size),
+          static_cast<std::streamsize>(this->nrows * sizeof(double)));
+    }
+    this->nrows = 0;
+  }  // end of writeChunk
+
+  void BinaryDataWriter::flush() {
+    this->writeChunk();
+    this->out.flush();
+  }  // end of flush
+
+  BinaryDataWriter::~BinaryDataWriter() {
+    try {
+      this->flush();
+    } catch (...) {
+    }
+  }  // end of ~BinaryDataWriter
+
+  bool isBinaryData(const std::string_view d) {
+    return d.substr(0, BinaryDataMagicString.size()) == BinaryDataMagicString;
+  }  // end of isBinaryData
+
+  bool isBinaryDataFile(const std::string& f) {
+    std::ifstream in(f, std::ios::binary);
+    if (!in) {
+      return false;
+    }
+    auto m = std::string(BinaryDataMagicString.size(), '\0');
+    in.read(m.data(), static_cast<std::streamsize>(m.size()));
+    return (in) && (isBinaryData(m));
+  }  // end of isBinaryDataFile
+
+  BinaryDataHeader decodeBinaryData(std::vector<std::vector<double>>& columns,
+                                    const std::string_view d) {
+    auto throw_if = [](const bool b, const std::string& m) {
+      raise_if(b, "decodeBinaryData: " + m);
+    };
+    auto p = std::size_t{};
+    auto read = [&throw_if, &d, &p](void* const v, const std::size_t s) {
+      throw_if(d.size() - p < s, "unexpected end of data");
+      std::memcpy(v, d.data() + p, s);
+      p += s;
+    };
+    auto read_uint32 = [&read] {
+      auto v = std::uint32_t{};
+      read(&v, sizeof(v));
+      return v;
+    };
+    auto read_string = [&read_uint32, &throw_if, &d, &p] {
+      const auto s = static_cast<std::size_t>(read_uint32());
+      throw_if(d.size() - p < s, "unexpected end of data");
+      const auto r = std::string{d.substr(p, s)};
+      p += s;
+      return r;
+    };
+    throw_if(!isBinaryData(d), "invalid data");
+    p = BinaryDataMagicString.size();
+    throw_if(read_uint32() != BinaryDataFormatVersion,
+             "unsupported version of the binary data format");
+    throw_if(read_uint32() != BinaryDataEndiannessMarker,
+             "the data were written on a computer with a different "
+             "endianness");
+    auto h = BinaryDataHeader{};
+    auto precision = std::int32_t{};
+    read(&precision, sizeof(precision));
+    h.precision = static_cast<int>(precision);
+    const auto nc = read_uint32();
+    for (std::uint32_t i = 0; i != nc; ++i) {
+      h.legends.push_back(read_string());
+      h.units.push_back(read_string());
+    }
+    const auto np = read_uint32();
+    for (std::uint32_t i = 0; i != np; ++i) {
+      h.preamble.push_back(read_string());
+    }
+    columns.clear();
+    columns.resize(nc);
+    while (d.size() - p >= sizeof(std::uint64_t)) {
+      auto nr = std::uint64_t{};
+      std::memcpy(&nr, d.data() + p, sizeof(nr));
+      const auto s = static_cast<std::size_t>(nr) * nc * sizeof(double);
+      if (d.size() - p - sizeof(nr) < s) {
+        // truncated chunk
+        break;
+      }
+      p += sizeof(nr);
+      for (auto& c : columns) {
+        const auto n = c.size();
+        c.resize(n + static_cast<std::size_t>(nr));
+        read(c.data() + n, static_cast<std::size_t>(nr) * sizeof(double));
+      }
+    }
+    return h;
+  }  // end of decodeBinaryData
+
+  void convertBinaryDataFileToText(const std::string& i,
+                                   const std::string& o) {
+    std::ifstream in(i, std::ios::binary);
+    raise_if(!in, "convertBinaryDataFileToText: can't open file '" + i + "'");
+    const auto d = std::string{std::istreambuf_iterator<char>{in},
+                               std::istreambuf_iterator<char>{}};
+    auto columns = std::vector<std::vector<double>>{};
+    const auto h = decodeBinaryData(columns, d);
+    std::ofstream out(o);
+    raise_if(!out, "convertBinaryDataFileToText: can't open file '" + o + "'");
+    out.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    if (h.precision > 0) {
+      out.precision(static_cast<std::streamsize>(h.precision));
+    }
+    for (const auto& l : h.preamble) {
+      out << "# " << l << '\n';
+    }
+    const auto nr = columns.empty() ? std::size_t{} : columns[0].size();
+    for (std::size_t r = 0; r != nr; ++r) {
+      for (std::size_t c = 0; c != columns.size(); ++c) {
+        if (c != 0) {
+          out << ' ';
+        }
+        out << columns[c][r];
+      }
+      out << '\n';
+    }
+  }  // end of convertBinaryDataFileToText
+
+}  // end of namespace tfel::utilities
@@ -41,18 +41,16 @@ namespace std {
 
 namespace tfel::utilities {
 
-  static std::pair<std::string::const_iterator, std::string> findSeparator(
-      const std::string::const_iterator p,
-      const std::string::const_iterator pe,
-      const std::vector<std::string> &separators) {
-    const auto w = std::string{p, pe};
-    std::pair<std::string::const_iterator, std::string> r = {pe, ""};
+  static std::pair<std::string::const_iterator, const std::string *>
+  findSeparator(const std::string::const_iterator p,
+                const std::string::const_iterator pe,
+                const std::vector<std::string> &separators) {
+    std::pair<std::string::const_iterator, const std::string *> r = {pe,
+                                                                     nullptr};
     for (const auto &s : separators) {
-      const auto pos = w.find(s);
-      if (pos != std::string::npos) {
-        if (p + pos < r.first) {
-          r = {p + pos, s};
-        }
+      const auto pos = std::search(p, pe, s.begin(), s.end());
+      if (pos < r.first) {
+        r = {pos, &s};
       }
     }
     return r;
@@ -97,11 +95,20 @@ namespace tfel::utilities {
   }  // end of CxxTokenizer::extractNumbers
 
   void CxxTokenizer::openFile(const std::string &f) {
-    std::ifstream file{f};
+    std::ifstream file{f, std::ios::in | std::ios::ate};
     raise_if(!file,
              "CxxTokenizer::openFile: "
              "unable to open file '" +
                  f + "'");
+    // reserving memory for the tokens, based on a rough estimate of the
+    // average number of characters per token, to limit the number of
+    // reallocations of the tokens container
+    const auto size = static_cast<std::streamoff>(file.tellg());
+    if (size > 0) {
+      this->tokens.reserve(this->tokens.size() +
+                           static_cast<size_type>(size / 6));
+    }
+    file.seekg(0);
     auto n = Token::size_type{};
     this->parseStream(file, n, " of file '" + f + "'");
   }
@@ -124,13 +131,15 @@ namespace tfel::utilities {
                                  Token::size_type &n,
                                  const std::string &from) {
     auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::parseStream: " + m);
+      if (b) {
+        raise("CxxTokenizer::parseStream: " + m);
+      }
     };
     try {
+      // the line buffer is reused to avoid a memory allocation per line
+      auto line = std::string{};
       while (!in.eof()) {
         throw_if(!in.good(), "error while parsing stream");
-        throw_if(!in.good(), "error while parsing stream");
-        auto line = std::string{};
         std::getline(in, line);
         ++n;
         try {
@@ -163,9 +172,17 @@ namespace tfel::utilities {
           grave_accent_as_separator(ba) {}  // end of is_separator
     bool operator()(const std::string::value_type &c) const {
       using ctype = std::string::value_type;
-      constexpr std::array<ctype, 24> s = {
-          {'?', ';', '/', '!', '&', '*', '|', '{', '}',  '[',  ']', '(',
-           ')', '%', '=', '^', ',', ':', '<', '>', '\'', '\"', '+', '\\'}};
+      // lookup table of the separators, built once
+      static const auto separators = [] {
+        constexpr std::array<ctype, 24> s = {
+            {'?', ';', '/', '!', '&', '*', '|', '{', '}',  '[',  ']', '(',
+             ')', '%', '=', '^', ',', ':', '<', '>', '\'', '\"', '+', '\\'}};
+        auto t = std::array<bool, 256>{};
+        for (const auto sc : s) {
+          t[static_cast<unsigned char>(sc)] = true;
+        }
+        return t;
+      }();
       if (c == '.') {
         return this->dot_as_separator;
       }
@@ -175,7 +192,7 @@ namespace tfel::utilities {
       if (c == '`') {
         return this->grave_accent_as_separator;
       }
-      return std::find(std::begin(s), std::end(s), c) != std::end(s);
+      return separators[static_cast<unsigned char>(c)];
     }
 
    protected:
@@ -219,7 +236,9 @@ namespace tfel::utilities {
                                const std::string::const_iterator pe,
                                const Token::size_type n) {
     auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::parseCChar: " + m);
+      if (b) {
+        raise("CxxTokenizer::parseCChar: " + m);
+      }
     };
     if (this->charAsString) {
       this->parseString(o, p, pe, n, '\'');
@@ -250,7 +269,9 @@ namespace tfel::utilities {
                                  const Token::size_type n,
                                  const char e) {
     auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::parseString: " + m);
+      if (b) {
+        raise("CxxTokenizer::parseString: " + m);
+      }
     };
     auto ps = std::next(p, 1);
     auto found = false;
@@ -325,7 +346,9 @@ namespace tfel::utilities {
                                  const std::string::const_iterator pe,
                                  const Token::size_type n) {
     auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::parseNumber: " + m);
+      if (b) {
+        raise("CxxTokenizer::parseNumber: " + m);
+      }
     };
     auto is_binary = [](const char c) { return (c == '0') || (c == '1'); };
     auto is_hex = [](const char c) {
@@ -506,8 +529,13 @@ namespace tfel::utilities {
       }
     }
     throw_if((p != pe) && (*p == '.'), "invalid number");
-    this->tokens.emplace_back(replace_all(std::string{b, p}, "\'", ""), n, o,
-                              Token::Number);
+    if (std::find(b, p, '\'') != p) {
+      // removing digit separators
+      this->tokens.emplace_back(replace_all(std::string{b, p}, "\'", ""), n, o,
+                                Token::Number);
+    } else {
+      this->tokens.emplace_back(std::string{b, p}, n, o, Token::Number);
+    }
     const auto d = p - b;
     p = b;
     advance(o, p, d);
@@ -518,7 +546,9 @@ namespace tfel::utilities {
                                    const std::string::const_iterator pe,
                                    const Token::size_type n) {
     auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::parseCComment: " + m);
+      if (b) {
+        raise("CxxTokenizer::parseCComment: " + m);
+      }
     };
     auto get_end = [&pe](const std::string::const_iterator cp)
         -> std::string::const_iterator {
@@ -594,7 +624,9 @@ namespace tfel::utilities {
                                      const std::string::const_iterator pe,
                                      const Token::size_type n) {
     auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::parseCxxComment: " + m);
+      if (b) {
+        raise("CxxTokenizer::parseCxxComment: " + m);
+      }
     };
     auto next_token = [this, &p, &o] {
       if (this->bKeepCommentBoundaries) {
@@ -680,7 +712,9 @@ namespace tfel::utilities {
       return std::find(keys.begin(), keys.end(), k) != keys.end();
     };
     auto throw_if = [](const bool c, const std::string &m) {
-      raise_if(c, "CxxTokenizer::parsePreprocessorDirective: " + m);
+      if (c) {
+        raise("CxxTokenizer::parsePreprocessorDirective: " + m);
+      }
     };
     // preprocessor
     throw_if((p == pe) || (*p != '#'), "invalid call");
@@ -707,7 +741,9 @@ namespace tfel::utilities {
                                        const std::string::const_iterator pe,
                                        const Token::size_type n) {
     auto throw_if = [](const bool c, const std::string &m) {
-      raise_if(c, "CxxTokenizer::parseStandardLine: " + m);
+      if (c) {
+        raise("CxxTokenizer::parseStandardLine: " + m);
+      }
     };
     ignore_space(o, p, pe);
     while (p != pe) {
@@ -857,8 +893,8 @@ namespace tfel::utilities {
                                   this->graveAccentAsSeparator));
         if (as.first < pw) {
           if (as.first == p) {
-            this->tokens.emplace_back(as.second, n, o, Token::Standard);
-            advance(o, p, as.second.size());
+            this->tokens.emplace_back(*(as.second), n, o, Token::Standard);
+            advance(o, p, as.second->size());
           } else {
             this->tokens.emplace_back(std::string{p, as.first}, n, o,
                                       Token::Standard);
@@ -883,7 +919,9 @@ namespace tfel::utilities {
   void CxxTokenizer::splitLine(const std::string &line,
                                const Token::size_type n) {
     auto throw_if = [](const bool b, const std::string &m) {
-      raise_if(b, "CxxTokenizer::splitLine: " + m);
+      if (b) {
+        raise("CxxTokenizer::splitLine: " + m);
+      }
     };
     auto b = line.begin();
     auto p = b;
@@ -951,16 +989,16 @@ namespace tfel::utilities {
   }  // end of CxxTokenizer::splitLine
 
   void CxxTokenizer::stripComments() {
-    for (auto p = this->tokens.begin(); p != this->tokens.end();) {
+    // the tokens which are kept are moved in place, in a single pass, to
+    // avoid erasing elements in the middle of the container. At each
+    // step, the range [tokens.begin(), w) contains the kept tokens
+    auto w = this->tokens.begin();
+    for (auto p = this->tokens.begin(); p != this->tokens.end(); ++p) {
       if (p->flag == Token::Comment) {
-        if (this->comments.find(p->line) != this->comments.end()) {
-          this->comments[p->line] += ' ';
-        }
-        this->comments[p->line] = p->value;
-        p = this->tokens.erase(p);
+        this->comments[p->line] = std::move(p->value);
+        continue;
       } else if (p->flag == Token::DoxygenComment) {
-        auto p2 = p;
-        ++p2;
+        const auto p2 = std::next(p);
         if (p2 != this->tokens.end()) {
           if (p2->flag == Token::Standard) {
             if (!p2->comment.empty()) {
@@ -972,20 +1010,22 @@ namespace tfel::utilities {
             p2->value = p->value + "\n" + p2->value;
           }
         }
-        p = this->tokens.erase(p);
+        continue;
       } else if (p->flag == Token::DoxygenBackwardComment) {
-        auto p2 = p;
-        --p2;
-        if (p2 != this->tokens.begin()) {
+        if (w - this->tokens.begin() > 1) {
+          const auto p2 = std::prev(w);
           if (p2->flag == Token::Standard) {
             p2->comment += p->value;
           }
         }
-        p = this->tokens.erase(p);
-      } else {
-        ++p;
+        continue;
+      }
+      if (w != p) {
+        *w = std::move(*p);
       }
+      ++w;
     }
+    this->tokens.erase(w, this->tokens.end());
   }  // end of CxxTokenizer::stripComments
 
   void CxxTokenizer::printFileTokens(std::ostream &out) const {
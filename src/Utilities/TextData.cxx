@@ -11,74 +11,188 @@
  * project under specific licensing conditions.
  */
 
+#include <limits>
+#include <thread>
+#include <future>
 #include <cassert>
+#include <charconv>
 #include <stdexcept>
 #include <sstream>
 #include <fstream>
 #include <algorithm>
 #include <iterator>
+#include <functional>
+#include <string_view>
+#if !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__))
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)) */
 #include "TFEL/Raise.hxx"
 #include "TFEL/Utilities/CxxTokenizer.hxx"
 #include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryData.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 
 namespace tfel::utilities {
 
-  TextData::TextData(const std::string& file, const std::string& format) {
-    auto get_legends = [](const std::string& l) {
-      std::vector<std::string> r;
-      CxxTokenizer t;
-      t.treatCharAsString(true);
-      t.parseString(l);
-      t.stripComments();
-      std::for_each(t.begin(), t.end(), [&r](const Token& w) {
-        if (w.flag == Token::String) {
-          r.push_back(w.value.substr(1, w.value.size() - 2));
-        } else {
-          r.push_back(w.value);
+  /*!
+   * \brief content of a file, mapped in memory when supported by the
+   * system.
+   */
+  struct TextDataFileContent {
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     */
+    TextDataFileContent(const std::string& f) {
+#if !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__))
+      const auto fd = ::open(f.c_str(), O_RDONLY);
+      raise_if(fd == -1, "TextData::TextData: can't open '" + f + '\'');
+      struct stat s;
+      if ((::fstat(fd, &s) == 0) && (S_ISREG(s.st_mode)) && (s.st_size > 0)) {
+        const auto n = static_cast<std::size_t>(s.st_size);
+        auto* const m = ::mmap(nullptr, n, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m != MAP_FAILED) {
+          this->mapping = m;
+          this->content =
+              std::string_view{static_cast<const char*>(this->mapping), n};
         }
-      });
-      return r;
-    };
-    auto add_line = [this](const std::string& l, const Token::size_type n) {
-      Line nl;
-      CxxTokenizer t;
-      t.treatCharAsString(true);
-      t.parseString(l);
-      t.stripComments();
-      std::for_each(t.begin(), t.end(), [&nl, &n](const Token& w) {
-        nl.tokens.push_back(w);
-        nl.tokens.back().line = n;
-      });
-      this->lines.push_back(std::move(nl));
-    };
+      }
+      ::close(fd);
+      if (this->mapping != nullptr) {
+        return;
+      }
+#endif /* !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)) */
+      std::ifstream in{f, std::ios::binary};
+      raise_if(!in, "TextData::TextData: can't open '" + f + '\'');
+      this->buffer.assign(std::istreambuf_iterator<char>{in},
+                          std::istreambuf_iterator<char>{});
+      this->content = this->buffer;
+    }  // end of TextDataFileContent
+    TextDataFileContent(TextDataFileContent&&) = delete;
+    TextDataFileContent(const TextDataFileContent&) = delete;
+    TextDataFileContent& operator=(TextDataFileContent&&) = delete;
+    TextDataFileContent& operator=(const TextDataFileContent&) = delete;
+    //! \brief destructor
+    ~TextDataFileContent() {
+#if !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__))
+      if (this->mapping != nullptr) {
+        ::munmap(this->mapping, this->content.size());
+      }
+#endif /* !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)) */
+    }  // end of ~TextDataFileContent
+    //! \brief content of the file
+    std::string_view content;
+
+   private:
+    //! \brief memory mapping, if any
+    void* mapping = nullptr;
+    //! \brief buffer used if the file can't be mapped in memory
+    std::string buffer;
+  };  // end of struct TextDataFileContent
+
+  /*!
+   * \brief values decoded from a set of lines
+   */
+  struct TextDataChunk {
+    //! \brief a simple alias
+    using size_type = TextData::size_type;
+    //! \brief values stored by columns
+    std::vector<std::vector<double>> columns;
+    //! \brief line number of each row
+    std::vector<size_type> line_numbers;
+    //! \brief number of values of each row
+    std::vector<size_type> row_sizes;
+    //! \brief values that could not be converted
+    std::map<std::pair<size_type, size_type>, std::string> invalid_values;
+    //! \brief number of lines counted in the chunk
+    size_type nlines = 0;
+  };  // end of struct TextDataChunk
+
+  static std::vector<std::string> TextDataGetLegends(const std::string& l) {
+    std::vector<std::string> r;
+    CxxTokenizer t;
+    t.treatCharAsString(true);
+    t.parseString(l);
+    t.stripComments();
+    std::for_each(t.begin(), t.end(), [&r](const Token& w) {
+      if (w.flag == Token::String) {
+        r.push_back(w.value.substr(1, w.value.size() - 2));
+      } else {
+        r.push_back(w.value);
+      }
+    });
+    return r;
+  }  // end of TextDataGetLegends
+
+  static std::vector<Token> TextDataTokenize(const std::string_view l) {
+    CxxTokenizer t;
+    t.treatCharAsString(true);
+    t.parseString(std::string{l});
+    t.stripComments();
+    return {t.begin(), t.end()};
+  }  // end of TextDataTokenize
+
+  /*!
+   * \brief extract the next line
+   * \param[in,out] p: position in the content
+   * \param[in] c: content
+   */
+  static std::string_view TextDataGetLine(std::string_view::size_type& p,
+                                          const std::string_view c) {
+    const auto b = p;
+    const auto e = c.find('\n', b);
+    if (e == std::string_view::npos) {
+      p = c.size();
+      return c.substr(b);
+    }
+    p = e + 1;
+    return c.substr(b, e - b);
+  }  // end of TextDataGetLine
+
+  /*!
+   * \brief treat the first lines of the file, i.e. the lines preceding
+   * the first line of data which is not treated specifically.
+   *
+   * \return the position of the remaining lines and the number of the
+   * next line
+   * \param[out] legends: legends
+   * \param[out] preamble: preamble
+   * \param[in] c: file content
+   * \param[in] format: file format
+   * \param[in] add_line: function called on lines of data
+   */
+  static std::pair<std::string_view::size_type, TextData::size_type>
+  TextDataTreatHeader(
+      std::vector<std::string>& legends,
+      std::vector<std::string>& preamble,
+      const std::string_view c,
+      const std::string& format,
+      const std::function<void(std::string_view, TextData::size_type)>&
+          add_line) {
     auto firstLine = true;
-    auto firstComments = true;
-    auto nbr = size_type{1};
-    std::ifstream f{file};
-    raise_if(!f, "TextData::TextData: can't open '" + file + '\'');
-    while (!f.eof()) {
-      auto line = std::string{};
-      getline(f, line);
+    auto nbr = TextData::size_type{1};
+    auto p = std::string_view::size_type{};
+    while (p != c.size()) {
+      auto line = std::string{TextDataGetLine(p, c)};
       if (line.empty()) {
         continue;
       }
       if (line[0] == '#') {
-        if (!firstComments) {
-          continue;
-        }
         if (format.empty()) {
           line.erase(line.begin());
           if (firstLine) {
-            this->legends = get_legends(line);
+            legends = TextDataGetLegends(line);
           }
-          this->preamble.push_back(line);
+          preamble.push_back(line);
         }
       } else {
         if (((format == "gnuplot") || (format == "alcyone")) && (firstLine)) {
-          this->legends = get_legends(line);
+          legends = TextDataGetLegends(line);
           bool all_numbers = true;
-          for (const auto& l : this->legends) {
+          for (const auto& l : legends) {
             try {
               convert<double>(l);
             } catch (std::exception&) {
@@ -89,19 +203,268 @@ namespace tfel::utilities {
             }
           }
           if (all_numbers) {
-            this->legends.clear();
+            legends.clear();
             add_line(line, nbr);
           }
         } else {
+          // from now on, comments are ignored
           add_line(line, nbr);
-          firstComments = false;
+          return {p, nbr + 1};
         }
       }
       firstLine = false;
       ++nbr;
     }
+    return {p, nbr};
+  }  // end of TextDataTreatHeader
+
+  /*!
+   * \brief call the given function on all the lines of data, ignoring
+   * empty lines and comments.
+   * \return the number of lines treated
+   * \param[in] c: lines
+   * \param[in] add_line: function called on lines of data
+   */
+  template <typename Function>
+  static TextData::size_type TextDataForEachLine(const std::string_view c,
+                                                 const TextData::size_type n,
+                                                 const Function& add_line) {
+    auto nbr = n;
+    auto p = std::string_view::size_type{};
+    while (p != c.size()) {
+      const auto line = TextDataGetLine(p, c);
+      if ((line.empty()) || (line[0] == '#')) {
+        continue;
+      }
+      add_line(line, nbr);
+      ++nbr;
+    }
+    return nbr - n;
+  }  // end of TextDataForEachLine
+
+  /*!
+   * \brief convert a word to a double using `std::from_chars`.
+   *
+   * Only words made of digits, signs, dots and exponents are converted,
+   * since other words are decomposed in multiple tokens by the
+   * `CxxTokenizer` class.
+   *
+   * \return true on success
+   * \param[out] v: value
+   * \param[in] w: word
+   */
+  static bool TextDataConvert(double& v, std::string_view w) {
+    for (const auto c : w) {
+      if (!(((c >= '0') && (c <= '9')) || (c == '.') || (c == 'e') ||
+            (c == 'E') || (c == '-') || (c == '+'))) {
+        return false;
+      }
+    }
+    if ((w.size() > 1) && (w[0] == '+') && (w[1] != '-') && (w[1] != '+')) {
+      w.remove_prefix(1);
+    }
+    const auto e = w.data() + w.size();
+    const auto r = std::from_chars(w.data(), e, v);
+    return (r.ec == std::errc{}) && (r.ptr == e);
+  }  // end of TextDataConvert
+
+  static bool TextDataIsSpace(const char c) {
+    return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\v') ||
+           (c == '\f');
+  }  // end of TextDataIsSpace
+
+  /*!
+   * \brief decode a line and add it to the given chunk
+   * \param[in,out] d: chunk
+   * \param[in,out] row: buffer
+   * \param[in] l: line
+   * \param[in] n: line number
+   */
+  static void TextDataAddRow(TextDataChunk& d,
+                             std::vector<double>& row,
+                             const std::string_view l,
+                             const TextData::size_type n) {
+    const auto r = d.line_numbers.size();
+    row.clear();
+    auto fast = true;
+    auto p = std::string_view::size_type{};
+    while (fast) {
+      while ((p != l.size()) && (TextDataIsSpace(l[p]))) {
+        ++p;
+      }
+      if (p == l.size()) {
+        break;
+      }
+      const auto b = p;
+      while ((p != l.size()) && (!TextDataIsSpace(l[p]))) {
+        ++p;
+      }
+      auto v = double{};
+      fast = TextDataConvert(v, l.substr(b, p - b));
+      row.push_back(v);
+    }
+    if (!fast) {
+      // fall back to the tokenizer, which reports errors as in
+      // previous versions
+      row.clear();
+      for (const auto& t : TextDataTokenize(l)) {
+        try {
+          row.push_back(convert<double>(t.value));
+        } catch (std::exception&) {
+          d.invalid_values.insert({{r, row.size()}, t.value});
+          row.push_back(std::numeric_limits<double>::quiet_NaN());
+        }
+      }
+    }
+    if (row.size() > d.columns.size()) {
+      d.columns.resize(row.size(),
+                       std::vector<double>(
+                           r, std::numeric_limits<double>::quiet_NaN()));
+    }
+    for (std::size_t c = 0; c != d.columns.size(); ++c) {
+      d.columns[c].push_back(c < row.size()
+                                 ? row[c]
+                                 : std::numeric_limits<double>::quiet_NaN());
+    }
+    d.line_numbers.push_back(n);
+    d.row_sizes.push_back(row.size());
+  }  // end of TextDataAddRow
+
+  /*!
+   * \brief decode the lines of data
+   * \param[in] c: lines
+   * \param[in] n: number of the first line
+   */
+  static TextDataChunk TextDataDecodeChunk(const std::string_view c,
+                                           const TextData::size_type n) {
+    auto d = TextDataChunk{};
+    auto row = std::vector<double>{};
+    d.nlines = TextDataForEachLine(
+        c, n, [&d, &row](const std::string_view l,
+                         const TextData::size_type nbr) {
+          TextDataAddRow(d, row, l, nbr);
+        });
+    return d;
+  }  // end of TextDataDecodeChunk
+
+  /*!
+   * \brief split the given lines in chunks
+   * \param[in] c: lines
+   */
+  static std::vector<std::string_view> TextDataSplitInChunks(
+      const std::string_view c) {
+    // minimal size of a chunk
+    constexpr std::size_t chunk_size = 4 * 1024 * 1024;
+    const auto nth = static_cast<std::size_t>(
+        std::max(std::thread::hardware_concurrency(), 1u));
+    const auto nchunks = std::min(nth, c.size() / chunk_size);
+    if (nchunks < 2) {
+      return {c};
+    }
+    auto chunks = std::vector<std::string_view>{};
+    auto b = std::string_view::size_type{};
+    for (std::size_t i = 0; (i != nchunks) && (b != c.size()); ++i) {
+      auto e = (i + 1 == nchunks) ? c.size() : (c.size() / nchunks) * (i + 1);
+      if (e < b) {
+        e = b;
+      }
+      e = c.find('\n', e);
+      e = (e == std::string_view::npos) ? c.size() : e + 1;
+      chunks.push_back(c.substr(b, e - b));
+      b = e;
+    }
+    return chunks;
+  }  // end of TextDataSplitInChunks
+
+  TextData::TextData(const std::string& f, const std::string& fmt)
+      : file(f), format(fmt) {
+    const TextDataFileContent fc(this->file);
+    if (isBinaryData(fc.content)) {
+      this->decodeBinaryData(fc.content);
+      return;
+    }
+    auto d = TextDataChunk{};
+    auto row = std::vector<double>{};
+    const auto [p, nbr] = TextDataTreatHeader(
+        this->legends, this->preamble, fc.content, this->format,
+        [&d, &row](const std::string_view l, const size_type n) {
+          TextDataAddRow(d, row, l, n);
+        });
+    // decoding the remaining lines, in parallel if the file is large
+    const auto chunks = TextDataSplitInChunks(fc.content.substr(p));
+    auto results = std::vector<TextDataChunk>{};
+    if (chunks.size() == 1) {
+      results.push_back(TextDataDecodeChunk(chunks[0], nbr));
+    } else {
+      // the line numbers are not known before all the previous chunks
+      // have been decoded: they are corrected afterwards
+      auto tasks = std::vector<std::future<TextDataChunk>>{};
+      for (const auto& c : chunks) {
+        tasks.push_back(std::async(std::launch::async, TextDataDecodeChunk, c,
+                                   size_type{0}));
+      }
+      auto n = nbr;
+      for (auto& t : tasks) {
+        results.push_back(t.get());
+        for (auto& l : results.back().line_numbers) {
+          l += n;
+        }
+        n += results.back().nlines;
+      }
+    }
+    // gathering the results
+    auto nrows = d.line_numbers.size();
+    auto ncolumns = d.columns.size();
+    for (const auto& r : results) {
+      nrows += r.line_numbers.size();
+      ncolumns = std::max(ncolumns, r.columns.size());
+    }
+    this->columns.resize(ncolumns);
+    for (auto& c : this->columns) {
+      c.reserve(nrows);
+    }
+    this->line_numbers.reserve(nrows);
+    this->row_sizes.reserve(nrows);
+    auto append = [this](const TextDataChunk& r) {
+      const auto offset = this->line_numbers.size();
+      for (std::size_t c = 0; c != this->columns.size(); ++c) {
+        if (c < r.columns.size()) {
+          this->columns[c].insert(this->columns[c].end(), r.columns[c].begin(),
+                                  r.columns[c].end());
+        } else {
+          this->columns[c].resize(this->columns[c].size() +
+                                      r.line_numbers.size(),
+                                  std::numeric_limits<double>::quiet_NaN());
+        }
+      }
+      this->line_numbers.insert(this->line_numbers.end(),
+                                r.line_numbers.begin(), r.line_numbers.end());
+      this->row_sizes.insert(this->row_sizes.end(), r.row_sizes.begin(),
+                             r.row_sizes.end());
+      for (const auto& [k, v] : r.invalid_values) {
+        this->invalid_values.insert({{k.first + offset, k.second}, v});
+      }
+    };
+    append(d);
+    for (const auto& r : results) {
+      append(r);
+    }
   }  // end of TextData::TextData
 
+  void TextData::decodeBinaryData(const std::string_view c) {
+    const auto h = tfel::utilities::decodeBinaryData(this->columns, c);
+    this->binary = true;
+    this->legends = h.legends;
+    this->preamble = h.preamble;
+    const auto nrows =
+        this->columns.empty() ? size_type{} : this->columns[0].size();
+    this->line_numbers.resize(nrows);
+    for (size_type i = 0; i != nrows; ++i) {
+      this->line_numbers[i] = i + 1;
+    }
+    this->row_sizes.assign(nrows, this->columns.size());
+  }  // end of TextData::decodeBinaryData
+
   const std::vector<std::string>& TextData::getLegends() const {
     return this->legends;
   }  // end of TextData::getLegends
@@ -139,42 +502,106 @@ namespace tfel::utilities {
       raise_if(b, "TextData::getColumn: " + msg);
     };
     tab.clear();
-    tab.reserve(this->lines.size());
     // sanity check
     throw_if(i == 0u,
              "column '0' requested "
              "(column numbers begins at '1').");
-    // treatment
-    for (const auto& l : this->lines) {
-      auto n = l.tokens.empty() ? 0 : l.tokens[0].line;
-      throw_if(l.tokens.size() < i, "line '" + std::to_string(n) +
-                                        "' "
-                                        "does not have '" +
-                                        std::to_string(i) + "' columns.");
-      tab.push_back(convert<double>(l.tokens.at(i - 1u).value));
+    // first row which does not have enough columns
+    const auto pr = std::find_if(this->row_sizes.begin(), this->row_sizes.end(),
+                                 [i](const size_type s) { return s < i; });
+    const auto r = static_cast<size_type>(pr - this->row_sizes.begin());
+    // first value of the column which can't be converted
+    const auto pv = std::find_if(
+        this->invalid_values.begin(), this->invalid_values.end(),
+        [i](const auto& v) { return v.first.second == i - 1; });
+    if ((pv != this->invalid_values.end()) && (pv->first.first < r)) {
+      // throws the conversion error
+      convert<double>(pv->second);
+    }
+    throw_if(pr != this->row_sizes.end(),
+             "line '" + std::to_string(this->line_numbers[r]) +
+                 "' "
+                 "does not have '" +
+                 std::to_string(i) + "' columns.");
+    if (this->columns.size() < i) {
+      return;
     }
+    tab.assign(this->columns[i - 1].begin(), this->columns[i - 1].end());
   }  // end of TextData::getColumn
 
+  void TextData::buildLines() const {
+    std::call_once(this->lines_flag, [this] {
+      if (this->binary) {
+        // values are converted back to tokens
+        std::ostringstream os;
+        os.precision(std::numeric_limits<double>::max_digits10);
+        for (size_type r = 0; r != this->line_numbers.size(); ++r) {
+          Line nl;
+          for (size_type c = 0; c != this->columns.size(); ++c) {
+            os.str("");
+            os << this->columns[c][r];
+            nl.tokens.emplace_back(os.str(), this->line_numbers[r], 0,
+                                   Token::Number);
+          }
+          this->lines.push_back(std::move(nl));
+        }
+        return;
+      }
+      auto add_line = [this](const std::string_view l, const size_type n) {
+        if (n <= this->first_line) {
+          return;
+        }
+        Line nl;
+        for (const auto& w : TextDataTokenize(l)) {
+          nl.tokens.push_back(w);
+          nl.tokens.back().line = n;
+        }
+        this->lines.push_back(std::move(nl));
+      };
+      const TextDataFileContent fc(this->file);
+      auto l = std::vector<std::string>{};
+      auto pr = std::vector<std::string>{};
+      const auto [p, nbr] =
+          TextDataTreatHeader(l, pr, fc.content, this->format, add_line);
+      TextDataForEachLine(fc.content.substr(p), nbr, add_line);
+    });
+  }  // end of TextData::buildLines
+
   std::vector<TextData::Line>::const_iterator TextData::begin() const {
+    this->buildLines();
     return this->lines.begin();
   }  // end of TextData::begin()
 
   std::vector<TextData::Line>::const_iterator TextData::end() const {
+    this->buildLines();
     return this->lines.end();
   }  // end of TextData::end()
 
   void TextData::skipLines(const Token::size_type n) {
-    auto get_line = [](const Line& l) -> Token::size_type {
-      return l.tokens.empty() ? 0 : l.tokens[0].line;
-    };
-    if (this->lines.empty()) {
-      return;
+    this->first_line = std::max(this->first_line, n + 1);
+    const auto pr = std::find_if(
+        this->line_numbers.begin(), this->line_numbers.end(),
+        [this](const size_type l) { return l > this->first_line; });
+    const auto nr = pr - this->line_numbers.begin();
+    for (auto& c : this->columns) {
+      c.erase(c.begin(), c.begin() + nr);
     }
-    auto p = this->lines.begin();
-    while ((get_line(*p) <= n + 1) && (p != this->lines.end())) {
-      ++p;
+    this->line_numbers.erase(this->line_numbers.begin(), pr);
+    this->row_sizes.erase(this->row_sizes.begin(),
+                          this->row_sizes.begin() + nr);
+    auto values = std::map<std::pair<size_type, size_type>, std::string>{};
+    for (const auto& [k, v] : this->invalid_values) {
+      if (k.first >= static_cast<size_type>(nr)) {
+        values.insert({{k.first - nr, k.second}, v});
+      }
     }
-    lines.erase(lines.begin(), p);
-  }
+    this->invalid_values = std::move(values);
+    auto pl = std::find_if(this->lines.begin(), this->lines.end(),
+                           [this](const Line& l) {
+                             return (!l.tokens.empty()) &&
+                                    (l.tokens[0].line > this->first_line);
+                           });
+    this->lines.erase(this->lines.begin(), pl);
+  }  // end of TextData::skipLines
 
 }  // end of namespace tfel::utilities
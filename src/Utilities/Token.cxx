@@ -12,14 +12,15 @@
  * project under specific licensing conditions.
  */
 
+#include <utility>
 #include "TFEL/Utilities/Token.hxx"
 
 namespace tfel::utilities {
 
   Token::Token() = default;
   Token::Token(const Token&) = default;
-  Token::Token(Token&&) = default;
-  Token& Token::operator=(Token&&) = default;
+  Token::Token(Token&&) noexcept = default;
+  Token& Token::operator=(Token&&) noexcept = default;
   Token& Token::operator=(const Token&) = default;
 
   Token::Token(const std::string& v,
@@ -28,6 +29,12 @@ namespace tfel::utilities {
                const TokenFlag f)
       : value(v), line(l), offset(o), flag(f) {}
 
+  Token::Token(std::string&& v,
+               const size_type l,
+               const size_type o,
+               const TokenFlag f)
+      : value(std::move(v)), line(l), offset(o), flag(f) {}
+
   Token::~Token() noexcept = default;
 
   bool isComment(const Token& t) {
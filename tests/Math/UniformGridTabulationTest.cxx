@@ -0,0 +1,99 @@
+/*!
+ * \file   UniformGridTabulationTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/UniformGridTabulation.hxx"
+
+struct UniformGridTabulationTest final : public tfel::tests::TestCase {
+  UniformGridTabulationTest()
+      : tfel::tests::TestCase("TFEL/Math", "UniformGridTabulationTest") {
+  }  // end of UniformGridTabulationTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  using tabulation = tfel::math::UniformGridTabulation<double>;
+  //! \brief linear functions are exactly represented
+  void test1() {
+    const auto f = [](const double x) { return 2 * x + 1; };
+    for (const auto i :
+         {tabulation::LINEAR_INTERPOLATION, tabulation::CUBIC_INTERPOLATION}) {
+      const auto t = tabulation(f, -1, 3, 1e-12, i);
+      TFEL_TESTS_ASSERT(t.getNumberOfIntervals() == 16u);
+      TFEL_TESTS_ASSERT(t.contains(-1));
+      TFEL_TESTS_ASSERT(t.contains(3));
+      TFEL_TESTS_ASSERT(!t.contains(-1.5));
+      TFEL_TESTS_ASSERT(!t.contains(3.5));
+      for (const auto x : {-1., -0.3, 0., 1.2, 2.9, 3.}) {
+        TFEL_TESTS_ASSERT(std::abs(t(x) - f(x)) < 1e-12);
+      }
+    }
+  }
+  //! \brief accuracy of the interpolation of an exponential law
+  void test2() {
+    const auto eps = 1e-8;
+    const auto f = [](const double T) { return 1e6 * std::exp(-3000 / T); };
+    const auto t1 = tabulation(f, 300, 1500, eps,
+                               tabulation::LINEAR_INTERPOLATION, 1u << 20);
+    const auto t2 = tabulation(f, 300, 1500, eps,
+                               tabulation::CUBIC_INTERPOLATION, 1u << 20);
+    TFEL_TESTS_ASSERT(t2.getNumberOfIntervals() < t1.getNumberOfIntervals());
+    const auto vmax = f(1500);
+    for (int i = 0; i != 1001; ++i) {
+      const auto T = 300 + 1.2 * i;
+      TFEL_TESTS_ASSERT(std::abs(t1(T) - f(T)) < 10 * eps * vmax);
+      TFEL_TESTS_ASSERT(std::abs(t2(T) - f(T)) < 10 * eps * vmax);
+      TFEL_TESTS_ASSERT(t1.check(T, f(T)));
+      TFEL_TESTS_ASSERT(t2.check(T, f(T)));
+    }
+    TFEL_TESTS_ASSERT(!t2.check(900, 1.01 * f(900)));
+  }
+  //! \brief error handling
+  void test3() {
+    const auto f = [](const double x) { return std::sqrt(x); };
+    TFEL_TESTS_CHECK_THROW(tabulation(f, 1, 0, 1e-8), std::exception);
+    // the accuracy can't be reached with 64 intervals
+    TFEL_TESTS_CHECK_THROW(
+        tabulation(f, 0, 1, 1e-12, tabulation::LINEAR_INTERPOLATION, 64),
+        std::exception);
+    // the function is not defined on the whole range
+    TFEL_TESTS_CHECK_THROW(tabulation(f, -1, 1, 1e-3), std::exception);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(UniformGridTabulationTest,
+                          "UniformGridTabulationTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("UniformGridTabulation.xml");
+  const auto r = m.execute();
+  return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,109 @@
+/*!
+ * \file   tests/System/AsynchronousProcessTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ProcessManager.hxx"
+
+struct AsynchronousProcessTest final : public tfel::tests::TestCase {
+  AsynchronousProcessTest()
+      : tfel::tests::TestCase("TFEL/System", "AsynchronousProcessTest") {
+  }  // end of AsynchronousProcessTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief outputs and exit values
+  void test1() {
+    using namespace tfel::system;
+    ProcessManager m;
+    m.setMaximumNumberOfConcurrentCommands(2);
+    auto c1 = ProcessManager::AsynchronousCommand{};
+    c1.command = "printenv TFEL_ASYNCHRONOUS_PROCESS_TEST";
+    c1.environment["TFEL_ASYNCHRONOUS_PROCESS_TEST"] = "value";
+    auto c2 = ProcessManager::AsynchronousCommand{};
+    c2.command = "false";
+    auto c3 = ProcessManager::AsynchronousCommand{};
+    c3.command = "ls tfel-asynchronous-process-test-missing-file";
+    auto h1 = m.executeAsynchronously(c1);
+    auto h2 = m.executeAsynchronously(c2);
+    auto h3 = m.executeAsynchronously(c3);
+    const auto r1 = h1.result.get();
+    const auto r2 = h2.result.get();
+    const auto r3 = h3.result.get();
+    TFEL_TESTS_ASSERT(r1.succeeded());
+    TFEL_TESTS_ASSERT(r1.output == "value\n");
+    TFEL_TESTS_ASSERT(r1.error.empty());
+    TFEL_TESTS_ASSERT(r2.exitStatus);
+    TFEL_TESTS_ASSERT(r2.exitValue != EXIT_SUCCESS);
+    TFEL_TESTS_ASSERT(!r2.succeeded());
+    TFEL_TESTS_ASSERT(!r3.succeeded());
+    TFEL_TESTS_ASSERT(r3.output.empty());
+    TFEL_TESTS_ASSERT(!r3.error.empty());
+  }  // end of test1
+  //! \brief timeouts and cancellations
+  void test2() {
+    using namespace tfel::system;
+    ProcessManager m;
+    m.setMaximumNumberOfConcurrentCommands(1);
+    auto c1 = ProcessManager::AsynchronousCommand{};
+    c1.command = "sleep 10";
+    c1.timeout = std::chrono::milliseconds{100};
+    auto c2 = ProcessManager::AsynchronousCommand{};
+    c2.command = "sleep 10";
+    auto c3 = ProcessManager::AsynchronousCommand{};
+    c3.command = "sleep 10";
+    auto h1 = m.executeAsynchronously(c1);
+    auto h2 = m.executeAsynchronously(c2);
+    auto h3 = m.executeAsynchronously(c3);
+    // h3 is cancelled before being launched
+    m.cancel(h3.id);
+    const auto r1 = h1.result.get();
+    TFEL_TESTS_ASSERT(r1.timedOut);
+    TFEL_TESTS_ASSERT(!r1.exitStatus);
+    // h2 is cancelled while running
+    m.cancel(h2.id);
+    const auto r2 = h2.result.get();
+    TFEL_TESTS_ASSERT(r2.cancelled);
+    TFEL_TESTS_ASSERT(!r2.succeeded());
+    const auto r3 = h3.result.get();
+    TFEL_TESTS_ASSERT(r3.cancelled);
+    m.waitAsynchronousCommands();
+  }  // end of test2
+  //! \brief invalid commands
+  void test3() {
+    using namespace tfel::system;
+    ProcessManager m;
+    auto c = ProcessManager::AsynchronousCommand{};
+    c.command = "tfel-asynchronous-process-test-missing-command";
+    auto h = m.executeAsynchronously(c);
+    TFEL_TESTS_CHECK_THROW(h.result.get(), std::exception);
+  }  // end of test3
+};
+
+TFEL_TESTS_GENERATE_PROXY(AsynchronousProcessTest, "AsynchronousProcessTest");
+
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("AsynchronousProcessTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
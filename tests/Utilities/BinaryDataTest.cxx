@@ -0,0 +1,100 @@
+/*!
+ * \file  tests/Utilities/BinaryDataTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \brief 19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/BinaryData.hxx"
+#include "TFEL/Utilities/TextData.hxx"
+
+struct BinaryDataTest final : public tfel::tests::TestCase {
+  BinaryDataTest()
+      : tfel::tests::TestCase("TFEL/Utilities", "BinaryDataTest") {}
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute
+ private:
+  static void write(const std::string& f, const std::size_t n) {
+    auto h = tfel::utilities::BinaryDataHeader{};
+    h.legends = {"t", "sxx"};
+    h.preamble = {"first column: time", "second column: stress"};
+    // small chunks to test the decoding of several chunks
+    tfel::utilities::BinaryDataWriter w(f, h, 3);
+    for (std::size_t i = 0; i != n; ++i) {
+      w.write({static_cast<double>(i), 0.5 * static_cast<double>(i)});
+    }
+  }  // end of write
+  void test1() {
+    using tfel::utilities::TextData;
+    write("BinaryDataTest-1.bin", 10);
+    TFEL_TESTS_ASSERT(
+        tfel::utilities::isBinaryDataFile("BinaryDataTest-1.bin"));
+    TextData d("BinaryDataTest-1.bin");
+    TFEL_TESTS_ASSERT(d.getLegends() ==
+                      std::vector<std::string>({"t", "sxx"}));
+    TFEL_TESTS_CHECK_EQUAL(d.getPreamble().size(), 2u);
+    TFEL_TESTS_CHECK_EQUAL(d.findColumn("sxx"), 2u);
+    const auto c1 = d.getColumn(1);
+    const auto c2 = d.getColumn(2);
+    TFEL_TESTS_ASSERT(c1.size() == 10u);
+    TFEL_TESTS_ASSERT(c2.size() == 10u);
+    for (std::size_t i = 0; i != c1.size(); ++i) {
+      TFEL_TESTS_ASSERT(c1[i] == static_cast<double>(i));
+      TFEL_TESTS_ASSERT(c2[i] == 0.5 * static_cast<double>(i));
+    }
+    TFEL_TESTS_CHECK_EQUAL(std::distance(d.begin(), d.end()), 10);
+    TFEL_TESTS_CHECK_THROW(d.getColumn(3), std::runtime_error);
+    // conversion to text
+    tfel::utilities::convertBinaryDataFileToText("BinaryDataTest-1.bin",
+                                                 "BinaryDataTest-1.txt");
+    TextData d2("BinaryDataTest-1.txt");
+    TFEL_TESTS_ASSERT(d2.getColumn(2) == c2);
+  }  // end of test1
+  void test2() {
+    using tfel::utilities::TextData;
+    // a truncated chunk, as may result from an interrupted computation,
+    // is ignored
+    write("BinaryDataTest-2.bin", 7);
+    auto c = std::string{};
+    {
+      std::ifstream in("BinaryDataTest-2.bin", std::ios::binary);
+      c.assign(std::istreambuf_iterator<char>{in},
+               std::istreambuf_iterator<char>{});
+    }
+    {
+      std::ofstream out("BinaryDataTest-2.bin", std::ios::binary);
+      out.write(c.data(), static_cast<std::streamsize>(c.size() - 4));
+    }
+    TextData d("BinaryDataTest-2.bin");
+    TFEL_TESTS_CHECK_EQUAL(d.getColumn(1).size(), 6u);
+  }  // end of test2
+};
+
+TFEL_TESTS_GENERATE_PROXY(BinaryDataTest, "BinaryDataTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BinaryDataTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -260,6 +260,22 @@ struct CxxTokenizerTest final : public tfel::tests::TestCase {
     TFEL_TESTS_CHECK_THROW(t.parseString("0b2"), std::runtime_error);
     t.clear();
     TFEL_TESTS_CHECK_THROW(t.parseString("0b020"), std::runtime_error);
+    // comments attached to tokens
+    t.clear();
+    t.parseString(
+        "a b //!< backward\n"
+        "//! forward\n"
+        "c /* comment */ d");
+    t.stripComments();
+    TFEL_TESTS_ASSERT(t.size() == 4u);
+    TFEL_TESTS_ASSERT(t[0].value == "a");
+    TFEL_TESTS_ASSERT(t[0].comment.empty());
+    TFEL_TESTS_ASSERT(t[1].value == "b");
+    TFEL_TESTS_ASSERT(t[1].comment == "backward");
+    TFEL_TESTS_ASSERT(t[2].value == "c");
+    TFEL_TESTS_ASSERT(t[2].comment == "forward");
+    TFEL_TESTS_ASSERT(t[3].value == "d");
+    TFEL_TESTS_ASSERT(t[3].comment.empty());
     return this->result;
   }  // end of execute()
  private:
@@ -0,0 +1,134 @@
+/*!
+ * \file  tests/Utilities/TextDataTest.cxx
+ * \brief  Tests of the TextData class: columns, legends, preamble,
+ * comments, conversion errors and parallel decoding of large files.
+ * \author Thomas Helfer
+ * \date   19/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/TextData.hxx"
+
+struct TextDataTest final : public tfel::tests::TestCase {
+  TextDataTest() : tfel::tests::TestCase("TFEL/Utilities", "TextDataTest") {}
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+ private:
+  static void write(const std::string& f, const std::string& c) {
+    std::ofstream out(f);
+    out << c;
+  }  // end of write
+  static bool check(const std::vector<double>& values,
+                    const std::vector<double>& expected) {
+    if (values.size() != expected.size()) {
+      return false;
+    }
+    for (std::size_t i = 0; i != values.size(); ++i) {
+      if (std::abs(values[i] - expected[i]) > 1e-14 * std::abs(expected[i])) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of check
+  void test1() {
+    using tfel::utilities::TextData;
+    write("TextDataTest-1.txt",
+          "# time 'sxx' \"syy\"\n"
+          "# description\n"
+          "0 1.5 -2e-3\n"
+          "\n"
+          "1 +2.5 .5\r\n"
+          "# a comment\n"
+          "2 3 abc\n");
+    TextData d("TextDataTest-1.txt");
+    TFEL_TESTS_ASSERT(d.getLegends() ==
+                      std::vector<std::string>({"time", "sxx", "syy"}));
+    TFEL_TESTS_ASSERT(d.getPreamble().size() == 2u);
+    TFEL_TESTS_CHECK_EQUAL(d.findColumn("sxx"), 2u);
+    TFEL_TESTS_CHECK_EQUAL(d.getLegend(3), "syy");
+    TFEL_TESTS_ASSERT(check(d.getColumn(1), {0, 1, 2}));
+    TFEL_TESTS_ASSERT(check(d.getColumn(2), {1.5, 2.5, 3}));
+    // conversion errors are only reported when the column is requested
+    TFEL_TESTS_CHECK_THROW(d.getColumn(3), std::invalid_argument);
+    TFEL_TESTS_CHECK_THROW(d.getColumn(4), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(d.getColumn(0), std::runtime_error);
+    // lines, as returned by the compatibility layer
+    auto n = std::size_t{};
+    for (const auto& l : d) {
+      TFEL_TESTS_CHECK_EQUAL(l.tokens.size(), 3u);
+      ++n;
+    }
+    TFEL_TESTS_CHECK_EQUAL(n, 3u);
+    d.skipLines(2);
+    TFEL_TESTS_ASSERT(check(d.getColumn(1), {1, 2}));
+    TFEL_TESTS_CHECK_EQUAL(std::distance(d.begin(), d.end()), 2);
+  }  // end of test1
+  void test2() {
+    using tfel::utilities::TextData;
+    write("TextDataTest-2.txt",
+          "time sxx\n"
+          "0 1 // comment\n"
+          "1 /* comment */ 2\n"
+          "2 3\n");
+    TextData d("TextDataTest-2.txt", "gnuplot");
+    TFEL_TESTS_ASSERT(d.getLegends() ==
+                      std::vector<std::string>({"time", "sxx"}));
+    TFEL_TESTS_ASSERT(check(d.getColumn(1), {0, 1, 2}));
+    TFEL_TESTS_ASSERT(check(d.getColumn(2), {1, 2, 3}));
+    TFEL_TESTS_CHECK_THROW(TextData("TextDataTest-missing.txt"),
+                           std::runtime_error);
+  }  // end of test2
+  void test3() {
+    using tfel::utilities::TextData;
+    // a file large enough to be decoded in parallel on most computers
+    const auto n = std::size_t{400000};
+    {
+      std::ofstream out("TextDataTest-3.txt");
+      out.precision(15);
+      for (std::size_t i = 0; i != n; ++i) {
+        out << i << " " << 0.5 * i << " " << -1.e-3 * i << '\n';
+      }
+    }
+    TextData d("TextDataTest-3.txt");
+    const auto c1 = d.getColumn(1);
+    const auto c3 = d.getColumn(3);
+    TFEL_TESTS_CHECK_EQUAL(c1.size(), n);
+    TFEL_TESTS_CHECK_EQUAL(c3.size(), n);
+    auto ok = (c1.size() == n) && (c3.size() == n);
+    for (std::size_t i = 0; (ok) && (i != n); ++i) {
+      ok = (c1[i] == static_cast<double>(i)) &&
+           (std::abs(c3[i] + 1.e-3 * i) <= 1e-14 * i);
+    }
+    TFEL_TESTS_ASSERT(ok);
+  }  // end of test3
+};
+
+TFEL_TESTS_GENERATE_PROXY(TextDataTest, "TextDataTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("TextDataTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -45,6 +45,11 @@ namespace tfel::check {
      * replaced by value.
      */
     std::map<std::string, std::string> substitutions;
+    /*!
+     * \brief if true, the tests whose inputs did not change since their
+     * last successful execution are not executed again.
+     */
+    bool use_cache = false;
     //! global logger
     PCLogger log;
   };  // end of struct Configuration
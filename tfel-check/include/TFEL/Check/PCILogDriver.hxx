@@ -52,6 +52,15 @@ namespace tfel::check {
      * \param[in] d: description of the test
      */
     virtual void reportSkippedTest(const std::string&) = 0;
+    /*!
+     * \brief report that a test has not been executed because its
+     * result was found in the cache of `tfel-check`.
+     *
+     * By default, the test is reported as a successful test.
+     *
+     * \param[in] d: description of the test
+     */
+    virtual void reportCachedTest(const std::string&);
     /*!
      * \brief add a test result to log.
      * Append a test result to log (to be implemented by inherited class).
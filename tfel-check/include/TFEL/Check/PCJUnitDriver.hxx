@@ -38,6 +38,7 @@ namespace tfel::check {
                        const bool,
                        const std::string& = "") override;
     void reportSkippedTest(const std::string&) override;
+    void reportCachedTest(const std::string&) override;
     void terminate() override;
     //! destructor
     ~PCJUnitDriver() override;
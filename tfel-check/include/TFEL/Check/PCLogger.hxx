@@ -69,6 +69,12 @@ namespace tfel::check {
      * \param[in] d: description of the test
      */
     void reportSkippedTest(const std::string&);
+    /*!
+     * \brief report that the result of a test has been taken from the
+     * cache
+     * \param[in] d: description of the test
+     */
+    void reportCachedTest(const std::string&);
     /*!
      * \brief add a simple test result to all log outputs
      *
@@ -0,0 +1,88 @@
+/*!
+ * \file PCRecordDriver.hxx
+ * \brief log driver recording the messages and the test results
+ *
+ * The recorded entries can be saved in a stream, read back and replayed
+ * in another logger. This is used to merge the reports of tests executed
+ * concurrently by `tfel-check`.
+ *
+ * \author Thomas Helfer
+ * \date 19/10/2026
+ *
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFELCHECK_PCRECORDDRIVER_HXX
+#define LIB_TFELCHECK_PCRECORDDRIVER_HXX
+
+#include <vector>
+#include <string>
+#include <iosfwd>
+#include "TFEL/Check/TFELCheckConfig.hxx"
+#include "TFEL/Check/PCILogDriver.hxx"
+
+namespace tfel::check {
+
+  // forward declaration
+  struct PCLogger;
+
+  struct TFELCHECK_VISIBILITY_EXPORT PCRecordDriver : public PCILogDriver {
+    PCRecordDriver();
+    void addMessage(const std::string&) override;
+    void reportSkippedTest(const std::string&) override;
+    void reportCachedTest(const std::string&) override;
+    void addTestResult(const std::string&,
+                       const std::string&,
+                       const std::string&,
+                       const float,
+                       bool,
+                       const std::string& = "") override;
+    /*!
+     * \brief send the recorded entries to the given logger
+     * \param[in] l: logger
+     */
+    void replay(PCLogger&) const;
+    /*!
+     * \brief save the recorded entries
+     * \param[out] os: output stream
+     */
+    void write(std::ostream&) const;
+    /*!
+     * \brief read entries saved by the `write` method. Those entries are
+     * appended to the recorded ones.
+     * \param[in] is: input stream
+     */
+    void read(std::istream&);
+    //! destructor
+    ~PCRecordDriver() override;
+
+   private:
+    //! \brief a recorded entry
+    struct Entry {
+      //! \brief type of the entry
+      enum { MESSAGE, SKIPPEDTEST, TESTRESULT, CACHEDTEST } type = MESSAGE;
+      //! \brief message or description of the test
+      std::string testname;
+      //! \brief step
+      std::string step;
+      //! \brief command
+      std::string command;
+      //! \brief message associated with a test result
+      std::string message;
+      //! \brief execution time
+      float time = 0;
+      //! \brief success
+      bool success = true;
+    };
+    //! \brief recorded entries
+    std::vector<Entry> entries;
+  };
+
+}  // end of namespace tfel::check
+
+#endif /* LIB_TFELCHECK_PCRECORDDRIVER_HXX */
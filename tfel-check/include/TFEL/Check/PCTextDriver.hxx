@@ -29,6 +29,7 @@ namespace tfel::check {
     PCTextDriver(const std::string&);
     void addMessage(const std::string&) override;
     void reportSkippedTest(const std::string&) override;
+    void reportCachedTest(const std::string&) override;
     void addTestResult(const std::string&,
                        const std::string&,
                        const std::string&,
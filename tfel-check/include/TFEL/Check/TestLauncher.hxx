@@ -117,10 +117,27 @@ namespace tfel::check {
     void treatInterpolation();
     //! \brief treat the `@Requires` keyword
     void treatRequires();
+    //! \brief treat the `@DependsOn` keyword
+    void treatDependsOn();
     //! \brief treat the `@CleanFiles` keyword
     void treatCleanFiles();
     //! \brief treat the `@CleanDirectories` keyword
     void treatCleanDirectories();
+    /*!
+     * \return a key identifying the inputs of the tests.
+     *
+     * This key is built by hashing:
+     *
+     * - the content of the input file after substitutions,
+     * - the environment variables defined by the `@Environment` keyword,
+     * - the content of the existing files referenced in the input file,
+     * - the size and the modification time of the shared libraries and
+     *   executables referenced in the input file or in the files it
+     *   references.
+     */
+    std::string computeCacheKey() const;
+    //! \return the name of the file storing the key of the last success
+    std::string getCacheFile() const;
     /*!
      * \brief register the error and throw an runtime_error
      * \param[in] m:   calling method
@@ -165,6 +182,10 @@ namespace tfel::check {
     std::map<std::string, std::string> environments;
     //! list of requirements
     std::vector<std::string> requirements;
+    //! \brief tokens of the input file, after substitutions
+    std::string input_content;
+    //! \brief strings, or words in strings, that may designate files
+    std::vector<std::string> references;
     //! iterator to the current file token
     const_iterator current;
     //! list of files comparison to be made
@@ -197,6 +218,17 @@ namespace tfel::check {
 
   // end of struct TestLauncher
 
+  /*!
+   * \return the list of the tests on which the tests described in the
+   * given file depend, as declared by the `@DependsOn` keyword.
+   * \param[in] f: input file
+   *
+   * \note the paths of the returned files are relative to the directory
+   * of the input file.
+   */
+  TFELCHECK_VISIBILITY_EXPORT std::vector<std::string> getTestDependencies(
+      const std::string&);
+
 }  // end of namespace tfel::check
 
 #endif /* LIB_TFELCHECK_TESTLAUNCHER_HXX */
@@ -30,6 +30,11 @@ namespace tfel::check {
     this->getStream() << "<!-- test '" << d << "' has been skipped -->\n";
   }  // end of PCJUnitDriver::reportSkippedTest
 
+  void PCJUnitDriver::reportCachedTest(const std::string& d) {
+    this->getStream() << "<!-- test '" << d
+                      << "' has been taken from the cache -->\n";
+  }  // end of PCJUnitDriver::reportCachedTest
+
   void PCJUnitDriver::addTestResult(const std::string& testname,
                                     const std::string& step,
                                     const std::string& command,
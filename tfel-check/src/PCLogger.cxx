@@ -38,6 +38,12 @@ namespace tfel::check {
     }
   }
 
+  void PCLogger::reportCachedTest(const std::string& d) {
+    for (auto& driver : this->drivers) {
+      driver->reportCachedTest(d);
+    }
+  }
+
   void PCLogger::addMessage(const std::string& message) {
     for (auto& driver : this->drivers) {
       driver->addMessage(message);
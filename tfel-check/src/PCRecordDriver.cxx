@@ -0,0 +1,138 @@
+/*!
+ * \brief log driver recording the messages and the test results
+ *
+ * \file PCRecordDriver.cxx
+ *
+ * \author Thomas Helfer
+ * \date 19/10/2026
+ *
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <istream>
+#include <ostream>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Check/PCLogger.hxx"
+#include "TFEL/Check/PCRecordDriver.hxx"
+
+namespace tfel::check {
+
+  static void PCRecordDriverWriteString(std::ostream& os,
+                                        const std::string& s) {
+    os << s.size() << ' ' << s << '\n';
+  }  // end of PCRecordDriverWriteString
+
+  static std::string PCRecordDriverReadString(std::istream& is) {
+    auto n = std::string::size_type{};
+    is >> n;
+    is.get();
+    auto s = std::string(n, '\0');
+    is.read(s.data(), static_cast<std::streamsize>(n));
+    is.get();
+    raise_if(!is, "PCRecordDriver::read: invalid entry");
+    return s;
+  }  // end of PCRecordDriverReadString
+
+  PCRecordDriver::PCRecordDriver() = default;
+
+  void PCRecordDriver::addMessage(const std::string& m) {
+    auto e = Entry{};
+    e.type = Entry::MESSAGE;
+    e.testname = m;
+    this->entries.push_back(std::move(e));
+  }  // end of addMessage
+
+  void PCRecordDriver::reportSkippedTest(const std::string& d) {
+    auto e = Entry{};
+    e.type = Entry::SKIPPEDTEST;
+    e.testname = d;
+    this->entries.push_back(std::move(e));
+  }  // end of reportSkippedTest
+
+  void PCRecordDriver::reportCachedTest(const std::string& d) {
+    auto e = Entry{};
+    e.type = Entry::CACHEDTEST;
+    e.testname = d;
+    this->entries.push_back(std::move(e));
+  }  // end of reportCachedTest
+
+  void PCRecordDriver::addTestResult(const std::string& testname,
+                                     const std::string& step,
+                                     const std::string& command,
+                                     const float time,
+                                     const bool success,
+                                     const std::string& message) {
+    auto e = Entry{};
+    e.type = Entry::TESTRESULT;
+    e.testname = testname;
+    e.step = step;
+    e.command = command;
+    e.message = message;
+    e.time = time;
+    e.success = success;
+    this->entries.push_back(std::move(e));
+  }  // end of addTestResult
+
+  void PCRecordDriver::replay(PCLogger& l) const {
+    for (const auto& e : this->entries) {
+      if (e.type == Entry::MESSAGE) {
+        l.addMessage(e.testname);
+      } else if (e.type == Entry::SKIPPEDTEST) {
+        l.reportSkippedTest(e.testname);
+      } else if (e.type == Entry::CACHEDTEST) {
+        l.reportCachedTest(e.testname);
+      } else {
+        l.addTestResult(e.testname, e.step, e.command, e.time, e.success,
+                        e.message);
+      }
+    }
+  }  // end of replay
+
+  void PCRecordDriver::write(std::ostream& os) const {
+    os << this->entries.size() << '\n';
+    for (const auto& e : this->entries) {
+      os << static_cast<int>(e.type) << ' ' << e.time << ' '
+         << (e.success ? 1 : 0) << '\n';
+      for (const auto* s : {&e.testname, &e.step, &e.command, &e.message}) {
+        PCRecordDriverWriteString(os, *s);
+      }
+    }
+  }  // end of write
+
+  void PCRecordDriver::read(std::istream& is) {
+    auto n = std::vector<Entry>::size_type{};
+    is >> n;
+    raise_if(!is, "PCRecordDriver::read: invalid number of entries");
+    for (decltype(n) i = 0; i != n; ++i) {
+      auto e = Entry{};
+      auto type = int{};
+      auto success = int{};
+      is >> type >> e.time >> success;
+      raise_if((!is) || (type < 0) || (type > 3),
+               "PCRecordDriver::read: invalid entry");
+      is.get();
+      if (type == 0) {
+        e.type = Entry::MESSAGE;
+      } else if (type == 1) {
+        e.type = Entry::SKIPPEDTEST;
+      } else if (type == 2) {
+        e.type = Entry::TESTRESULT;
+      } else {
+        e.type = Entry::CACHEDTEST;
+      }
+      e.success = success != 0;
+      for (auto* s : {&e.testname, &e.step, &e.command, &e.message}) {
+        *s = PCRecordDriverReadString(is);
+      }
+      this->entries.push_back(std::move(e));
+    }
+  }  // end of read
+
+  PCRecordDriver::~PCRecordDriver() = default;
+
+}  // end of namespace tfel::check
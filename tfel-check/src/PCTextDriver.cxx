@@ -64,6 +64,23 @@ namespace tfel::check {
     os << '\n';
   }  // end of PCTextDriver::reportSkippedTest
 
+  void PCTextDriver::reportCachedTest(const std::string& d) {
+    using tfel::utilities::TerminalColors;
+    auto msg = formatMessage(d, "");
+    if (msg.size() > 67) {
+      msg.resize(64);
+      msg += "...";
+    }
+    // format with 80 char width
+    auto& os = this->getStream();
+    os << std::setw(67) << std::left << std::setfill(' ') << msg
+       << std::setfill(' ') << std::right << std::setw(13);
+    setStreamColor(os, TerminalColors::Green);
+    os << "[CACHED-PASS]";
+    setStreamColor(os, TerminalColors::Reset);
+    os << '\n';
+  }  // end of PCTextDriver::reportCachedTest
+
   void PCTextDriver::addTestResult(const std::string& testname,
                                    const std::string& step,
                                    const std::string& command,
@@ -11,6 +11,9 @@
  * project under specific licensing conditions.
  */
 
+#include <set>
+#include <cstdio>
+#include <cstdint>
 #include <iterator>
 #include <algorithm>
 #include <fstream>
@@ -22,6 +25,7 @@
 #include <ctime>
 #include <regex>
 #include <unistd.h>  // sysconf
+#include <sys/stat.h>
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/System/System.hxx"
@@ -72,6 +76,7 @@ namespace tfel::check {
     this->ClockAction(GET);
     // callbacks
     this->registerCallBack("@Requires", &TestLauncher::treatRequires);
+    this->registerCallBack("@DependsOn", &TestLauncher::treatDependsOn);
     this->registerCallBack("@Environment", &TestLauncher::treatEnvironment);
     this->registerCallBack("@Command", &TestLauncher::treatCommand);
     this->registerCallBack("@Test", &TestLauncher::treatTest);
@@ -180,6 +185,13 @@ namespace tfel::check {
     this->readSpecifiedToken("TestLauncher::treatRequires", ";");
   }  // end of treatRequires
 
+  void TestLauncher::treatDependsOn() {
+    // dependencies are handled by the scheduler of `tfel-check` before
+    // the test is executed
+    CxxTokenizer::readStringArray(this->current, this->end());
+    this->readSpecifiedToken("TestLauncher::treatDependsOn", ";");
+  }  // end of treatDependsOn
+
   void TestLauncher::treatCleanFiles() {
     const auto files =
         CxxTokenizer::readStringArray(this->current, this->end());
@@ -632,6 +644,25 @@ namespace tfel::check {
         t.value = tfel::utilities::replace_all(t.value, s.first, s.second);
       }
     }
+    // data used to build the key of the cache
+    if (c.use_cache) {
+      for (const auto& t : this->tokens) {
+        this->input_content += t.value + '\n';
+        if ((t.flag != tfel::utilities::Token::String) &&
+            (t.flag != tfel::utilities::Token::Char)) {
+          continue;
+        }
+        const auto v = t.value.substr(1, t.value.size() - 2);
+        this->references.push_back(v);
+        for (const auto& w : tfel::utilities::tokenize(v, ' ')) {
+          this->references.push_back(w);
+          const auto pos = w.find('=');
+          if (pos != std::string::npos) {
+            this->references.push_back(w.substr(pos + 1));
+          }
+        }
+      }
+    }
     // starts parsing the file
     this->current = this->begin();
     while (this->current != this->end()) {
@@ -665,6 +696,115 @@ namespace tfel::check {
     return content;
   }  // end of getSourceFileContent
 
+  /*!
+   * \brief update a hash value using the FNV-1a algorithm
+   * \param[in,out] h: hash value
+   * \param[in] s: data
+   */
+  static void updateCacheKey(std::uint64_t& h, const std::string_view s) {
+    for (const auto c : s) {
+      h ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+      h *= std::uint64_t{1099511628211u};
+    }
+    // separator
+    h ^= std::uint64_t{0xff};
+    h *= std::uint64_t{1099511628211u};
+  }  // end of updateCacheKey
+
+  /*!
+   * \return if the given file shall be identified by its size and its
+   * modification time rather than by its content
+   * \param[in] f: file name
+   * \param[in] s: information about the file
+   */
+  static bool isIdentifiedByModificationTime(const std::string& f,
+                                             const struct stat& s) {
+#ifndef _WIN32
+    if ((s.st_mode & S_IXUSR) != 0) {
+      return true;
+    }
+#else  /* _WIN32 */
+    static_cast<void>(s);
+#endif /* _WIN32 */
+    return tfel::utilities::ends_with(f, ".so") ||
+           tfel::utilities::ends_with(f, ".dylib") ||
+           tfel::utilities::ends_with(f, ".dll") ||
+           (f.find(".so.") != std::string::npos);
+  }  // end of isIdentifiedByModificationTime
+
+  /*!
+   * \brief update the key with the size and the modification time of a
+   * file
+   * \param[in,out] h: hash value
+   * \param[in] f: file name
+   * \param[in] s: information about the file
+   */
+  static void updateCacheKey(std::uint64_t& h,
+                             const std::string& f,
+                             const struct stat& s) {
+    updateCacheKey(h, f);
+    updateCacheKey(h, std::to_string(static_cast<long long>(s.st_size)));
+    updateCacheKey(h, std::to_string(static_cast<long long>(s.st_mtime)));
+  }  // end of updateCacheKey
+
+  std::string TestLauncher::getCacheFile() const {
+    return this->testname + ".checkcache";
+  }  // end of getCacheFile
+
+  std::string TestLauncher::computeCacheKey() const {
+    auto h = std::uint64_t{14695981039346656037u};
+    updateCacheKey(h, this->input_content);
+    for (const auto& [k, v] : this->environments) {
+      updateCacheKey(h, k);
+      updateCacheKey(h, v);
+    }
+    auto treated = std::set<std::string>{};
+    // shared libraries and executables are identified by their size and
+    // modification time
+    auto treat_binary_file = [&h, &treated](const std::string& f) {
+      struct stat s;
+      if ((f.empty()) || (!treated.insert(f).second) ||
+          (::stat(f.c_str(), &s) != 0) || (!S_ISREG(s.st_mode)) ||
+          (!isIdentifiedByModificationTime(f, s))) {
+        return;
+      }
+      updateCacheKey(h, f, s);
+    };
+    for (const auto& r : this->references) {
+      struct stat s;
+      if ((r.empty()) || (treated.count(r) != 0) ||
+          (::stat(r.c_str(), &s) != 0) || (!S_ISREG(s.st_mode))) {
+        continue;
+      }
+      if (isIdentifiedByModificationTime(r, s)) {
+        treat_binary_file(r);
+        continue;
+      }
+      treated.insert(r);
+      std::ifstream in(r, std::ios::binary);
+      const auto content = std::string{std::istreambuf_iterator<char>{in},
+                                       std::istreambuf_iterator<char>{}};
+      updateCacheKey(h, r);
+      updateCacheKey(h, content);
+      // quoted strings may designate shared libraries, such as the
+      // libraries declared by the `@Behaviour` keyword of `mtest` files
+      for (auto p = content.find_first_of("'\""); p != std::string::npos;
+           p = content.find_first_of("'\"", p)) {
+        const auto e = content.find_first_of(std::string{content[p]} + '\n',
+                                             p + 1);
+        if ((e == std::string::npos) || (content[e] == '\n')) {
+          p = e;
+          continue;
+        }
+        treat_binary_file(content.substr(p + 1, e - p - 1));
+        p = e + 1;
+      }
+    }
+    std::ostringstream key;
+    key << std::hex << h;
+    return key.str();
+  }  // end of computeCacheKey
+
   double TestLauncher::ClockAction(ClockEventType clockevent) {
     using namespace std;
     if (clockevent == START) {
@@ -740,6 +880,33 @@ namespace tfel::check {
         return gsuccess;
       }
     }
+    // checking if the results of the last execution can be reused
+    if (configuration.use_cache) {
+      std::ifstream in(this->getCacheFile());
+      auto key = std::string{};
+      if ((in >> key) && (key == this->computeCacheKey())) {
+        unsigned short i = 1;
+        for (const auto& c : this->commands) {
+          const auto step = "Exec-" + std::to_string(i);
+          this->log.reportCachedTest(this->testname + ":" + step);
+          this->glog.reportCachedTest("** " + step + " " + c.command);
+          ++i;
+        }
+        i = 1;
+        for (const auto& c : this->comparisons) {
+          const auto step = "Compare-" + std::to_string(i);
+          this->log.reportCachedTest(this->testname + ":" + step);
+          this->glog.reportCachedTest("** " + step + " '" + c.getFileA() +
+                                      "' and '" + c.getFileB() +
+                                      "', column '" +
+                                      c.getColA()->getName() + "' ");
+          ++i;
+        }
+        return true;
+      }
+    }
+    // only tests whose steps all succeeded are cached
+    auto all_steps_succeeded = true;
     // Execute
     unsigned short i = 1;
     for (const auto& c : this->commands) {
@@ -747,6 +914,7 @@ namespace tfel::check {
       const auto output_file = this->testname + "-" + step + ".out";
       const auto success = this->execute(c, output_file, step);
       this->glog.addSimpleTestResult("** " + step + " " + c.command, success);
+      all_steps_succeeded = all_steps_succeeded && success;
       if ((!success) && (this->comparisons.empty())) {
         gsuccess = false;
       }
@@ -780,6 +948,7 @@ namespace tfel::check {
           "** " + step + " '" + c.getFileA() + "' and '" + c.getFileB() +
               "', column '" + c.getColA()->getName() + "' ",
           success);
+      all_steps_succeeded = all_steps_succeeded && success;
     }
     // files and directories clean-up
     for (const auto& f : this->cleanfiles) {
@@ -788,9 +957,38 @@ namespace tfel::check {
     for (const auto& d : this->cleandirectories) {
       tfel::system::systemCall::rmdir(d);
     }
+    // the key is computed after the execution, so that the output files
+    // referenced in the input file are taken into account
+    if (configuration.use_cache) {
+      if ((gsuccess) && (all_steps_succeeded)) {
+        std::ofstream out(this->getCacheFile());
+        out << this->computeCacheKey() << '\n';
+      } else {
+        std::remove(this->getCacheFile().c_str());
+      }
+    }
     return gsuccess;
   }  // end of execute
 
   TestLauncher::~TestLauncher() { this->log.terminate(); }
 
+  std::vector<std::string> getTestDependencies(const std::string& f) {
+    auto dependencies = std::vector<std::string>{};
+    tfel::utilities::CxxTokenizer t;
+    t.treatCharAsString(true);
+    t.mergeStrings(false);
+    t.openFile(f);
+    t.stripComments();
+    for (auto p = t.begin(); p != t.end();) {
+      if (p->value != "@DependsOn") {
+        ++p;
+        continue;
+      }
+      ++p;
+      const auto d = tfel::utilities::CxxTokenizer::readStringArray(p, t.end());
+      dependencies.insert(dependencies.end(), d.begin(), d.end());
+    }
+    return dependencies;
+  }  // end of getTestDependencies
+
 }  // end of namespace tfel::check
@@ -12,6 +12,7 @@
  */
 
 #include <map>
+#include <set>
 #include <vector>
 #include <string>
 #include <cstring>
@@ -22,8 +23,14 @@
 #include <algorithm>
 #include <iostream>
 #include <climits>
+#include <charconv>
+#include <system_error>
+#include <fstream>
 #include <unistd.h>
 #include <libgen.h>
+#ifndef _WIN32
+#include <sys/wait.h>
+#endif /* _WIN32 */
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
@@ -42,6 +49,7 @@
 #include "TFEL/Check/TestLauncherV1.hxx"
 #include "TFEL/Check/PCLogger.hxx"
 #include "TFEL/Check/PCTextDriver.hxx"
+#include "TFEL/Check/PCRecordDriver.hxx"
 #include "TFEL/Check/PCJUnitDriver.hxx"
 
 namespace tfel::check {
@@ -114,6 +122,31 @@ namespace tfel::check {
     ~TFELCheck() override;
 
    protected:
+    //! \brief description of a `.check` file to be executed
+    struct CheckFile {
+      //! \brief directory
+      std::string directory;
+      //! \brief file name
+      std::string file;
+      //! \brief indices of the files on which this file depends
+      std::vector<std::size_t> dependencies;
+    };
+    /*!
+     * \brief execute the tests described in a `.check` file
+     * \return true on success
+     * \param[in] log: logger
+     * \param[in] d: directory
+     * \param[in] f: file name
+     */
+    bool executeCheckFile(PCLogger&, const std::string&, const std::string&);
+    /*!
+     * \brief execute the given `.check` files, using at most `jobs`
+     * processes, and report the results in the order of the files.
+     * \return true on success
+     * \param[in] log: logger
+     * \param[in] files: `.check` files
+     */
+    bool executeCheckFiles(PCLogger&, const std::vector<CheckFile>&);
     /*!
      * \brief method called while parsing unregistred command line
      * arguments.
@@ -133,6 +166,10 @@ namespace tfel::check {
     std::vector<std::string> configFiles;
     //! list of input files
     std::vector<std::string> inputs;
+    //! \brief maximum number of `.check` files treated concurrently
+    unsigned int jobs = 1;
+    //! \brief if true, the results of the previous executions are reused
+    bool use_cache = false;
   };  // end of struct TFELCheck
 
   bool TFELCheck::treatSubstitution() {
@@ -191,6 +228,31 @@ namespace tfel::check {
                    parse(this->configurations, f);
                  },
                  true));
+    declare2("--jobs", "-j",
+             CallBack(
+                 "maximum number of test files treated concurrently",
+                 [this] {
+                   const auto& o = this->currentArgument->getOption();
+                   auto n = 0u;
+                   const auto r =
+                       std::from_chars(o.data(), o.data() + o.size(), n);
+                   tfel::raise_if((r.ec != std::errc{}) ||
+                                      (r.ptr != o.data() + o.size()) ||
+                                      (n == 0),
+                                  "TFELCheck::registerArgumentCallBacks: "
+                                  "invalid number of jobs '" +
+                                      o +
+                                      "' (must be a strictly "
+                                      "positive integer)");
+                   this->jobs = n;
+                 },
+                 true));
+    this->registerCallBack(
+        "--cache",
+        CallBack(
+            "do not execute again the tests whose inputs did not change "
+            "since their last successful execution",
+            [this] { this->use_cache = true; }, false));
     this->registerCallBack(
         "--list-default-components",
         CallBack(
@@ -223,62 +285,216 @@ namespace tfel::check {
     declareTFELExecutables(this->configurations);
   }  // end of TFELCheck::TFELCheck
 
-  int TFELCheck::execute() {
-    using namespace std;
-    auto log = PCLogger(std::make_shared<PCTextDriver>("tfel-check.log"));
-    log.addDriver(std::make_shared<PCTextDriver>());
-    auto exe = [this, &log](const std::string& d, const std::string& f) {
-      using namespace tfel::system;
-      const auto cpath = systemCall::getCurrentWorkingDirectory();
-      const auto path = systemCall::getAbsolutePath(d);
-      log.addMessage("entering directory '" + path + "'");
-      try {
-        systemCall::changeCurrentWorkingDirectory(d);
-      } catch (std::exception& e) {
-        log.addMessage("can't move to directory '" + d + "' (" +
-                       std::string(e.what()) + ")");
-        log.addSimpleTestResult("* result of test '" + d + '/' + f + "'",
-                                false);
-        return false;
+  bool TFELCheck::executeCheckFile(PCLogger& log,
+                                   const std::string& d,
+                                   const std::string& f) {
+    using namespace tfel::system;
+    const auto cpath = systemCall::getCurrentWorkingDirectory();
+    const auto path = systemCall::getAbsolutePath(d);
+    log.addMessage("entering directory '" + path + "'");
+    try {
+      systemCall::changeCurrentWorkingDirectory(d);
+    } catch (std::exception& e) {
+      log.addMessage("can't move to directory '" + d + "' (" +
+                     std::string(e.what()) + ")");
+      log.addSimpleTestResult("* result of test '" + d + '/' + f + "'", false);
+      return false;
+    }
+    log.addMessage("* beginning of test '" + d + '/' + f + "'");
+    auto success = true;
+    try {
+      auto c = this->configurations.getConfiguration(d);
+      c.log = log;
+      c.use_cache = this->use_cache;
+      TestLauncher t(c, f);
+      success = t.execute(c);
+    } catch (std::exception& e) {
+      log.addMessage("test failed : '" + f + "', reason:\n" + e.what());
+      success = false;
+    }
+    log.addSimpleTestResult("* end of test '" + d + '/' + f + "'", success);
+    log.addMessage("======");
+    try {
+      systemCall::changeCurrentWorkingDirectory(cpath);
+    } catch (std::exception& e) {
+      log.addMessage("can't move back to top directory '" + cpath + "' (" +
+                     std::string(e.what()) + ")");
+      log.addMessage("Aborting");
+      log.terminate();
+      exit(EXIT_FAILURE);
+    }
+    return success;
+  }  // end of executeCheckFile
+
+  bool TFELCheck::executeCheckFiles(PCLogger& log,
+                                    const std::vector<CheckFile>& files) {
+    enum { PENDING, RUNNING, SUCCEEDED, FAILED };
+    const auto n = files.size();
+    auto states = std::vector<int>(n, PENDING);
+    auto records = std::vector<std::shared_ptr<PCRecordDriver>>(n);
+    auto status = true;
+    // the results are reported in the order of the files, whatever the
+    // order in which the tests are completed
+    auto next = std::size_t{};
+    auto report = [&] {
+      while ((next != n) &&
+             ((states[next] == SUCCEEDED) || (states[next] == FAILED))) {
+        records[next]->replay(log);
+        status = status && (states[next] == SUCCEEDED);
+        ++next;
       }
-      log.addMessage("* beginning of test '" + d + '/' + f + "'");
-      const auto name = d + '/' + f;
-      auto success = true;
-      try {
-        // if(this->file_version==TestLauncher::V1){
-        // 	TestLauncherV1 c(f,log);
-        // 	success = c.execute();
-        // } else {
-        auto c = this->configurations.getConfiguration(d);
-        c.log = log;
-        TestLauncher t(c, f);
-        success = t.execute(c);
-        //      }
-      } catch (std::exception& e) {
-        log.addMessage("test failed : '" + f + "', reason:\n" + e.what());
-        success = false;
+    };
+    auto fail = [&files, &states, &records](const std::size_t i,
+                                            const std::string& msg) {
+      const auto& cf = files[i];
+      records[i] = std::make_shared<PCRecordDriver>();
+      records[i]->addMessage(msg);
+      records[i]->addTestResult(
+          "* end of test '" + cf.directory + '/' + cf.file + "'", "", "", 0,
+          false);
+      states[i] = FAILED;
+    };
+    auto run = [this, &files, &states, &records](const std::size_t i) {
+      const auto& cf = files[i];
+      records[i] = std::make_shared<PCRecordDriver>();
+      auto l = PCLogger(records[i]);
+      const auto s = this->executeCheckFile(l, cf.directory, cf.file);
+      states[i] = s ? SUCCEEDED : FAILED;
+    };
+#ifndef _WIN32
+    const auto cwd = tfel::system::systemCall::getCurrentWorkingDirectory();
+    const auto ppid = std::to_string(::getpid());
+    auto get_record_file = [&cwd, &ppid](const std::size_t i) {
+      return cwd + tfel::system::dirSeparator() + ".tfel-check-" + ppid + "-" +
+             std::to_string(i) + ".log";
+    };
+    // running processes
+    auto processes = std::map<pid_t, std::size_t>{};
+#endif /* _WIN32 */
+    // directories in which a test is running
+    auto directories = std::set<std::string>{};
+    auto nrunning = std::size_t{};
+    while (next != n) {
+      // launching the tests whose dependencies are met
+      auto progress = false;
+      for (std::size_t i = 0; (i != n) && (nrunning < this->jobs); ++i) {
+        if (states[i] != PENDING) {
+          continue;
+        }
+        const auto& cf = files[i];
+        auto ready = true;
+        for (const auto& dep : cf.dependencies) {
+          if (states[dep] == FAILED) {
+            fail(i, "test '" + cf.directory + '/' + cf.file +
+                        "' not executed: its dependency '" +
+                        files[dep].directory + '/' + files[dep].file +
+                        "' failed");
+            ready = false;
+            progress = true;
+            break;
+          }
+          ready = ready && (states[dep] == SUCCEEDED);
+        }
+        // tests in the same directory may share output files, so they
+        // are never executed concurrently
+        if ((states[i] != PENDING) || (!ready) ||
+            (directories.count(cf.directory) != 0)) {
+          continue;
+        }
+        progress = true;
+#ifndef _WIN32
+        if (this->jobs > 1) {
+          std::cout.flush();
+          const auto pid = ::fork();
+          if (pid == -1) {
+            // fallback to a sequential execution
+            run(i);
+            continue;
+          }
+          if (pid == 0) {
+            // child process
+            auto r = std::make_shared<PCRecordDriver>();
+            auto l = PCLogger(r);
+            auto s = false;
+            try {
+              s = this->executeCheckFile(l, cf.directory, cf.file);
+            } catch (...) {
+            }
+            std::ofstream out(get_record_file(i));
+            r->write(out);
+            out.close();
+            ::_exit((s && out) ? EXIT_SUCCESS : EXIT_FAILURE);
+          }
+          processes[pid] = i;
+          directories.insert(cf.directory);
+          states[i] = RUNNING;
+          ++nrunning;
+          continue;
+        }
+#endif /* _WIN32 */
+        run(i);
       }
-      log.addSimpleTestResult("* end of test '" + d + '/' + f + "'", success);
-      log.addMessage("======");
+      report();
+      if ((nrunning == 0) && (progress)) {
+        continue;
+      }
+      if (nrunning == 0) {
+        // no test is running and no test can be launched: the remaining
+        // tests have circular dependencies
+        for (auto i = next; i != n; ++i) {
+          if (states[i] == PENDING) {
+            fail(i, "test '" + files[i].directory + '/' + files[i].file +
+                        "' not executed: circular dependencies detected");
+          }
+        }
+        report();
+        continue;
+      }
+#ifndef _WIN32
+      // waiting for a process to finish
+      auto wstatus = int{};
+      const auto pid = ::waitpid(-1, &wstatus, 0);
+      const auto p = processes.find(pid);
+      if (p == processes.end()) {
+        continue;
+      }
+      const auto i = p->second;
+      processes.erase(p);
+      directories.erase(files[i].directory);
+      --nrunning;
+      const auto rf = get_record_file(i);
+      std::ifstream in(rf);
       try {
-        systemCall::changeCurrentWorkingDirectory(cpath);
+        tfel::raise_if(!in, "no report found");
+        records[i] = std::make_shared<PCRecordDriver>();
+        records[i]->read(in);
+        in.close();
+        ::unlink(rf.c_str());
+        states[i] = (WIFEXITED(wstatus) && (WEXITSTATUS(wstatus) == 0))
+                        ? SUCCEEDED
+                        : FAILED;
       } catch (std::exception& e) {
-        log.addMessage("can't move back to top directory '" + cpath + "' (" +
-                       std::string(e.what()) + ")");
-        log.addMessage("Aborting");
-        exit(EXIT_FAILURE);
+        ::unlink(rf.c_str());
+        fail(i, "test '" + files[i].directory + '/' + files[i].file +
+                    "' terminated abnormally (" + std::string(e.what()) +
+                    ")");
       }
-      return success;
-    };
-    int status = EXIT_SUCCESS;
+      report();
+#endif /* _WIN32 */
+    }
+    return status;
+  }  // end of executeCheckFiles
+
+  int TFELCheck::execute() {
+    auto log = PCLogger(std::make_shared<PCTextDriver>("tfel-check.log"));
+    log.addDriver(std::make_shared<PCTextDriver>());
+    auto files = std::vector<CheckFile>{};
     if (this->inputs.empty()) {
       std::regex re(".+\\.check", std::regex_constants::extended);
-      const auto& files = tfel::system::recursiveFind(re, ".", 0);
-      for (const auto& d : files) {
+      const auto& found = tfel::system::recursiveFind(re, ".", 0);
+      for (const auto& d : found) {
         for (const auto& f : d.second) {
-          if (!exe(d.first, f)) {
-            status = EXIT_FAILURE;
-          }
+          files.push_back({d.first, f, {}});
         }
       }
     } else {
@@ -289,14 +505,49 @@ namespace tfel::check {
         const auto f = std::string(::basename(path2));
         ::free(path);
         ::free(path2);
-        // basename
-        if (!exe(d, f)) {
-          status = EXIT_FAILURE;
+        files.push_back({d, f, {}});
+      }
+    }
+    // dependencies, declared by the `@DependsOn` keyword
+    auto normalise = [](const std::string& p) {
+      const auto path = strdup(p.c_str());
+      const auto path2 = strdup(path);
+      auto r = p;
+      try {
+        r = tfel::system::systemCall::getAbsolutePath(::dirname(path)) +
+            tfel::system::dirSeparator() + ::basename(path2);
+      } catch (...) {
+      }
+      ::free(path);
+      ::free(path2);
+      return r;
+    };
+    auto paths = std::vector<std::string>{};
+    for (const auto& cf : files) {
+      paths.push_back(normalise(cf.directory + '/' + cf.file));
+    }
+    for (auto& cf : files) {
+      auto dependencies = std::vector<std::string>{};
+      try {
+        dependencies = getTestDependencies(cf.directory + '/' + cf.file);
+      } catch (std::exception&) {
+        // errors are reported when the file is executed
+      }
+      for (const auto& dep : dependencies) {
+        const auto p = std::find(paths.begin(), paths.end(),
+                                 normalise(cf.directory + '/' + dep));
+        if (p == paths.end()) {
+          log.addMessage("dependency '" + dep + "' of '" + cf.directory +
+                         '/' + cf.file + "' is not part of the tests");
+          continue;
         }
+        cf.dependencies.push_back(
+            static_cast<std::size_t>(p - paths.begin()));
       }
     }
+    const auto status = this->executeCheckFiles(log, files);
     log.terminate();
-    return status;
+    return status ? EXIT_SUCCESS : EXIT_FAILURE;
   }
 
   TFELCheck::~TFELCheck() = default;
@@ -306,6 +557,11 @@ namespace tfel::check {
 int main(const int argc, const char* const* const argv) {
   mfront::initDSLs();
   mfront::initInterfaces();
-  tfel::check::TFELCheck check(argc, argv);
-  return check.execute();
+  try {
+    tfel::check::TFELCheck check(argc, argv);
+    return check.execute();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << std::endl;
+  }
+  return EXIT_FAILURE;
 }  // end of main
@@ -0,0 +1,62 @@
+# This script checks the `--cache` option of `tfel-check`:
+#
+# - the first execution of a test file runs its commands;
+# - the second execution, with unchanged inputs, is a cache hit;
+# - the third execution, after a modification of an input file, runs
+#   the commands again.
+
+# arguments checking
+if(NOT TFEL_CHECK)
+  message(FATAL_ERROR "Require TFEL_CHECK to be defined")
+endif(NOT TFEL_CHECK)
+if(NOT CHECK_FILE)
+  message(FATAL_ERROR "Require CHECK_FILE to be defined")
+endif(NOT CHECK_FILE)
+if(NOT WORKING_DIRECTORY)
+  message(FATAL_ERROR "Require WORKING_DIRECTORY to be defined")
+endif(NOT WORKING_DIRECTORY)
+
+file(REMOVE_RECURSE "${WORKING_DIRECTORY}")
+file(MAKE_DIRECTORY "${WORKING_DIRECTORY}")
+file(COPY "${CHECK_FILE}" DESTINATION "${WORKING_DIRECTORY}")
+get_filename_component(check_file "${CHECK_FILE}" NAME)
+file(WRITE "${WORKING_DIRECTORY}/input.txt" "1\n")
+
+# run tfel-check and check if the commands were executed or if the
+# results were taken from the cache
+function(run_tfel_check step expected)
+  execute_process(
+    COMMAND ${TFEL_CHECK} --cache ${check_file}
+    WORKING_DIRECTORY "${WORKING_DIRECTORY}"
+    OUTPUT_VARIABLE output
+    ERROR_VARIABLE error
+    RESULT_VARIABLE result)
+  if(result)
+    message(FATAL_ERROR "Failed: tfel-check exited != 0 (${step}).\n"
+      "${output}\n${error}")
+  endif(result)
+  # commands taken from the cache are reported as `[CACHED-PASS]`
+  string(FIND "${output}" "Exec-1" command)
+  if(command EQUAL -1)
+    message(FATAL_ERROR "Failed: unexpected output (${step}).\n${output}")
+  endif(command EQUAL -1)
+  string(FIND "${output}" "[CACHED-PASS]" cached)
+  if(cached EQUAL -1)
+    set(status "executed")
+  else(cached EQUAL -1)
+    set(status "cached")
+  endif(cached EQUAL -1)
+  if(NOT status STREQUAL expected)
+    message(FATAL_ERROR "Failed: the test was ${status} "
+      "rather than ${expected} (${step}).\n${output}")
+  endif(NOT status STREQUAL expected)
+endfunction(run_tfel_check)
+
+run_tfel_check("first execution" "executed")
+run_tfel_check("unchanged inputs" "cached")
+file(WRITE "${WORKING_DIRECTORY}/input.txt" "2\n")
+run_tfel_check("modified input file" "executed")
+run_tfel_check("unchanged inputs after modification" "cached")
+
+# everything went fine...
+message(STATUS "Passed: the cache of tfel-check is used and invalidated")
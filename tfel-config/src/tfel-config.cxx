@@ -90,6 +90,8 @@ static bool debugflags = false;
 static bool oflags0 = false;
 static bool oflags = false;
 static bool oflags2 = false;
+static bool pgoInstrumentationFlags = false;
+static bool pgoOptimisationFlags = false;
 static bool warning = false;
 static bool incs = false;
 static bool incspath = false;
@@ -322,6 +324,15 @@ int main(const int argc, const char* const* const argv) {
         "return some aggressive optimisation flags, "
         "possibly at the expense of numerical precision. "
         "This shall be added to `--oflags` results.");
+    registerCallBack(
+        "--pgo-instrumentation-flags", [] { pgoInstrumentationFlags = true; },
+        "return the flags used to instrument the code in order to collect "
+        "profiles (profile guided optimisation).");
+    registerCallBack(
+        "--pgo-optimisation-flags", [] { pgoOptimisationFlags = true; },
+        "return the flags used to optimise the code using the collected "
+        "profiles, including link time optimisation flags "
+        "(profile guided optimisation).");
     registerCallBack(
         "--warning", [] { warning = true; },
         "return tfel recommended warnings.");
@@ -599,6 +610,22 @@ int main(const int argc, const char* const* const argv) {
       std::cout << OPTIMISATION_FLAGS2 << " ";
     }
 
+    if (pgoInstrumentationFlags) {
+#if (defined __GNUC__) || (defined __clang__) || (defined __INTEL_COMPILER)
+      std::cout << "-fprofile-generate ";
+#endif /* __GNUC__ */
+    }
+
+    if (pgoOptimisationFlags) {
+#if defined __clang__
+      std::cout << "-fprofile-use -Wno-profile-instr-unprofiled "
+                << "-Wno-profile-instr-out-of-date -flto ";
+#elif (defined __GNUC__) || (defined __INTEL_COMPILER)
+      std::cout << "-fprofile-use -fprofile-correction -Wno-missing-profile "
+                << "-flto ";
+#endif /* __GNUC__ */
+    }
+
     if (warning) {
       std::cout << COMPILER_WARNINGS << " ";
     }